@@ -22,9 +22,13 @@
  */
 
 #include <limits.h>
+#include <map>
 
 #include "ardour/meter.h"
+#include "ardour/meter_snapshot.h"
 #include "ardour/logmeter.h"
+#include "ardour/route.h"
+#include "ardour/session.h"
 
 #include <gtkmm2ext/utils.h>
 #include "pbd/fastlog.h"
@@ -49,6 +53,10 @@ LevelMeterBase::LevelMeterBase (Session* s, PBD::EventLoop::InvalidationRecord*
 	: parent_invalidator(ir)
 	, _meter (0)
 	, _meter_orientation(o)
+	, _route_meter (false)
+	, _route_id (0)
+	, _snapshot (0)
+	, _snapshot_route (0)
 	, regular_meter_width (6)
 	, meter_length (0)
 	, thin_meter_width(2)
@@ -86,6 +94,10 @@ LevelMeterBase::set_meter (PeakMeter* meter)
 	_meter = meter;
 	color_changed = true; // force update
 
+	Route* r = meter ? dynamic_cast<Route*> (meter->owner ()) : 0;
+	_route_meter = r && r->peak_meter ().get () == meter;
+	_route_id = _route_meter ? r->id () : PBD::ID (0);
+
 	if (_meter) {
 		_meter->ConfigurationChanged.connect (_configuration_connection, parent_invalidator, std::bind (&LevelMeterBase::configuration_changed, this, _1, _2), gui_context());
 		_meter->MeterTypeChanged.connect (_meter_type_connection, parent_invalidator, std::bind (&LevelMeterBase::meter_type_changed, this, _1), gui_context());
@@ -127,6 +139,58 @@ static float vu_standard() {
 	}
 }
 
+/* Level meters share one copy of the session's meter snapshot,
+ * refreshed at most once per screen update.
+ */
+namespace {
+struct SharedMeterSnapshot {
+	SharedMeterSnapshot () : session (0), when (0), valid (false) {}
+
+	int route_index (Session* s, PBD::ID const& id)
+	{
+		int64_t now = g_get_monotonic_time ();
+		if (s != session || now - when > 5000) {
+			session = s;
+			when    = now;
+			valid   = s && s->meter_snapshot (snapshot);
+			index.clear ();
+			for (uint32_t r = 0; valid && r < snapshot.n_routes; ++r) {
+				index[snapshot.route_id[r]] = r;
+			}
+		}
+		std::map<PBD::ID, uint32_t>::const_iterator i = index.find (id);
+		return i == index.end () ? -1 : (int) i->second;
+	}
+
+	Session*                    session;
+	int64_t                     when;
+	bool                        valid;
+	MeterSnapshot               snapshot;
+	std::map<PBD::ID, uint32_t> index;
+};
+
+SharedMeterSnapshot shared_snapshot;
+}
+
+float
+LevelMeterBase::meter_level (uint32_t n, MeterType type) const
+{
+	if (!_snapshot || n >= _snapshot->n_channels[_snapshot_route]) {
+		return _meter->meter_level (n, type);
+	}
+
+	uint32_t const c = _snapshot->first_channel[_snapshot_route] + n;
+
+	switch (type) {
+		case MeterMaxPeak:
+			return _snapshot->max_peak_db (c);
+		case MeterPeak:
+			return _snapshot->peak[c];
+		default:
+			return _snapshot->level_db (_snapshot_route, c);
+	}
+}
+
 float
 LevelMeterBase::update_meters ()
 {
@@ -139,9 +203,25 @@ LevelMeterBase::update_meters ()
 
 	uint32_t nmidi = _meter->input_streams().n_midi();
 
+	/* use the snapshot only if it matches the meter's current setup,
+	 * otherwise (e.g. a new route, not yet published) ask the meter
+	 */
+	_snapshot = 0;
+	if (_route_meter) {
+		int const r = shared_snapshot.route_index (_session, _route_id);
+		MeterSnapshot const& s (shared_snapshot.snapshot);
+		if (r >= 0
+		    && s.n_channels[r] == _meter->input_streams ().n_total ()
+		    && s.n_midi[r] == nmidi
+		    && s.meter_type[r] == _meter->meter_type ()) {
+			_snapshot       = &s;
+			_snapshot_route = r;
+		}
+	}
+
 	for (n = 0, i = meters.begin(); i != meters.end(); ++i, ++n) {
 		if ((*i).packed) {
-			const float mpeak = _meter->meter_level(n, MeterMaxPeak);
+			const float mpeak = meter_level (n, MeterMaxPeak);
 			if (mpeak > (*i).max_peak) {
 				(*i).max_peak = mpeak;
 				(*i).meter->set_highlight(mpeak >= UIConfiguration::instance().get_meter_peak());
@@ -151,10 +231,10 @@ LevelMeterBase::update_meters ()
 			}
 
 			if (n < nmidi) {
-				(*i).meter->set (_meter->meter_level (n, MeterPeak));
+				(*i).meter->set (meter_level (n, MeterPeak));
 			} else {
 				MeterType meter_type = _meter->meter_type ();
-				const float peak = _meter->meter_level (n, meter_type);
+				const float peak = meter_level (n, meter_type);
 				if (meter_type == MeterPeak) {
 					(*i).meter->set (log_meter (peak));
 				} else if (meter_type == MeterPeak0dB) {
@@ -168,13 +248,13 @@ LevelMeterBase::update_meters ()
 				} else if (meter_type == MeterVU) {
 					(*i).meter->set (meter_deflect_vu (peak + vu_standard() + meter_lineup(0)));
 				} else if (meter_type == MeterK12) {
-					(*i).meter->set (meter_deflect_k (peak, 12), meter_deflect_k(_meter->meter_level(n, MeterPeak), 12));
+					(*i).meter->set (meter_deflect_k (peak, 12), meter_deflect_k(meter_level (n, MeterPeak), 12));
 				} else if (meter_type == MeterK14) {
-					(*i).meter->set (meter_deflect_k (peak, 14), meter_deflect_k(_meter->meter_level(n, MeterPeak), 14));
+					(*i).meter->set (meter_deflect_k (peak, 14), meter_deflect_k(meter_level (n, MeterPeak), 14));
 				} else if (meter_type == MeterK20) {
-					(*i).meter->set (meter_deflect_k (peak, 20), meter_deflect_k(_meter->meter_level(n, MeterPeak), 20));
+					(*i).meter->set (meter_deflect_k (peak, 20), meter_deflect_k(meter_level (n, MeterPeak), 20));
 				} else { // RMS
-					(*i).meter->set (log_meter (peak), log_meter(_meter->meter_level(n, MeterPeak)));
+					(*i).meter->set (log_meter (peak), log_meter(meter_level (n, MeterPeak)));
 				}
 			}
 		}
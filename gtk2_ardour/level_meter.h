@@ -31,6 +31,8 @@
 #include <ytkmm/table.h>
 #include <ytkmm/drawingarea.h>
 
+#include "pbd/id.h"
+
 #include "ardour/types.h"
 #include "ardour/chan_count.h"
 #include "ardour/session_handle.h"
@@ -42,6 +44,7 @@
 namespace ARDOUR {
 	class Session;
 	class PeakMeter;
+	struct MeterSnapshot;
 }
 namespace Gtk {
 	class Menu;
@@ -78,6 +81,14 @@ private:
 	ARDOUR::PeakMeter* _meter;
 	ArdourWidgets::FastMeter::Orientation _meter_orientation;
 
+	/* a route's main meter is read from the session's meter snapshot */
+	bool                          _route_meter;
+	PBD::ID                       _route_id;
+	ARDOUR::MeterSnapshot const*  _snapshot; ///< set during update_meters ()
+	uint32_t                      _snapshot_route;
+
+	float meter_level (uint32_t n, ARDOUR::MeterType) const;
+
 	Width _width;
 
 	struct MeterInfo {
@@ -198,6 +198,8 @@ MidiView::init (std::shared_ptr<MidiTrack> mt)
 	_patch_change_fill = UIConfiguration::instance().color_mod ("midi patch change fill", "midi patch change fill");
 
 	_note_group->raise_to_top();
+	/* regions may hold many thousands of notes */
+	_note_group->set_indexed_children (true);
 	EditingContext::DropDownKeys.connect (sigc::mem_fun (*this, &MidiView::drop_down_keys));
 	_midi_context.NoteRangeChanged.connect (sigc::mem_fun (*this, &MidiView::view_changed));
 	_midi_context.NoteModeChanged.connect (sigc::mem_fun (*this, &MidiView::note_mode_changed));
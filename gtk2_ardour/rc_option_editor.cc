@@ -4409,6 +4409,17 @@ These settings will only take effect after %1 is restarted.\n\
 		     sigc::mem_fun (*_rc_config, &RCConfiguration::get_conceal_lv1_if_lv2_exists),
 		     sigc::mem_fun (*_rc_config, &RCConfiguration::set_conceal_lv1_if_lv2_exists)
 		     ));
+
+	SpinOption<int32_t>* lv2w = new SpinOption<int32_t> (
+			"lv2-worker-pool-threads",
+			_("LV2 worker threads (0: one per plugin)"),
+			sigc::mem_fun (*_rc_config, &RCConfiguration::get_lv2_worker_pool_threads),
+			sigc::mem_fun (*_rc_config, &RCConfiguration::set_lv2_worker_pool_threads),
+			0, 16, 1, 2
+			);
+	Gtkmm2ext::UI::instance()->set_tip (lv2w->tip_widget(), _("Run the background work of LV2 plugins (e.g. loading samples) on a shared pool of threads, instead of one thread for each plugin instance."));
+	lv2w->set_note (string_compose (_("This setting will only take effect when %1 is restarted."), PROGRAM_NAME));
+	add_option (_("Plugins"), lv2w);
 	add_option (_("Plugins"), new OptionEditorHeading (_("Instrument")));
 
 	bo = new BoolOption (
@@ -4979,6 +4990,16 @@ These settings will only take effect after %1 is restarted.\n\
 		procs->set_note (string_compose (_("This setting will only take effect when %1 is restarted."), PROGRAM_NAME));
 
 		add_option (_("Performance"), procs);
+
+		bo = new BoolOption (
+			     "graph-work-stealing",
+			     _("Use work-stealing scheduler for parallel processing"),
+			     sigc::mem_fun (*_rc_config, &RCConfiguration::get_graph_work_stealing),
+			     sigc::mem_fun (*_rc_config, &RCConfiguration::set_graph_work_stealing)
+			     );
+		Gtkmm2ext::UI::instance()->set_tip (bo->tip_widget(),
+						    _("When enabled, each DSP thread keeps a queue of routes that are ready to be processed, and idle threads take work from other threads' queues. This can reduce contention with large sessions on many processors."));
+		add_option (_("Performance"), bo);
 	}
 
 #if !(defined PLATFORM_WINDOWS || defined __APPLE__)
@@ -657,4 +657,163 @@ arm_neon_copy_vector(float* __restrict dst, const float* __restrict src, uint32_
 	}
 }
 
+
+/**
+ * @brief Render a linear ramp: dst[i] = start + i * step
+ *
+ * @param[out] dst Pointer to the destination buffer
+ * @param[in] nframes Number of frames to render
+ * @param[in] start Value of the first sample
+ * @param[in] step Increment per sample
+ */
+C_FUNC void
+arm_neon_fill_ramp(float *dst, uint32_t nframes, float start, float step)
+{
+	const float idx[4] = { 0.f, 1.f, 2.f, 3.f };
+
+	float32x4_t vstart = vdupq_n_f32(start);
+	float32x4_t vstep  = vdupq_n_f32(step);
+	float32x4_t vidx0  = vld1q_f32(idx);
+	float32x4_t vidx1  = vaddq_f32(vidx0, vdupq_n_f32(4.f));
+	float32x4_t vinc   = vdupq_n_f32(8.f);
+
+	uint32_t i = 0;
+
+	for (; i + 8 <= nframes; i += 8)
+	{
+		vst1q_f32(dst + i + 0, vmlaq_f32(vstart, vidx0, vstep));
+		vst1q_f32(dst + i + 4, vmlaq_f32(vstart, vidx1, vstep));
+		vidx0 = vaddq_f32(vidx0, vinc);
+		vidx1 = vaddq_f32(vidx1, vinc);
+	}
+
+	if (i + 4 <= nframes)
+	{
+		vst1q_f32(dst + i, vmlaq_f32(vstart, vidx0, vstep));
+		i += 4;
+	}
+
+	// Do the remaining samples
+	for (; i < nframes; ++i)
+	{
+		dst[i] = start + i * step;
+	}
+}
+
+
+/**
+ * @brief Apply a per-sample gain: dst[i] *= gain[i]
+ *
+ * @param[in,out] dst Pointer to the destination buffer, which gets updated
+ * @param[in] gain Pointer to the gain coefficients
+ * @param[in] nframes Number of frames to process
+ */
+C_FUNC void
+arm_neon_apply_gain_vector(float *dst, const float *gain, uint32_t nframes)
+{
+	uint32_t i = 0;
+
+	for (; i + 8 <= nframes; i += 8)
+	{
+		vst1q_f32(dst + i + 0, vmulq_f32(vld1q_f32(dst + i + 0), vld1q_f32(gain + i + 0)));
+		vst1q_f32(dst + i + 4, vmulq_f32(vld1q_f32(dst + i + 4), vld1q_f32(gain + i + 4)));
+	}
+
+	// Do the remaining samples
+	for (; i < nframes; ++i)
+	{
+		dst[i] *= gain[i];
+	}
+}
+
+
+/**
+ * @brief Mix a buffer with per-sample gain: dst[i] += src[i] * gain[i]
+ *
+ * @param[in,out] dst Pointer to the destination buffer, which gets updated
+ * @param[in] src Pointer to the source buffer
+ * @param[in] gain Pointer to the gain coefficients
+ * @param[in] nframes Number of frames to process
+ */
+C_FUNC void
+arm_neon_mix_buffers_with_gain_vector(float *dst, const float *src, const float *gain, uint32_t nframes)
+{
+	uint32_t i = 0;
+
+	for (; i + 8 <= nframes; i += 8)
+	{
+		vst1q_f32(dst + i + 0, vfmaq_f32(vld1q_f32(dst + i + 0), vld1q_f32(src + i + 0), vld1q_f32(gain + i + 0)));
+		vst1q_f32(dst + i + 4, vfmaq_f32(vld1q_f32(dst + i + 4), vld1q_f32(src + i + 4), vld1q_f32(gain + i + 4)));
+	}
+
+	// Do the remaining samples
+	for (; i < nframes; ++i)
+	{
+		dst[i] += src[i] * gain[i];
+	}
+}
+
+
+/**
+ * @brief Write a mono buffer into one channel of an interleaved buffer
+ *
+ * Samples of the other channels in @a dst are left untouched.
+ *
+ * @param[in,out] dst Pointer to the first sample of the channel in the interleaved buffer
+ * @param[in] src Pointer to the mono source buffer
+ * @param[in] stride Number of interleaved channels
+ * @param[in] nframes Number of frames to process
+ */
+C_FUNC void
+arm_neon_interleave(float *dst, const float *src, uint32_t stride, uint32_t nframes)
+{
+	uint32_t i = 0;
+
+	if (stride == 2)
+	{
+		for (; i + 4 <= nframes; i += 4)
+		{
+			float32x4x2_t d = vld2q_f32(dst + 2 * i);
+			d.val[0] = vld1q_f32(src + i);
+			vst2q_f32(dst + 2 * i, d);
+		}
+	}
+
+	// Do the remaining samples
+	for (; i < nframes; ++i)
+	{
+		dst[i * stride] = src[i];
+	}
+}
+
+
+/**
+ * @brief Extract one channel of an interleaved buffer into a mono buffer
+ *
+ * @param[out] dst Pointer to the mono destination buffer
+ * @param[in] src Pointer to the first sample of the channel in the interleaved buffer
+ * @param[in] stride Number of interleaved channels
+ * @param[in] nframes Number of frames to process
+ */
+C_FUNC void
+arm_neon_deinterleave(float *dst, const float *src, uint32_t stride, uint32_t nframes)
+{
+	uint32_t i = 0;
+
+	if (stride == 2)
+	{
+		for (; i + 4 <= nframes; i += 4)
+		{
+			float32x4x2_t s = vld2q_f32(src + 2 * i);
+			vst1q_f32(dst + i, s.val[0]);
+		}
+	}
+
+	// Do the remaining samples
+	for (; i < nframes; ++i)
+	{
+		dst[i] = src[i * stride];
+	}
+}
+
 #endif
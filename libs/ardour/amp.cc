@@ -106,13 +106,17 @@ Amp::run (BufferSet& bufs, samplepos_t start_sample, samplepos_t /*end_sample*/,
 		const gain_t a = 156.825f / (gain_t)_session.nominal_sample_rate(); // 25 Hz LPF; see Amp::apply_gain for details
 		gain_t lpf = _current_gain;
 
+		/* the smoothed gain is the same for all channels, compute it
+		 * once (in place), then apply it using the optimized routine
+		 */
+		for (pframes_t nx = 0; nx < nframes; ++nx) {
+			const gain_t g = lpf;
+			lpf += a * (gab[nx] - lpf);
+			gab[nx] = g;
+		}
+
 		for (BufferSet::audio_iterator i = bufs.audio_begin(); i != bufs.audio_end(); ++i) {
-			Sample* const sp = i->data();
-			lpf = _current_gain;
-			for (pframes_t nx = 0; nx < nframes; ++nx) {
-				sp[nx] *= lpf;
-				lpf += a * (gab[nx] - lpf);
-			}
+			apply_gain_vector (i->data(), gab, nframes);
 		}
 
 		if (fabsf (lpf) < GAIN_COEFF_SMALL) {
@@ -203,17 +207,29 @@ Amp::apply_gain (BufferSet& bufs, samplecnt_t sample_rate, samplecnt_t nframes,
 	 */
 	const gain_t a = 156.825f / (gain_t)sample_rate; // 25 Hz LPF
 
-	for (BufferSet::audio_iterator i = bufs.audio_begin(); i != bufs.audio_end(); ++i) {
-		Sample* const buffer = i->data();
-		double lpf = initial;
+	/* The IIR is inherently serial, but its output is the same for all
+	 * channels: compute it once per chunk and apply the gain-vector to
+	 * each channel using the optimized routine.
+	 */
+	gain_t    gain[256];
+	double    lpf = initial;
+	pframes_t n   = 0;
 
-		for (pframes_t nx = 0; nx < nframes; ++nx) {
-			buffer[nx] *= lpf;
+	while (n < nframes) {
+		pframes_t const cnt = std::min<samplecnt_t> (nframes - n, 256);
+
+		for (pframes_t nx = 0; nx < cnt; ++nx) {
+			gain[nx] = lpf;
 			lpf += a * (target - lpf);
 		}
-		if (i == bufs.audio_begin()) {
-			rv = lpf;
+		for (BufferSet::audio_iterator i = bufs.audio_begin(); i != bufs.audio_end(); ++i) {
+			apply_gain_vector (i->data() + n, gain, cnt);
 		}
+		n += cnt;
+	}
+
+	if (bufs.count().n_audio() > 0) {
+		rv = lpf;
 	}
 
 	if (fabsf (rv - target) < GAIN_COEFF_DELTA) {
@@ -276,10 +292,19 @@ Amp::apply_gain (AudioBuffer& buf, samplecnt_t sample_rate, samplecnt_t nframes,
 	Sample* const buffer = buf.data (offset);
 	const gain_t a = 156.825f / (gain_t)sample_rate; // 25 Hz LPF, see [other] Amp::apply_gain() above for details
 
-	gain_t lpf = initial;
-	for (pframes_t nx = 0; nx < nframes; ++nx) {
-		buffer[nx] *= lpf;
-		lpf += a * (target - lpf);
+	gain_t    gain[256];
+	gain_t    lpf = initial;
+	pframes_t n   = 0;
+
+	while (n < nframes) {
+		pframes_t const cnt = std::min<samplecnt_t> (nframes - n, 256);
+
+		for (pframes_t nx = 0; nx < cnt; ++nx) {
+			gain[nx] = lpf;
+			lpf += a * (target - lpf);
+		}
+		apply_gain_vector (buffer + n, gain, cnt);
+		n += cnt;
 	}
 
 	if (fabsf (lpf - target) < GAIN_COEFF_DELTA) return target;
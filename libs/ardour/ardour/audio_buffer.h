@@ -21,6 +21,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstring>
 
 #include "ardour/buffer.h"
@@ -180,10 +181,14 @@ public:
 
 		Sample* dst        = _data + dst_offset;
 		gain_t  gain_delta = (target - initial) / len;
-
-		for (samplecnt_t n = 0; n < len; ++n) {
-			*dst++ += (*src++ * initial);
-			initial += gain_delta;
+		gain_t  gain[128];
+
+		/* render the gain-ramp in chunks, and apply it using the optimized routine */
+		for (samplecnt_t n = 0; n < len;) {
+			pframes_t const cnt = std::min<samplecnt_t> (len - n, 128);
+			fill_ramp (gain, cnt, initial + n * gain_delta, gain_delta);
+			mix_buffers_with_gain_vector (dst + n, src + n, gain, cnt);
+			n += cnt;
 		}
 
 		_silent  = (_silent && initial == 0 && target == 0);
@@ -21,9 +21,12 @@
 
 #pragma once
 
+#include <atomic>
 #include <vector>
 #include <list>
 
+#include "pbd/mutex.h"
+
 #include "ardour/ardour.h"
 #include "ardour/playlist.h"
 
@@ -58,6 +61,19 @@ private:
 	bool region_changed (const PBD::PropertyChange&, std::shared_ptr<Region>);
 	void source_offset_changed (std::shared_ptr<AudioRegion>);
         void load_legacy_crossfades (const XMLNode&, int version);
+
+	/* The segments of regions to read for a range of the playlist, cached
+	 * for subsequent reads (other channels, next refill) of that range.
+	 */
+	struct RenderPlan;
+
+	std::shared_ptr<RenderPlan const> render_plan (timepos_t const & start, timecnt_t const & cnt);
+	void build_render_plan (RenderPlan&, bool solo_selection);
+	void drop_render_plan ();
+
+	PBD::Mutex                        _render_plan_lock;
+	std::shared_ptr<RenderPlan const> _render_plan;
+	std::atomic<uint64_t>             _render_plan_serial;
 };
 
 } /* namespace ARDOUR */
@@ -23,6 +23,7 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
 #include <time.h>
 
@@ -89,6 +90,11 @@ class LIBARDOUR_API AudioSource : virtual public Source, public ARDOUR::AudioRea
 	virtual int setup_peakfile () { return 0; }
 	int close_peakfile ();
 
+	/** @return number of levels of the peak pyramid, including the
+	 *  peakfile itself, or 0 if only the peakfile is available.
+	 */
+	size_t n_peak_levels () const;
+
 	int prepare_for_peakfile_writes ();
 	void done_with_peakfile_writes (bool done = true);
 
@@ -113,8 +119,13 @@ class LIBARDOUR_API AudioSource : virtual public Source, public ARDOUR::AudioRea
 
 	std::string         _peakpath;
 
+	/** @return path of the file holding the coarser levels of the peak pyramid */
+	std::string peak_levels_path () const;
+
 	int initialize_peakfile (const std::string& path, const bool in_session = false);
 	int build_peaks_from_scratch ();
+	int compute_peaks_in_parallel (WriterLock&, samplecnt_t chunksize);
+	int write_peaks (PeakData const*, samplecnt_t npeaks, samplepos_t first_sample, samplecnt_t cnt);
 	int compute_and_write_peaks (Sample const * buf, samplecnt_t first_sample, samplecnt_t cnt,
 	bool force, bool intermediate_peaks_ready_signal);
 	void truncate_peakfile();
@@ -144,6 +155,24 @@ class LIBARDOUR_API AudioSource : virtual public Source, public ARDOUR::AudioRea
         mutable PBD::Mutex _peaks_ready_lock;
         PBD::Mutex _initialize_peaks_lock;
 
+	/** A level of the peakfile's pyramid of increasingly coarse peaks,
+	 *  level 0 being the peakfile itself at _FPP samples-per-peak, all
+	 *  others are stored in peak_levels_path().
+	 */
+	struct PeakLevel {
+		PeakLevel (samplecnt_t f, off_t o, samplecnt_t c) : fpp (f), offset (o), count (c) {}
+		samplecnt_t fpp;    ///< samples per peak
+		off_t       offset; ///< byte offset of the first peak in its file
+		samplecnt_t count;  ///< number of peaks
+	};
+
+	int  write_peak_pyramid ();
+	void load_peak_pyramid (off_t peakfile_size, time_t peakfile_mtime);
+
+	/** levels of the pyramid, empty if the peakfile only has level 0 */
+	std::vector<PeakLevel> _peak_levels;
+	mutable PBD::Mutex     _peak_levels_lock;
+
 	int        _peakfile_fd;
 	samplecnt_t peak_leftover_cnt;
 	samplecnt_t peak_leftover_size;
@@ -31,6 +31,7 @@
 #include "evoral/ControlList.h"
 #include "evoral/Parameter.h"
 
+#include "pbd/mutex.h"
 #include "pbd/undo.h"
 #include "pbd/xml++.h"
 #include "pbd/statefuldestructible.h"
@@ -139,6 +140,11 @@ private:
 	bool operator== (const AutomationList&) const { /* not called */ abort(); return false; }
 	XMLNode* _before; //used for undo of touch start/stop pairs.
 
+	/* serialized events, valid while _events_cache_count == edit_count () */
+	mutable PBD::Mutex       _events_cache_lock;
+	mutable std::string      _events_cache;
+	mutable uint64_t         _events_cache_count;
+
 };
 
 } // namespace
@@ -0,0 +1,204 @@
+/*
+ * Copyright (C) 2026 Ardour Developers
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "pbd/id.h"
+#include "pbd/microseconds.h"
+#include "pbd/mutex.h"
+#include "pbd/pthread_utils.h"
+#include "pbd/ringbuffer.h"
+
+#include "ardour/libardour_visibility.h"
+#include "ardour/session_handle.h"
+
+namespace ARDOUR
+{
+
+class Session;
+
+/** Per-node DSP timing of the process graph.
+ *
+ * Process threads record the start and end time of every route and plugin
+ * they run into a thread-local ringbuffer (no locks, no allocation).
+ * A background thread collects these events and aggregates them per
+ * route/plugin, and optionally captures a window of cycles, which can be
+ * written as Chrome trace-event JSON (chrome://tracing, perfetto.dev).
+ */
+class LIBARDOUR_API DSPTrace : public SessionHandleRef
+{
+public:
+	enum Kind {
+		RouteProcess = 0,
+		PluginRun    = 1,
+	};
+
+	struct Event {
+		uint64_t            id;     ///< PBD::ID of the Route or PluginInsert
+		uint64_t            cycle;
+		PBD::microseconds_t start;
+		PBD::microseconds_t end;
+		uint32_t            thread;
+		uint32_t            kind;
+	};
+
+	struct Stats {
+		std::string         name;
+		uint32_t            kind;
+		uint64_t            count;
+		PBD::microseconds_t min;
+		PBD::microseconds_t max;
+		PBD::microseconds_t p99;
+		double              avg;
+	};
+
+	/** RAII helper to time a scope in a process thread */
+	class Timer
+	{
+	public:
+		Timer (Kind k, PBD::ID const& id)
+			: _active (DSPTrace::enabled ())
+		{
+			if (_active) {
+				_ev.id    = id.get_id ();
+				_ev.kind  = k;
+				_ev.start = PBD::get_microseconds ();
+			}
+		}
+
+		~Timer ()
+		{
+			if (_active) {
+				_ev.end = PBD::get_microseconds ();
+				DSPTrace::record (_ev);
+			}
+		}
+
+	private:
+		bool  _active;
+		Event _ev;
+	};
+
+	DSPTrace (Session&);
+	~DSPTrace ();
+
+	/* process-thread API, realtime safe */
+
+	static bool enabled () { return _enabled.load (std::memory_order_relaxed); }
+	static void cycle_start () { _cycle.fetch_add (1, std::memory_order_relaxed); }
+	static void record (Event&);
+
+	/** Allocate a ringbuffer for the calling thread (not realtime safe).
+	 * Must be called by each process thread before it runs any nodes.
+	 */
+	static void thread_init (std::string const& name);
+	/** Release the calling thread's ringbuffer, once it has been drained.
+	 * This is also done when a thread that called thread_init() exits.
+	 */
+	static void thread_fini ();
+
+	/* GUI/Lua API */
+
+	void set_enabled (bool);
+	bool get_enabled () const { return enabled (); }
+
+	/** clear all statistics */
+	void reset ();
+
+	/** per route/plugin statistics, sorted by max. time */
+	std::vector<Stats> stats () const;
+
+	/** @return number of events that were lost since the last reset (),
+	 * because a process thread's ringbuffer was full
+	 */
+	uint64_t dropped () const;
+
+	/** start capturing all events of the next @param n_cycles cycles */
+	void capture (uint32_t n_cycles);
+	/** @return true if the requested number of cycles has been captured */
+	bool capture_complete () const;
+	/** write captured events as Chrome trace-event JSON,
+	 * including the number of events lost during the capture
+	 */
+	bool write_chrome_trace (std::string const& path) const;
+
+private:
+	struct ThreadRing {
+		ThreadRing (std::string const& n, uint32_t i)
+			: rb (8192)
+			, name (n)
+			, index (i)
+			, dead (false)
+			, dropped (0)
+			, dropped_seen (0)
+		{}
+		PBD::RingBuffer<Event> rb;
+		std::string            name;
+		uint32_t               index;
+		std::atomic<bool>      dead;
+		std::atomic<uint64_t>  dropped;      ///< written by the process thread
+		uint64_t               dropped_seen; ///< collector's last value of dropped
+	};
+
+	struct Accumulator {
+		Accumulator ();
+		void add (PBD::microseconds_t);
+
+		uint32_t                         kind;
+		uint64_t                         count;
+		PBD::microseconds_t              min;
+		PBD::microseconds_t              max;
+		double                           sum;
+		std::vector<PBD::microseconds_t> recent; ///< window to compute percentiles
+		size_t                           recent_pos;
+	};
+
+	void collector_thread ();
+	void collect ();
+	std::string object_name (uint64_t id, uint32_t kind) const;
+
+	PBD::Thread*      _collector;
+	std::atomic<bool> _run_collector;
+
+	mutable PBD::Mutex                _stats_lock;
+	std::map<uint64_t, Accumulator>   _stats;
+	std::vector<Event>                _captured;
+	std::map<uint32_t, std::string>   _thread_names;
+	std::map<uint32_t, uint64_t>      _thread_dropped; ///< per thread, during the capture
+	uint64_t                          _capture_start;
+	uint64_t                          _capture_end;
+	uint64_t                          _captured_dropped;
+	uint64_t                          _dropped;
+	uint64_t                          _collected_cycle;
+
+	static std::atomic<bool>     _enabled;
+	static std::atomic<uint64_t> _cycle;
+
+	static PBD::Mutex               _rings_lock;
+	static std::vector<ThreadRing*> _rings;
+	static uint32_t                 _ring_cnt;
+
+	static thread_local ThreadRing* _thread_ring;
+};
+
+} // namespace ARDOUR
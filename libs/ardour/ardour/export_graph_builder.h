@@ -21,7 +21,7 @@
 
 #pragma once
 
-#include "pbd/thread_pool.h"
+#include "pbd/mutex.h"
 
 #include "ardour/export_handler.h"
 #include "ardour/export_analysis.h"
@@ -46,7 +46,9 @@ namespace AudioGrapher {
 	template <typename T> class CmdPipeWriter;
 	template <typename T> class SilenceTrimmer;
 	template <typename T> class TmpFile;
-	template <typename T> class Threader;
+	template <typename T> class FanOut;
+	class FanOutWorkers;
+	template <typename T> class Decoupler;
 	template <typename T> class AllocatingProcessContext;
 }
 
@@ -90,7 +92,12 @@ class LIBARDOUR_API ExportGraphBuilder
 	ExportGraphBuilder (Session const & session);
 	~ExportGraphBuilder ();
 
-	samplecnt_t process (samplecnt_t samples, bool last_cycle);
+	/** Feed all timespans with the data of one cycle.
+	 * @param position timeline position of the first sample to process
+	 * @param samples number of samples to read from each channel
+	 * @return number of samples that were processed (excluding pre-roll)
+	 */
+	samplecnt_t process (samplepos_t position, samplecnt_t samples);
 	bool post_process (); // returns true when finished
 	bool need_postprocessing () const { return !intermediates.empty(); }
 	bool realtime() const { return _realtime; }
@@ -98,13 +105,15 @@ class LIBARDOUR_API ExportGraphBuilder
 
 	void reset ();
 	void cleanup (bool remove_out_files = false);
+	/** Set the timespan that subsequent add_config() calls apply to.
+	 * Several timespans can be added, they are all processed in the
+	 * same pass, each receiving data from its start to its end.
+	 */
 	void set_current_timespan (std::shared_ptr<ExportTimespan> span);
 	void add_config (FileSpec const & config, bool rt);
 	void get_analysis_results (AnalysisResults& results);
 
-	std::vector<std::string> exported_files () const {
-		return _exported_files;
-	}
+	std::vector<std::string> exported_files (std::shared_ptr<ExportTimespan> span) const;
 
   private:
 
@@ -113,10 +122,10 @@ class LIBARDOUR_API ExportGraphBuilder
 	}
 
 	void add_export_fn (std::string const& fn) {
-		_exported_files.push_back (fn);
+		_exported_files[timespan.get ()].push_back (fn);
 	}
 
-	std::vector<std::string> _exported_files;
+	std::map<ExportTimespan const*, std::vector<std::string> > _exported_files;
 
 	void add_split_config (FileSpec const & config);
 
@@ -212,7 +221,7 @@ class LIBARDOUR_API ExportGraphBuilder
 		typedef std::shared_ptr<AudioGrapher::PeakReader> PeakReaderPtr;
 		typedef std::shared_ptr<AudioGrapher::LoudnessReader> LoudnessReaderPtr;
 		typedef std::shared_ptr<AudioGrapher::TmpFile<Sample> > TmpFilePtr;
-		typedef std::shared_ptr<AudioGrapher::Threader<Sample> > ThreaderPtr;
+		typedef std::shared_ptr<AudioGrapher::FanOut<Sample> > FanOutPtr;
 		typedef std::shared_ptr<AudioGrapher::AllocatingProcessContext<Sample> > BufferPtr;
 
 		void prepare_post_processing ();
@@ -227,7 +236,7 @@ class LIBARDOUR_API ExportGraphBuilder
 		BufferPtr       buffer;
 		PeakReaderPtr   peak_reader;
 		TmpFilePtr      tmp_file;
-		ThreaderPtr     threader;
+		FanOutPtr       fan_out;
 
 		LoudnessReaderPtr    loudness_reader;
 		std::list<SFC> children;
@@ -247,6 +256,7 @@ class LIBARDOUR_API ExportGraphBuilder
 
 	                                        private:
 		typedef std::shared_ptr<AudioGrapher::SampleRateConverter> SRConverterPtr;
+		typedef std::shared_ptr<AudioGrapher::Decoupler<Sample> > DecouplerPtr;
 
 		template<typename T>
 		void add_child_to_list (FileSpec const & new_config, boost::ptr_list<T> & list);
@@ -256,6 +266,7 @@ class LIBARDOUR_API ExportGraphBuilder
 		boost::ptr_list<SFC>  children;
 		boost::ptr_list<Intermediate> intermediate_children;
 		SRConverterPtr        converter;
+		DecouplerPtr          decoupler;
 		samplecnt_t           max_samples_out;
 	};
 
@@ -301,23 +312,46 @@ class LIBARDOUR_API ExportGraphBuilder
 	Session const & session;
 	std::shared_ptr<ExportTimespan> timespan;
 
-	// Roots for export processor trees
 	typedef boost::ptr_list<ChannelConfig> ChannelConfigList;
-	ChannelConfigList channel_configs;
 
-	// The sources of all data, each channel is read only once
-	ChannelMap channels;
+	// Roots for export processor trees, one set per timespan
+	struct TimespanGraph {
+		TimespanGraph (std::shared_ptr<ExportTimespan> ts)
+			: timespan (ts)
+			, done (false)
+		{}
+
+		std::shared_ptr<ExportTimespan> timespan;
+		ChannelConfigList               channel_configs;
+		ChannelMap                      channels;
+		/** index into sources, for each entry of channels */
+		std::vector<std::pair<size_t, AnyExportPtr> > inputs;
+		/** EndOfInput was sent */
+		bool                            done;
+	};
+
+	typedef boost::ptr_list<TimespanGraph> TimespanGraphList;
+	TimespanGraphList timespans;
+
+	TimespanGraph& current_graph ();
+	void           update_sources ();
+
+	// The sources of all data, each channel is read only once per cycle
+	std::vector<ExportChannelPtr> sources;
+	std::vector<Buffer const*>    source_buffers;
 
 	samplecnt_t process_buffer_samples;
 
 	std::list<Intermediate *> intermediates;
 
+	/* Intermediates are post-processed one after the other, they share worker threads */
+	std::shared_ptr<AudioGrapher::FanOutWorkers> fan_out_workers;
+
 	AnalysisMap analysis_map;
 
 	bool        _realtime;
 	samplecnt_t _master_align;
 
-	PBD::ThreadPool thread_pool;
 	PBD::Mutex engine_request_lock;
 };
 
@@ -25,6 +25,7 @@
 
 #include <map>
 #include <memory>
+#include <vector>
 
 #include <boost/operators.hpp>
 
@@ -127,9 +128,27 @@ class LIBARDOUR_API ExportHandler : public ExportElementFactory, public sigc::tr
 
 	void reset ();
 
+	/** A timespan that is left to export, see pass_size () */
+	struct PassCandidate {
+		PassCandidate (samplepos_t s, samplepos_t e, bool share)
+		  : start (s), end (e), shareable (share) {}
+
+		samplepos_t start;
+		samplepos_t end;
+		bool        shareable; ///< false if it needs a pass of its own
+	};
+
+	/** Decide how many timespans are exported in one freewheel pass.
+	 * The pass rolls through the gaps between its timespans.
+	 *
+	 * @param candidates timespans left to export, sorted by start
+	 * @param max_gap the longest gap to roll through
+	 * @return the number of leading candidates to export together
+	 */
+	static size_t pass_size (std::vector<PassCandidate> const& candidates, samplecnt_t max_gap);
+
   private:
 
-	void handle_duplicate_format_extensions();
 	int process (samplecnt_t samples);
 
 	Session &          session;
@@ -142,6 +161,8 @@ class LIBARDOUR_API ExportHandler : public ExportElementFactory, public sigc::tr
 	typedef std::multimap<ExportTimespanPtr, FileSpec> ConfigMap;
 	ConfigMap          config_map;
 
+	void handle_duplicate_format_extensions (ConfigMap::iterator first, ConfigMap::iterator last);
+
 	bool               post_processing;
 
 	/* Timespan management */
@@ -159,12 +180,17 @@ class LIBARDOUR_API ExportHandler : public ExportElementFactory, public sigc::tr
 	int  post_process ();
 	void finish_timespan ();
 
+	bool can_share_pass (ExportTimespanPtr) const;
+
 	typedef std::pair<ConfigMap::iterator, ConfigMap::iterator> TimespanBounds;
 	ExportTimespanPtr     current_timespan;
-	TimespanBounds        timespan_bounds;
+
+	/* timespans processed in the current pass, current_timespan is the first */
+	std::vector<ExportTimespanPtr> current_timespans;
 
 	PBD::ScopedConnection process_connection;
 	samplepos_t           process_position;
+	samplepos_t           process_end;
 
 	/* CD Marker stuff */
 
@@ -29,9 +29,11 @@ namespace ARDOUR {
 	LIBARDOUR_API extern const char* const statefile_suffix;
 	LIBARDOUR_API extern const char* const pending_suffix;
 	LIBARDOUR_API extern const char* const peakfile_suffix;
+	LIBARDOUR_API extern const char* const peak_levels_suffix;
 	LIBARDOUR_API extern const char* const backup_suffix;
 	LIBARDOUR_API extern const char* const temp_suffix;
 	LIBARDOUR_API extern const char* const history_suffix;
+	LIBARDOUR_API extern const char* const history_journal_suffix;
 	LIBARDOUR_API extern const char* const export_preset_suffix;
 	LIBARDOUR_API extern const char* const export_format_suffix;
 	LIBARDOUR_API extern const char* const session_archive_suffix;
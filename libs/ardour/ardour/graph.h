@@ -24,6 +24,7 @@
 
 #include <atomic>
 #include <list>
+#include <map>
 #include <memory>
 #include <set>
 #include <string>
@@ -31,7 +32,10 @@
 
 
 #include "pbd/mpmc_queue.h"
+#include "pbd/mutex.h"
+#include "pbd/rcu.h"
 #include "pbd/semutils.h"
+#include "pbd/work_stealing_deque.h"
 
 #include "ardour/audio_backend.h"
 #include "ardour/libardour_visibility.h"
@@ -55,17 +59,56 @@ typedef std::shared_ptr<GraphNode> node_ptr_t;
 typedef std::list<node_ptr_t> node_list_t;
 typedef std::set<node_ptr_t>  node_set_t;
 
-struct GraphChain {
+struct LIBARDOUR_API GraphChain {
 	GraphChain (GraphNodeList const&, GraphEdges const&);
 	~GraphChain ();
 	void dump () const;
 	bool plot (std::string const&) const;
 
+	/** Re-order the initial trigger list and activation sets by the current
+	 * cost estimates of the nodes. This is a no-op unless the estimates
+	 * drifted since the last sort. Must not be called from a realtime thread.
+	 *
+	 * @return true if the order of any list changed
+	 */
+	bool resort ();
+
+	/** The order in which nodes are triggered, longest critical path first */
+	struct TriggerOrder {
+		/** Nodes that are not fed by any other nodes */
+		node_list_t init_trigger_list;
+		/** The nodes that each node directly feeds */
+		std::map<GraphNode const*, node_list_t> activation_set;
+	};
+
+	/** Nodes directly fed by the given node, in the order latched by
+	 * Graph::prep for the current process cycle.
+	 */
+	node_list_t const& activation_set (GraphNode const* n) const
+	{
+		return _rt_order->activation_set.at (n);
+	}
+
 	node_list_t _nodes_rt;
-	/** Nodes that are not fed by any other nodes */
-	node_list_t _init_trigger_list;
+	/** Replaced by resort() while the chain may be in use */
+	SerializedRCUManager<TriggerOrder> _trigger_order;
+	/** The order used by the current process cycle, set by Graph::prep */
+	mutable std::shared_ptr<TriggerOrder const> _rt_order;
 	/** The number of nodes that do not feed any other node */
 	int _n_terminal_nodes;
+	/** Estimated time [usec] from the start of a node to the end of the last terminal node it feeds */
+	std::map<node_ptr_t, float> _critical_path;
+
+private:
+	float critical_path (node_ptr_t const&);
+	void  update_critical_path ();
+
+	/** Cost estimates of the nodes used for the current order */
+	std::map<node_ptr_t, float> _sorted_cost;
+
+	/** Serialize access to the nodes' activation sets, which are
+	 * shared by all chains and modified in place */
+	static PBD::Mutex _activation_lock;
 };
 
 class LIBARDOUR_API Graph : public SessionHandleRef
@@ -84,6 +127,11 @@ public:
 
 	/* called by GraphNode */
 	void trigger (ProcessNode* n);
+
+	/** When true, the last node passed to trigger() is the one this
+	 * thread runs next, and downstream nodes are best triggered
+	 * lowest priority first. */
+	bool reverse_trigger_order () const;
 	void reached_terminal_node ();
 
 	/* called by virtual GraphNode::process() */
@@ -105,6 +153,8 @@ private:
 
 	void helper_thread ();
 
+	ProcessNode* steal_one ();
+
 	PBD::MPMCQueue<ProcessNode*> _trigger_queue;      ///< nodes that can be processed
 	std::atomic<uint32_t>        _trigger_queue_size; ///< number of entries in trigger-queue
 
@@ -114,6 +164,12 @@ private:
 	/** The number of processing threads that are asleep */
 	std::atomic<uint32_t> _idle_thread_cnt;
 
+	/** Signals of _execution_sem that no thread has woken up for yet */
+	std::atomic<uint32_t> _pending_wakeups;
+
+	void wake_idle_threads (uint32_t);
+	void woke_up ();
+
 	/** Signalled to start a run of the graph for a process callback */
 	PBD::Semaphore _callback_start_sem;
 	PBD::Semaphore _callback_done_sem;
@@ -132,6 +188,22 @@ private:
 	/* graph chain */
 	GraphChain const* _graph_chain;
 
+	/* work-stealing scheduler, one deque per process-thread.
+	 * The global _trigger_queue is still used for the initial
+	 * nodes, for nodes triggered from non-graph threads and when
+	 * a deque is full. Deques have a fixed size, since threads
+	 * may steal from any of them at any time.
+	 */
+	typedef PBD::WorkStealingDeque<ProcessNode*> WorkerQueue;
+	std::vector<std::unique_ptr<WorkerQueue>> _worker_queues;
+
+	/* scheduler mode, latched at the start of each cycle */
+	bool _work_stealing;
+
+	static thread_local int          _worker_id;   ///< index into _worker_queues, -1 for non-graph threads
+	static thread_local ProcessNode* _next_node;   ///< last ready downstream node, runs next on the same thread
+	static thread_local uint32_t     _steal_seed;  ///< PRNG state for picking a victim
+
 	/* parameter caches */
 	pframes_t   _process_nframes;
 	samplepos_t _process_start_sample;
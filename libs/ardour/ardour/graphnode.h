@@ -54,17 +54,17 @@ public:
 	GraphActivision ();
 	virtual ~GraphActivision () {}
 
-	typedef std::map<GraphChain const*, node_set_t> ActivationMap;
-	typedef std::map<GraphChain const*, int>        RefCntMap;
+	typedef std::map<GraphChain const*, node_list_t> ActivationMap;
+	typedef std::map<GraphChain const*, int>         RefCntMap;
 
-	node_set_t const& activation_set (GraphChain const* const g) const;
-	int               init_refcount (GraphChain const* const g) const;
-	void              flush_graph_activision_rcu ();
+	node_list_t const& activation_set (GraphChain const* const g) const;
+	int                init_refcount (GraphChain const* const g) const;
+	void               flush_graph_activision_rcu ();
 
 protected:
 	friend struct GraphChain;
 
-	/** Nodes that we directly feed */
+	/** Nodes that we directly feed (see GraphChain::TriggerOrder for the order) */
 	SerializedRCUManager<ActivationMap> _activation_set;
 	/** The number of nodes that we directly feed us (one count for each chain) */
 	SerializedRCUManager<RefCntMap> _init_refcount;
@@ -85,6 +85,12 @@ public:
 
 	virtual bool direct_feeds_according_to_reality (std::shared_ptr<GraphNode>, bool* via_send_only = 0) = 0;
 
+	/** @return moving average of the time spent in process() in usec */
+	float cost_estimate () const { return _cost_estimate.load (std::memory_order_relaxed); }
+
+	/** Add a measurement of the time spent in process() to the moving average */
+	void update_cost_estimate (float usec);
+
 protected:
 	void trigger ();
 	virtual void process () = 0;
@@ -94,7 +100,8 @@ protected:
 private:
 	void finish (GraphChain const*);
 
-	std::atomic<int> _refcount;
+	std::atomic<int>   _refcount;
+	std::atomic<float> _cost_estimate;
 };
 
 } // namespace ARDOUR
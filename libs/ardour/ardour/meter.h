@@ -82,6 +82,12 @@ public:
 
 	float meter_level (uint32_t n, MeterType type);
 
+	/** Like meter_level(), but without the dB conversion, for
+	 * MeterMaxPeak and the K, IEC and VU meter types.
+	 * Other types are converted from their dB value.
+	 */
+	float meter_coefficient (uint32_t n, MeterType type);
+
 	void      set_meter_type (MeterType t);
 	MeterType meter_type () const { return _meter_type; }
 
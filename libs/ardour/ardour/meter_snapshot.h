@@ -0,0 +1,103 @@
+/*
+ * Copyright (C) 2026 Ardour Developers
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "pbd/id.h"
+
+#include "ardour/libardour_visibility.h"
+#include "ardour/types.h"
+
+namespace ARDOUR {
+
+class PeakMeter;
+
+/** Meter levels of all routes at the end of one process cycle.
+ *
+ * The Session fills this once per cycle (see Session::meter_snapshot),
+ * so that the GUI and control surfaces can copy all meters at once
+ * instead of querying each route's PeakMeter.
+ *
+ * Data is kept as struct-of-arrays. Per-route values are indexed by
+ * route (0 .. n_routes - 1), per-channel values of route @a r are at
+ * first_channel[r] .. first_channel[r] + n_channels[r] - 1, MIDI
+ * channels first, as with PeakMeter::meter_level(). Like there, the
+ * peak of a MIDI channel is note activity in the range 0 .. 1, not dB.
+ *
+ * To keep the realtime writer cheap, values that PeakMeter holds as
+ * gain coefficients are published as such; use max_peak_db() and
+ * level_db() to convert them.
+ *
+ * Capacity is fixed at construction, add() does not allocate.
+ */
+struct LIBARDOUR_API MeterSnapshot
+{
+	MeterSnapshot ();
+	MeterSnapshot (uint32_t max_routes, uint32_t max_channels);
+
+	uint32_t max_routes () const { return route_id.size (); }
+	uint32_t max_channels () const { return peak.size (); }
+
+	/** Linear search, to look up many routes build a map from route_id.
+	 * @return index of the route with the given ID, or -1
+	 */
+	int route_index (PBD::ID const&) const;
+
+	/** Drop all routes (realtime safe) */
+	void clear (samplepos_t when);
+
+	/** Append the levels of a route's meter (realtime safe)
+	 * @return false if there is no more room for it
+	 */
+	bool add (PBD::ID const&, PeakMeter&);
+
+	/** @param c index into the per-channel arrays
+	 * @return max_peak in dBFS
+	 */
+	float max_peak_db (uint32_t c) const;
+
+	/** @param r route index
+	 * @param c index into the per-channel arrays, of a channel of route @a r
+	 * @return level in dB for the route's meter type, peak for types
+	 * without a level and for MIDI channels
+	 */
+	float level_db (uint32_t r, uint32_t c) const;
+
+	samplepos_t sample;        ///< transport position of the cycle
+	uint32_t    n_routes;      ///< number of valid per-route entries
+	uint32_t    channels_used; ///< number of valid per-channel entries
+
+	/* per route */
+	std::vector<PBD::ID>   route_id;
+	std::vector<MeterType> meter_type;    ///< the meter's configured type
+	std::vector<uint32_t>  first_channel;
+	std::vector<uint32_t>  n_channels;
+	std::vector<uint32_t>  n_midi;
+	std::vector<float>     mcp;           ///< MeterMCP, max. of all audio channels in dBFS
+
+	/* per channel */
+	std::vector<float> peak;     ///< MeterPeak in dBFS, 0 .. 1 for MIDI
+	std::vector<float> max_peak; ///< MeterMaxPeak since the last reset, gain coefficient
+	std::vector<float> level;    ///< level for the meter's configured K, IEC or VU type, gain coefficient
+};
+
+} // namespace ARDOUR
@@ -39,6 +39,7 @@
 
 #include <glib.h>
 
+#include "pbd/mutex.h"
 #include "pbd/rwlock.h"
 #include "pbd/sequence_property.h"
 #include "pbd/stateful.h"
@@ -303,6 +304,11 @@ public:
 	void start_domain_bounce (Temporal::DomainBounceInfo&);
 	void finish_domain_bounce (Temporal::DomainBounceInfo&);
 
+	/** Enable or disable the use of an index for region queries of large
+	 *  playlists (enabled by default; intended for testing and profiling).
+	 */
+	static void set_region_index_enabled (bool yn) { _region_index_enabled.store (yn); }
+
 protected:
 	friend class Session;
 
@@ -325,6 +331,7 @@ protected:
 		    , playlist (pl)
 		    , block_notify (do_block_notify)
 		{
+			playlist->block_region_index ();
 			if (block_notify) {
 				playlist->delay_notifications ();
 			}
@@ -332,6 +339,7 @@ protected:
 
 		~RegionWriteLock ()
 		{
+			playlist->unblock_region_index ();
 			PBD::RWLock::WriterLock::release ();
 			thawlist.release ();
 			if (block_notify) {
@@ -401,6 +409,9 @@ protected:
 
 	void _set_sort_id ();
 
+	/** @return a counter that changes whenever regions are added, removed or moved */
+	uint64_t regions_serial () const { return _region_index_serial.load (); }
+
 	std::shared_ptr<RegionList> regions_touched_locked (timepos_t const & start, timepos_t const & end, bool with_tail);
 
 	bool region_is_audible_at_locked (std::shared_ptr<Region>, timepos_t const&);
@@ -476,6 +487,52 @@ private:
 	std::shared_ptr<RegionList> find_regions_at (timepos_t const &);
 
 	mutable std::optional<std::pair<timepos_t, timepos_t> > _cached_extent;
+
+	/** Index of the region list, sorted by position, with the running
+	 *  maximum of the regions' last positions. This allows to find the
+	 *  regions overlapping a given range by bisection, rather than by
+	 *  looking at each region of the playlist.
+	 *
+	 *  The index is built lazily by the first query that needs it (under the
+	 *  region read-lock), and dropped whenever the region write-lock is taken
+	 *  or a region's bounds change.
+	 */
+	struct RegionIndex {
+		struct Entry {
+			Entry (std::shared_ptr<Region> const& r, timepos_t const& s, timepos_t const& m)
+				: region (r), start (s), max_last (m) {}
+
+			std::shared_ptr<Region> region;
+			timepos_t               start;    /* region position */
+			timepos_t               max_last; /* max nt_last() of this and all previous entries */
+		};
+
+		typedef std::vector<Entry>::const_iterator const_iterator;
+
+		/* return the (contiguous) range of entries which may overlap [s, e],
+		 * in region list order. Callers still need to check each region.
+		 */
+		std::pair<const_iterator, const_iterator> candidates (timepos_t const& s, timepos_t const& e) const;
+
+		std::vector<Entry> entries;
+		uint64_t           serial;
+		bool               usable;
+		bool               has_region_fx; /* regions may have a tail */
+	};
+
+	std::shared_ptr<RegionIndex const> region_index () const;
+
+	void invalidate_region_index () { _region_index_serial.fetch_add (1); }
+	void block_region_index ();
+	void unblock_region_index ();
+
+	mutable PBD::Mutex                         _region_index_lock;
+	mutable std::shared_ptr<RegionIndex const> _region_index;
+	std::atomic<uint64_t>                      _region_index_serial;
+	std::atomic<int>                           _region_index_blocked;
+
+	static std::atomic<bool> _region_index_enabled;
+
 	timepos_t _end_space;  //this is used when we are pasting a range with extra space at the end
 	bool _playlist_shift_active;
 
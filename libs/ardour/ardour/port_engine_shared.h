@@ -95,6 +95,11 @@ class LIBARDOUR_API BackendPort : public ProtoPort
 
 	virtual void* get_buffer (pframes_t nframes) = 0;
 
+	/** Data written to an audio output port during the current cycle,
+	 * used by connected input ports to collect their input.
+	 */
+	virtual const Sample* const_audio_buffer () const { return 0; }
+
 	const LatencyRange latency_range (bool for_playback) const
 	{
 		return for_playback ? _playback_latency_range : _capture_latency_range;
@@ -107,6 +112,28 @@ class LIBARDOUR_API BackendPort : public ProtoPort
 protected:
 	PortEngineSharedImpl& _backend;
 
+	/** Sources of an audio input port, rebuilt when connections change,
+	 * so that the process thread does not need to iterate over and cast
+	 * connections every cycle.
+	 */
+	struct MixPlan {
+		std::vector<BackendPortPtr> ports;
+		std::vector<const Sample*>  buffers;
+	};
+
+	std::shared_ptr<MixPlan const> mix_plan () const {
+		return _mix_plan.reader ();
+	}
+
+	/** Collect the input of an audio port by summing the data of all
+	 * connected ports (RT safe).
+	 *
+	 * @param buf buffer to use when more than one port is connected
+	 * @return buffer holding the data, may be the buffer of the only
+	 * connected port, which must not be modified.
+	 */
+	void* mix_connections (Sample* buf, pframes_t n_samples) const;
+
 private:
 	std::string            _name;
 	std::string            _pretty_name;
@@ -116,8 +143,11 @@ private:
 	LatencyRange           _playback_latency_range;
 	std::set<BackendPortPtr> _connections;
 
+	SerializedRCUManager<MixPlan> _mix_plan;
+
 	void store_connection (BackendPortHandle);
 	void remove_connection (BackendPortHandle);
+	void update_mix_plan ();
 
 }; // class BackendPort
 
@@ -30,6 +30,11 @@ namespace ARDOUR {
 	typedef void  (*mix_buffers_with_gain_t) (ARDOUR::Sample *, const ARDOUR::Sample *, pframes_t, float);
 	typedef void  (*mix_buffers_no_gain_t)   (ARDOUR::Sample *, const ARDOUR::Sample *, pframes_t);
 	typedef void  (*copy_vector_t)           (ARDOUR::Sample *, const ARDOUR::Sample *, pframes_t);
+	typedef void  (*fill_ramp_t)             (ARDOUR::Sample *, pframes_t, float, float);
+	typedef void  (*apply_gain_vector_t)     (ARDOUR::Sample *, const ARDOUR::gain_t *, pframes_t);
+	typedef void  (*mix_buffers_with_gain_vector_t) (ARDOUR::Sample *, const ARDOUR::Sample *, const ARDOUR::gain_t *, pframes_t);
+	typedef void  (*interleave_t)            (ARDOUR::Sample *, const ARDOUR::Sample *, uint32_t, pframes_t);
+	typedef void  (*deinterleave_t)          (ARDOUR::Sample *, const ARDOUR::Sample *, uint32_t, pframes_t);
 
 	LIBARDOUR_API extern compute_peak_t          compute_peak;
 	LIBARDOUR_API extern find_peaks_t            find_peaks;
@@ -37,5 +42,10 @@ namespace ARDOUR {
 	LIBARDOUR_API extern mix_buffers_with_gain_t mix_buffers_with_gain;
 	LIBARDOUR_API extern mix_buffers_no_gain_t   mix_buffers_no_gain;
 	LIBARDOUR_API extern copy_vector_t           copy_vector;
+	LIBARDOUR_API extern fill_ramp_t             fill_ramp;
+	LIBARDOUR_API extern apply_gain_vector_t     apply_gain_vector;
+	LIBARDOUR_API extern mix_buffers_with_gain_vector_t mix_buffers_with_gain_vector;
+	LIBARDOUR_API extern interleave_t            interleave;
+	LIBARDOUR_API extern deinterleave_t          deinterleave;
 }
 
@@ -59,8 +59,10 @@
 #include "pbd/rcu.h"
 #include "pbd/rwlock.h"
 #include "pbd/statefuldestructible.h"
+#include "pbd/triple_buffer.h"
 #include "pbd/signals.h"
 #include "pbd/undo.h"
+#include "pbd/undo_journal.h"
 #include "pbd/uuid.h"
 
 #ifdef USE_TLSF
@@ -84,6 +86,7 @@
 #include "ardour/interthread_info.h"
 #include "ardour/luascripting.h"
 #include "ardour/location.h"
+#include "ardour/meter_snapshot.h"
 #include "ardour/monitor_processor.h"
 #include "ardour/presentation_info.h"
 #include "ardour/rc_configuration.h"
@@ -113,6 +116,7 @@ namespace PBD {
 class Controllable;
 class Progress;
 class Command;
+class Thread;
 }
 
 namespace luabridge {
@@ -144,6 +148,7 @@ class Bundle;
 class Butler;
 class Click;
 class CoreSelection;
+class DSPTrace;
 class ExportHandler;
 class ExportStatus;
 class Graph;
@@ -315,6 +320,17 @@ public:
 
 	void ensure_buffers_unlocked (ChanCount howmany);
 
+	/** Copy the meter levels of all routes, as of the end of the most
+	 * recent process cycle. Lock-free; may be called from any thread
+	 * but the process thread.
+	 *
+	 * Snapshots are only published while they are being read, the
+	 * first call(s) may return false until the next cycle has completed.
+	 *
+	 * @return true if @a snapshot was filled in
+	 */
+	bool meter_snapshot (MeterSnapshot& snapshot);
+
 	bool have_rec_enabled_track () const;
 	bool have_rec_disabled_track () const;
 
@@ -364,6 +380,8 @@ public:
 
 	bool plot_process_graph (std::string const& file_name) const;
 
+	std::shared_ptr<DSPTrace> dsp_trace () const { return _dsp_trace; }
+
 	std::shared_ptr<BundleList const> bundles () {
 		return _bundles.reader ();
 	}
@@ -1155,6 +1173,8 @@ public:
 	PBD::Command* stateful_diff_command_factory (XMLNode *);
 	void register_with_memento_command_factory(PBD::ID, PBD::StatefulDestructible*);
 
+	PBD::UndoTransaction* undo_transaction_from_state (XMLNode const&);
+
 	/* clicking */
 
 	std::shared_ptr<IO> click_io() { return _click_io; }
@@ -1647,6 +1667,22 @@ private:
 	PBD::Mutex save_source_lock;
 	PBD::Mutex peak_cleanup_lock;
 
+	/* pending (backup) state is written in the background */
+	PBD::Thread* _state_writer;
+	void wait_for_state_writer ();
+	int  write_state_file (XMLTree&, std::string const& tmp_path, std::string const& xml_path);
+	void write_pending_state (XMLTree*, std::string tmp_path, std::string xml_path);
+	void backup_pending_state (std::string const& xml_path);
+
+	/* true while state () is called by save_state () */
+	bool _saving_state;
+
+	/* undo history is saved incrementally, see save_history() */
+	PBD::UndoJournal _history_journal;
+
+	/* time spent per section of the session state during the last save */
+	mutable std::vector<std::pair<std::string, int64_t> > _save_timing;
+
 	int        load_options (const XMLNode&);
 	int        load_state (std::string snapshot_name, bool from_template = false);
 	static int parse_stateful_loading_version (const std::string&);
@@ -1974,6 +2010,17 @@ private:
 
 	SerializedRCUManager<RouteList>  routes;
 
+	/* meter levels of all routes, published by the process thread */
+	typedef PBD::TripleBuffer<MeterSnapshot>     MeterSnapshotBuffer;
+	typedef std::shared_ptr<MeterSnapshotBuffer> MeterSnapshotBufferPtr;
+
+	SerializedRCUManager<MeterSnapshotBufferPtr> _meter_snapshot;
+	std::atomic<int>                             _meter_snapshot_resize;
+	std::atomic<int64_t>                         _meter_snapshot_read;
+
+	void publish_meter_snapshot ();
+	void resize_meter_snapshot ();
+
 	void add_routes_inner (RouteList&, bool input_auto_connect, bool output_auto_connect, PresentationInfo::order_t);
 	bool _adding_routes_in_progress;
 	bool _reconnecting_routes_in_progress;
@@ -2352,6 +2399,17 @@ private:
 	std::shared_ptr<GraphChain> _graph_chain;
 	std::shared_ptr<GraphChain> _io_graph_chain[2];
 
+	/* held by non-realtime threads while replacing or copying the chains,
+	 * the process thread relies on rechain being done with processing blocked */
+	PBD::Mutex _graph_chain_lock;
+
+	/* the chains are periodically re-sorted by the nodes' cost estimates */
+	samplecnt_t      _graph_resort_samples;
+	std::atomic<int> _graph_resort_pending;
+
+	void maybe_resort_process_graph (pframes_t);
+	void resort_process_graph ();
+
 	void resort_routes_using (std::shared_ptr<RouteList>);
 	void resort_io_plugs ();
 
@@ -2369,6 +2427,7 @@ private:
 	std::shared_ptr<Port>  _ltc_output_port;
 
 	std::shared_ptr<RTTaskList> _rt_tasklist;
+	std::shared_ptr<DSPTrace>   _dsp_trace;
 	std::shared_ptr<IOTaskList> _io_tasklist;
 
 	/* Scene Changing */
@@ -24,6 +24,9 @@
 
 #pragma once
 
+#include <atomic>
+#include <memory>
+
 #include <sndfile.h>
 
 #include "ardour/audiofilesource.h"
@@ -76,6 +79,15 @@ class LIBARDOUR_API SndFileSource : public AudioFileSource {
 
 	static int get_soundfile_info (const std::string& path, SoundFileInfo& _info, std::string& error_msg);
 
+	/* Sources of the same multichannel file share a cache of the
+	 * interleaved blocks that were most recently read from disk, so
+	 * that reading all channels of a given range only accesses the
+	 * file once.
+	 */
+	static void set_read_cache_enabled (bool yn) { _read_cache_enabled = yn; }
+	static void read_cache_stats (uint64_t& hits, uint64_t& misses);
+	static void reset_read_cache_stats ();
+
   protected:
 	void close ();
 
@@ -99,6 +111,17 @@ class LIBARDOUR_API SndFileSource : public AudioFileSource {
 	void set_natural_position (timepos_t const &);
 	samplecnt_t nondestructive_write_unlocked (Sample const *src, samplecnt_t cnt);
 	PBD::ScopedConnection header_position_connection;
+
+	struct ReadCache;
+	std::shared_ptr<ReadCache> _read_cache;
+
+	samplecnt_t read_cached (Sample* dst, samplepos_t start, samplecnt_t cnt) const;
+
+	static std::shared_ptr<ReadCache> read_cache_for (std::string const& path);
+
+	static std::atomic<bool>     _read_cache_enabled;
+	static std::atomic<uint64_t> _read_cache_hits;
+	static std::atomic<uint64_t> _read_cache_misses;
 };
 
 } // namespace ARDOUR
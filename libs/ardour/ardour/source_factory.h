@@ -19,6 +19,8 @@
 
 #pragma once
 
+#include <functional>
+#include <list>
 #include <memory>
 #include <stdint.h>
 #include <string>
@@ -58,9 +60,24 @@ public:
 	static std::vector<PBD::Thread*> peak_thread_pool;
 
 	static std::list<std::weak_ptr<AudioSource>> files_with_peaks;
+	static std::list<std::function<void ()>>      peak_tasks;
 
 	static int peak_work_queue_length ();
 	static int setup_peakfile (std::shared_ptr<Source>, bool async);
+
+	/** Queue work for the peak-building threads, e.g. computing the
+	 *  peaks of a part of a long file. Tasks are run before any further
+	 *  files are started.
+	 */
+	static void queue_peak_task (std::function<void ()>);
+
+	/** Run one of the queued peak tasks in the calling thread, used to
+	 *  help while waiting for tasks to complete.
+	 *  @return false if there were no tasks
+	 */
+	static bool run_peak_task ();
+
+	static size_t n_peak_threads () { return peak_thread_pool.size (); }
 };
 
 } // namespace ARDOUR
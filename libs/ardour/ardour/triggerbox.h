@@ -29,6 +29,7 @@
 #include "pbd/crossthread.h"
 #include "pbd/mutex.h"
 #include "pbd/pcg_rand.h"
+#include "pbd/playback_buffer.h"
 #include "pbd/pool.h"
 #include "pbd/properties.h"
 #include "pbd/ringbuffer.h"
@@ -292,6 +293,9 @@ class LIBARDOUR_API Trigger : public PBD::Stateful {
 	virtual void io_change () {}
 	virtual void set_legato_offset (timepos_t const & offset) = 0;
 
+	/** @return size of audio data held in memory by this trigger, in bytes */
+	virtual size_t memory_footprint () const { return 0; }
+
 	timepos_t current_pos() const;
 	double position_as_fraction() const;
 
@@ -571,20 +575,61 @@ class LIBARDOUR_API AudioTrigger : public Trigger {
 
 	RubberBand::RubberBandStretcher* alloc_stretcher () const;
 
+	/** Ringbuffers holding the part of a streamed clip beyond the data
+	 * that is kept in memory. The butler refills them while the trigger
+	 * plays, much like a DiskReader's playback buffers.
+	 */
+	struct LIBARDOUR_API ClipStream {
+		ClipStream (std::shared_ptr<AudioRegion>, samplecnt_t length, samplepos_t start, samplecnt_t bufsize);
+		~ClipStream ();
+
+		/* butler thread */
+		int refill ();
+
+		/* process thread */
+		samplecnt_t read (Sample** dst, samplepos_t pos, samplecnt_t cnt);
+		void seek (samplepos_t pos);
+		bool need_butler () const;
+
+		/** true if the butler has completed the most recent seek */
+		bool ready () const { return ready_gen.load () == seek_gen.load (); }
+
+		size_t memory_footprint () const;
+
+		std::shared_ptr<AudioRegion>              region;
+		samplecnt_t                               length;    ///< total length of the clip
+		std::vector<PBD::PlaybackBuffer<Sample>*> rb;
+		std::vector<Sample>                       read_buf;  ///< butler only
+		std::vector<Sample*>                      rt_buf;    ///< process thread only
+		std::vector<Sample>                       silence;
+		samplepos_t                               fill_pos;  ///< next sample to read from disk (butler)
+		std::atomic<samplepos_t>                  read_pos;  ///< sample at the ringbuffers' read-pointer
+		std::atomic<samplepos_t>                  seek_pos;  ///< position of the most recent seek request
+		std::atomic<uint32_t>                     seek_gen;  ///< incremented by each seek request
+		std::atomic<uint32_t>                     ready_gen; ///< seek_gen of the last seek completed by the butler
+		std::atomic<bool>                         eof;
+		uint32_t                                  underruns;
+	};
+
 	struct AudioData : std::vector<Sample*> {
-		samplecnt_t length;
+		samplecnt_t length;   ///< total length of the clip
 		samplecnt_t capacity;
+		samplecnt_t resident; ///< samples held in memory, equal to length unless streaming
+		std::shared_ptr<ClipStream> stream;
 
-		AudioData () : length (0), capacity (0) {}
+		AudioData () : length (0), capacity (0), resident (0) {}
 		~AudioData ();
 		AudioData& operator= (AudioData& other); /* really move semantics */
 
 		samplecnt_t append (Sample const * src, samplecnt_t cnt, uint32_t chan);
 		void alloc (samplecnt_t cnt, uint32_t nchans);
-		void reset () { length = 0; }
+		void reset () { length = 0; resident = 0; stream.reset (); }
 		void drop ();
 	};
 
+	size_t memory_footprint () const;
+	bool   streaming () const { return (bool) data.stream; }
+
 
 	Sample const * audio_data (size_t n) const;
 	size_t data_length() const { return data.length; }
@@ -621,6 +666,7 @@ class LIBARDOUR_API AudioTrigger : public Trigger {
 
 	void drop_data (AudioData&);
 	int load_data (std::shared_ptr<AudioRegion>, AudioData&);
+	samplecnt_t fetch (Sample const** dst, samplepos_t pos, samplecnt_t cnt, bool in_process_context);
 	void estimate_tempo ();
 	void reset_stretcher ();
 	void _startup (BufferSet&, pframes_t dest_offset, Temporal::BBT_Offset const &);
@@ -884,6 +930,15 @@ class LIBARDOUR_API TriggerBox : public Processor, public std::enable_shared_fro
 
 	TriggerPtr trigger (Triggers::size_type);
 
+	/* disk-streamed audio clips */
+	void add_clip_stream (std::shared_ptr<AudioTrigger::ClipStream>);
+	void request_refill () { _need_refill.store (true); }
+	bool need_butler () const { return _need_refill.load (); }
+	int  do_refill ();
+
+	/** @return size of audio data held in memory by all triggers, in bytes */
+	size_t memory_footprint () const;
+
 	void bang_trigger_at (Triggers::size_type row, float velocity = 1.0f);
 	void unbang_trigger_at (Triggers::size_type row);
 
@@ -1015,6 +1070,10 @@ class LIBARDOUR_API TriggerBox : public Processor, public std::enable_shared_fro
 	mutable PBD::RWLock trigger_lock; /* protects all_triggers */
 	Triggers all_triggers;
 
+	PBD::Mutex                                            _streams_lock; /* protects _streams */
+	std::vector<std::shared_ptr<AudioTrigger::ClipStream>> _streams;
+	std::atomic<bool>                                     _need_refill;
+
 	typedef std::vector<Trigger*> PendingTriggers;
 	PendingTriggers pending;
 
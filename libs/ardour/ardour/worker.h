@@ -20,8 +20,12 @@
 
 #pragma once
 
+#include <atomic>
 #include <stdint.h>
+#include <vector>
 
+#include "pbd/mpmc_queue.h"
+#include "pbd/mutex.h"
 #include "pbd/pthread_utils.h"
 #include "pbd/ringbuffer.h"
 #include "pbd/semutils.h"
@@ -31,6 +35,7 @@
 namespace ARDOUR {
 
 class Worker;
+class WorkerPool;
 
 /**
    An object that needs to schedule non-RT work in the audio thread.
@@ -56,6 +61,9 @@ public:
    A worker may be a separate thread that runs to execute scheduled work
    asynchronously, or unthreaded, in which case work is executed immediately
    upon scheduling by the calling thread.
+
+   If a WorkerPool is in use, threaded workers do not run a thread of their
+   own, but the work is executed by one of the pool's threads.
 */
 class LIBARDOUR_API Worker
 {
@@ -91,7 +99,16 @@ public:
 	void set_synchronous(bool synchronous) { _synchronous = synchronous; }
 
 private:
+	friend class WorkerPool;
+
 	void run();
+
+	/**
+	   Execute all complete requests (worker thread, or pool thread with
+	   _pool_lock held).
+	*/
+	void process_requests();
+
 	/**
 	   Peek in RB, get size and check if a block of 'size' is available.
 
@@ -109,8 +126,75 @@ private:
 	uint8_t*                  _response;
 	PBD::Semaphore            _sem;
 	PBD::Thread*              _thread;
-	bool                      _exit;
+	std::atomic<bool>         _exit;
 	bool                      _synchronous;
+	void*                     _work_buf;
+	size_t                    _work_buf_size;
+
+	/* WorkerPool dispatch */
+	WorkerPool*               _pool;
+	PBD::Mutex                _pool_lock;
+	PBD::Cond                 _released; ///< signalled when _queued is cleared
+	std::atomic<bool>         _queued;
+	std::atomic<int64_t>      _queued_at;
+};
+
+/**
+   A bounded set of threads, shared by all threaded Workers.
+
+   Instead of each plugin instance running a (mostly idle) thread, workers
+   queue themselves on the pool when work is scheduled. A worker is queued at
+   most once, and processed by one pool thread at a time, so requests of a
+   given worker are executed in the order in which they were scheduled.
+
+   The pool is used if RCConfiguration::lv2_worker_pool_threads is > 0 when
+   the first worker is created.
+*/
+class LIBARDOUR_API WorkerPool
+{
+public:
+	/** @return the pool, or NULL if workers use a thread each */
+	static WorkerPool* instance ();
+	static void terminate ();
+
+	struct Stats {
+		uint32_t n_threads;
+		uint32_t n_workers;
+		uint32_t queue_depth;     ///< workers currently waiting to be processed
+		uint32_t max_queue_depth;
+		uint64_t n_dispatched;    ///< number of times a worker was processed
+		int64_t  avg_latency;     ///< time from scheduling until work starts [usec]
+		int64_t  max_latency;     ///< [usec]
+	};
+
+	Stats stats () const;
+	void  reset_stats ();
+
+private:
+	friend class Worker;
+
+	WorkerPool (uint32_t n_threads);
+	~WorkerPool ();
+
+	bool add (Worker*);
+	void remove (Worker*);
+	void schedule (Worker*);
+	void run ();
+
+	PBD::MPMCQueue<Worker*>    _queue;
+	PBD::Semaphore             _sem;
+	std::vector<PBD::Thread*>  _threads;
+	std::atomic<bool>          _exit;
+	std::atomic<uint32_t>      _n_workers;
+
+	std::atomic<uint32_t>      _queue_depth;
+	std::atomic<uint32_t>      _max_queue_depth;
+	std::atomic<uint64_t>      _n_dispatched;
+	std::atomic<int64_t>       _total_latency;
+	std::atomic<int64_t>       _max_latency;
+
+	static WorkerPool*         _instance;
+	static PBD::Mutex          _instance_lock;
 };
 
 } // namespace ARDOUR
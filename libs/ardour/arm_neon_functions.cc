@@ -515,4 +515,110 @@ arm_neon_copy_vector(
 	}
 }
 
+
+C_FUNC void
+arm_neon_fill_ramp(float *dst, uint32_t nframes, float start, float step)
+{
+	const float idx[4] = { 0.f, 1.f, 2.f, 3.f };
+
+	float32x4_t vstart = vdupq_n_f32(start);
+	float32x4_t vstep  = vdupq_n_f32(step);
+	float32x4_t vidx0  = vld1q_f32(idx);
+	float32x4_t vidx1  = vaddq_f32(vidx0, vdupq_n_f32(4.f));
+	float32x4_t vinc   = vdupq_n_f32(8.f);
+
+	uint32_t i = 0;
+
+	for (; i + 8 <= nframes; i += 8) {
+		vst1q_f32(dst + i + 0, vmlaq_f32(vstart, vidx0, vstep));
+		vst1q_f32(dst + i + 4, vmlaq_f32(vstart, vidx1, vstep));
+		vidx0 = vaddq_f32(vidx0, vinc);
+		vidx1 = vaddq_f32(vidx1, vinc);
+	}
+
+	if (i + 4 <= nframes) {
+		vst1q_f32(dst + i, vmlaq_f32(vstart, vidx0, vstep));
+		i += 4;
+	}
+
+	// Do the remaining samples
+	for (; i < nframes; ++i) {
+		dst[i] = start + i * step;
+	}
+}
+
+
+C_FUNC void
+arm_neon_apply_gain_vector(float *dst, const float *gain, uint32_t nframes)
+{
+	uint32_t i = 0;
+
+	for (; i + 8 <= nframes; i += 8) {
+		vst1q_f32(dst + i + 0, vmulq_f32(vld1q_f32(dst + i + 0), vld1q_f32(gain + i + 0)));
+		vst1q_f32(dst + i + 4, vmulq_f32(vld1q_f32(dst + i + 4), vld1q_f32(gain + i + 4)));
+	}
+
+	// Do the remaining samples
+	for (; i < nframes; ++i) {
+		dst[i] *= gain[i];
+	}
+}
+
+
+C_FUNC void
+arm_neon_mix_buffers_with_gain_vector(float *dst, const float *src, const float *gain, uint32_t nframes)
+{
+	uint32_t i = 0;
+
+	for (; i + 8 <= nframes; i += 8) {
+		vst1q_f32(dst + i + 0, vmlaq_f32(vld1q_f32(dst + i + 0), vld1q_f32(src + i + 0), vld1q_f32(gain + i + 0)));
+		vst1q_f32(dst + i + 4, vmlaq_f32(vld1q_f32(dst + i + 4), vld1q_f32(src + i + 4), vld1q_f32(gain + i + 4)));
+	}
+
+	// Do the remaining samples
+	for (; i < nframes; ++i) {
+		dst[i] += src[i] * gain[i];
+	}
+}
+
+
+C_FUNC void
+arm_neon_interleave(float *dst, const float *src, uint32_t stride, uint32_t nframes)
+{
+	uint32_t i = 0;
+
+	if (stride == 2) {
+		// keep the other channel's samples
+		for (; i + 4 <= nframes; i += 4) {
+			float32x4x2_t d = vld2q_f32(dst + 2 * i);
+			d.val[0] = vld1q_f32(src + i);
+			vst2q_f32(dst + 2 * i, d);
+		}
+	}
+
+	// Do the remaining samples
+	for (; i < nframes; ++i) {
+		dst[i * stride] = src[i];
+	}
+}
+
+
+C_FUNC void
+arm_neon_deinterleave(float *dst, const float *src, uint32_t stride, uint32_t nframes)
+{
+	uint32_t i = 0;
+
+	if (stride == 2) {
+		for (; i + 4 <= nframes; i += 4) {
+			float32x4x2_t s = vld2q_f32(src + 2 * i);
+			vst1q_f32(dst + i, s.val[0]);
+		}
+	}
+
+	// Do the remaining samples
+	for (; i < nframes; ++i) {
+		dst[i] = src[i * stride];
+	}
+}
+
 #endif
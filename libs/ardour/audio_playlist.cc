@@ -44,7 +44,9 @@ using namespace PBD;
 
 AudioPlaylist::AudioPlaylist (Session& session, const XMLNode& node, bool hidden)
 	: Playlist (session, node, DataType::AUDIO, hidden)
+	, _render_plan_serial (0)
 {
+	ContentsChanged.connect_same_thread (*this, std::bind (&AudioPlaylist::drop_render_plan, this));
 #ifndef NDEBUG
 	XMLProperty const * prop = node.property("type");
 	assert(!prop || DataType(prop->value()) == DataType::AUDIO);
@@ -63,17 +65,23 @@ AudioPlaylist::AudioPlaylist (Session& session, const XMLNode& node, bool hidden
 
 AudioPlaylist::AudioPlaylist (Session& session, string name, bool hidden)
 	: Playlist (session, name, DataType::AUDIO, hidden)
+	, _render_plan_serial (0)
 {
+	ContentsChanged.connect_same_thread (*this, std::bind (&AudioPlaylist::drop_render_plan, this));
 }
 
 AudioPlaylist::AudioPlaylist (std::shared_ptr<const AudioPlaylist> other, string name, bool hidden)
 	: Playlist (other, name, hidden)
+	, _render_plan_serial (0)
 {
+	ContentsChanged.connect_same_thread (*this, std::bind (&AudioPlaylist::drop_render_plan, this));
 }
 
 AudioPlaylist::AudioPlaylist (std::shared_ptr<const AudioPlaylist> other, timepos_t const & start, timepos_t const & cnt, string name, bool hidden)
 	: Playlist (other, start, cnt, name, hidden)
+	, _render_plan_serial (0)
 {
+	ContentsChanged.connect_same_thread (*this, std::bind (&AudioPlaylist::drop_render_plan, this));
 	RegionReadLock rlock2 (const_cast<AudioPlaylist*> (other.get()));
 	in_set_state++;
 
@@ -169,6 +177,18 @@ struct Segment {
 	Temporal::Range range;       ///< range of the region to read, in session samples
 };
 
+struct AudioPlaylist::RenderPlan {
+	RenderPlan (timepos_t const & s, timepos_t const & e) : range (s, e), serial (0), cacheable (true) {}
+
+	Temporal::Range    range;     ///< range of the playlist covered by this plan
+	std::list<Segment> segments;  ///< in the order in which they are to be read
+	uint64_t           serial;
+	bool               cacheable;
+};
+
+/** Number of reads (of the same size) that a cached render plan covers */
+static const int render_plan_reads = 8;
+
 /** @param start Start position in session samples.
  *  @param cnt Number of samples to read.
  */
@@ -208,10 +228,132 @@ AudioPlaylist::read (Sample *buf, Sample *mixdown_buffer, float *gain_buffer, ti
 
 	Playlist::RegionReadLock rl (this);
 
+	std::shared_ptr<RenderPlan const> plan = render_plan (start, cnt);
+
+	timepos_t const end = start + cnt;
+
+	/* Go through the plan doing the actual reads, restricted to the range we are reading */
+
+	for (auto const & s : plan->segments) {
+
+		if (s.range.start() >= end || s.range.end() <= start) {
+			continue;
+		}
+
+		Temporal::Range range (max (s.range.start(), start), min (s.range.end(), end));
+
+		DEBUG_TRACE (DEBUG::AudioPlayback, string_compose ("\tPlaylist %1 read %2 @ %3 for %4, channel %5, buf @ %6 offset %7\n",
+		                                                   name(), s.region->name(), range.start(),
+		                                                   range.length(), (int) chan_n,
+		                                                   buf, range.start().earlier (start)));
+
+		samplepos_t read_pos (range.start().samples());
+		samplecnt_t read_cnt (range.start().distance (range.end()).samples());
+		samplecnt_t soffset = start.distance (range.start()).samples();
+
+		assert (soffset < scnt);
+
+		if (soffset + read_cnt > scnt) {
+			read_cnt = scnt - soffset;
+		}
+		assert (soffset + read_cnt <= scnt);
+		samplecnt_t nread = s.region->read_at (buf + soffset, mixdown_buffer, gain_buffer, read_pos, read_cnt, chan_n);
+		if (nread != read_cnt) {
+			std::cerr << name() << " tried to read " << read_cnt
+				<< " got " << nread
+				<< " in " << s.region->name()
+				<< " for chn " << chan_n
+				<< " to offset " << soffset
+				<< " using range " << range.start().samples() << " .. " << range.end().samples()
+				<< " len " << range.length().samples() << std::endl;
+#ifndef NDEBUG
+			/* forward error to DiskReader::audio_read. This does 2 things:
+			 *  - error "DiskReader %1: when refilling, cannot read ..."
+			 *  - emit Underrun() - "Disk is too slow"
+			 * (ideally only the first would happen)
+			 * Since the buffer is zero'ed above, failed reads are not an issue.
+			 */
+			return timecnt_t (0);
+#endif
+		}
+	}
+
+	return cnt;
+}
+
+/** @return the plan to read [start, start + cnt). Caller must hold the region read-lock.
+ *
+ *  Since the playlist rarely changes between reads, the plan is computed for a
+ *  range a few times larger than the one requested, and re-used by subsequent
+ *  reads of this range until a region is added, removed or modified.
+ */
+std::shared_ptr<AudioPlaylist::RenderPlan const>
+AudioPlaylist::render_plan (timepos_t const & start, timecnt_t const & cnt)
+{
+	timepos_t const end = start + cnt;
+
+	/* which regions are read depends on the session's solo-selection */
+	const bool solo_selection = _session.solo_selection_active() && SoloSelectedActive();
+
+	/* the playlist serial is only changed with the region write-lock held,
+	 * i.e. not while we hold the read-lock; region property changes can
+	 * happen at any time though, hence re-check that after the plan is built.
+	 */
+	uint64_t const serial = _render_plan_serial.load () + regions_serial ();
+
+	std::shared_ptr<RenderPlan const> prev;
+
+	if (!solo_selection) {
+		PBD::Mutex::Lock lm (_render_plan_lock);
+		prev = _render_plan;
+	}
+
+	if (prev && prev->serial == serial && prev->range.start() <= start && end <= prev->range.end()) {
+		return prev;
+	}
+
+	std::shared_ptr<RenderPlan> plan;
+	timecnt_t const             span (cnt.samples () * render_plan_reads);
+
+	if (solo_selection) {
+		plan.reset (new RenderPlan (start, end));
+	} else if (prev && start < prev->range.start()) {
+		/* reading backwards */
+		plan.reset (new RenderPlan (max (timepos_t (), end.earlier (span)), end));
+	} else {
+		plan.reset (new RenderPlan (start, start + span));
+	}
+
+	plan->serial = serial;
+
+	build_render_plan (*plan, solo_selection);
+
+	if (plan->cacheable && !solo_selection && serial == _render_plan_serial.load () + regions_serial ()) {
+		PBD::Mutex::Lock lm (_render_plan_lock);
+		_render_plan = plan;
+	}
+
+	return plan;
+}
+
+void
+AudioPlaylist::drop_render_plan ()
+{
+	/* do not hold on to regions which may have been removed */
+	PBD::Mutex::Lock lm (_render_plan_lock);
+	_render_plan.reset ();
+}
+
+void
+AudioPlaylist::build_render_plan (RenderPlan& plan, bool solo_selection)
+{
+	timepos_t const start = plan.range.start();
+	timepos_t const end   = plan.range.end();
+
 	/* Find all the regions that are involved in the bit we are reading,
 	   and sort them by descending layer and ascending position.
 	*/
-	std::shared_ptr<RegionList> all = regions_touched_locked (start, start + cnt, true);
+	std::shared_ptr<RegionList> all = regions_touched_locked (start, end, true);
 	all->sort (ReadSorter ());
 
 	/* This will be a list of the bits of our read range that we have
@@ -220,10 +362,7 @@ AudioPlaylist::read (Sample *buf, Sample *mixdown_buffer, float *gain_buffer, ti
 	*/
 	Temporal::RangeList done;
 
-	/* This will be a list of the bits of regions that we need to read */
-	list<Segment> to_do;
-
-	/* Now go through the `all' list filling in `to_do' and `done' */
+	/* Now go through the `all' list filling in the plan's segments and `done' */
 	for (RegionList::iterator i = all->begin(); i != all->end(); ++i) {
 		std::shared_ptr<AudioRegion> ar = std::dynamic_pointer_cast<AudioRegion> (*i);
 
@@ -233,17 +372,24 @@ AudioPlaylist::read (Sample *buf, Sample *mixdown_buffer, float *gain_buffer, ti
 		}
 
 		/* check for the case of solo_selection */
-		const bool force_transparent = (_session.solo_selection_active() && SoloSelectedActive() && !SoloSelectedListIncludes( (const Region*) &(**i)));
+		const bool force_transparent = (solo_selection && !SoloSelectedListIncludes( (const Region*) &(**i)));
 		if (force_transparent) {
 			continue;
 		}
 
+		/* the sample position of music-time regions depends on the
+		 * tempo map, which may change without the playlist changing.
+		 */
+		if (ar->position().time_domain() != Temporal::AudioTime || ar->length().time_domain() != Temporal::AudioTime) {
+			plan.cacheable = false;
+		}
+
 		/* Work out which bits of this region need to be read;
 		   first, trim to the range we are reading...
 		*/
 		Temporal::Range rrange = ar->range_samples ();
 		Temporal::Range region_range (max (rrange.start(), start),
-		                              min (rrange.end() + ar->tail (), start + cnt));
+		                              min (rrange.end() + ar->tail (), end));
 
 		/* ... and then remove the bits that are already done */
 
@@ -257,7 +403,9 @@ AudioPlaylist::read (Sample *buf, Sample *mixdown_buffer, float *gain_buffer, ti
 
 		for (Temporal::RangeList::List::iterator j = t.begin(); j != t.end(); ++j) {
 			Temporal::Range d = *j;
-			to_do.push_back (Segment (ar, d));
+
+			/* segments are read back to front (lowest layer first) */
+			plan.segments.push_front (Segment (ar, d));
 
 			if (ar->opaque ()) {
 				/* Cut this range down to just the body and mark it done */
@@ -271,47 +419,6 @@ AudioPlaylist::read (Sample *buf, Sample *mixdown_buffer, float *gain_buffer, ti
 			}
 		}
 	}
-
-	/* Now go backwards through the to_do list doing the actual reads */
-
-	for (list<Segment>::reverse_iterator i = to_do.rbegin(); i != to_do.rend(); ++i) {
-		DEBUG_TRACE (DEBUG::AudioPlayback, string_compose ("\tPlaylist %1 read %2 @ %3 for %4, channel %5, buf @ %6 offset %7\n",
-		                                                   name(), i->region->name(), i->range.start(),
-		                                                   i->range.length(), (int) chan_n,
-		                                                   buf, i->range.start().earlier (start)));
-
-		samplepos_t read_pos (i->range.start().samples());
-		samplecnt_t read_cnt (i->range.start().distance (i->range.end()).samples());
-		samplecnt_t soffset = start.distance (i->range.start()).samples();
-
-		assert (soffset < scnt);
-
-		if (soffset + read_cnt > scnt) {
-			read_cnt = scnt - soffset;
-		}
-		assert (soffset + read_cnt <= scnt);
-		samplecnt_t nread = i->region->read_at (buf + soffset, mixdown_buffer, gain_buffer, read_pos, read_cnt, chan_n);
-		if (nread != read_cnt) {
-			std::cerr << name() << " tried to read " << read_cnt
-				<< " got " << nread
-				<< " in " << i->region->name()
-				<< " for chn " << chan_n
-				<< " to offset " << soffset
-				<< " using range " << i->range.start().samples() << " .. " << i->range.end().samples()
-				<< " len " << i->range.length().samples() << std::endl;
-#ifndef NDEBUG
-			/* forward error to DiskReader::audio_read. This does 2 things:
-			 *  - error "DiskReader %1: when refilling, cannot read ..."
-			 *  - emit Underrun() - "Disk is too slow"
-			 * (ideally only the first would happen)
-			 * Since the buffer is zero'ed above, failed reads are not an issue.
-			 */
-			return timecnt_t (0);
-#endif
-		}
-	}
-
-	return cnt;
 }
 
 void
@@ -389,6 +496,9 @@ AudioPlaylist::destroy_region (std::shared_ptr<Region> region)
 bool
 AudioPlaylist::region_changed (const PropertyChange& what_changed, std::shared_ptr<Region> region)
 {
+	/* any change of a region (layer, mute, fades, ..) may change how the playlist is read */
+	_render_plan_serial.fetch_add (1);
+
 	if (in_flush || in_set_state) {
 		return false;
 	}
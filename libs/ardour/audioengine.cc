@@ -54,6 +54,7 @@
 #include "ardour/search_paths.h"
 #include "ardour/buffer.h"
 #include "ardour/debug.h"
+#include "ardour/dsp_trace.h"
 #include "ardour/internal_send.h"
 #include "ardour/meter.h"
 #include "ardour/midi_port.h"
@@ -1429,6 +1430,8 @@ AudioEngine::thread_init_callback (void* arg)
 	SessionEvent::create_per_thread_pool (thread_name, 512);
 	PBD::notify_event_loops_about_thread_creation (pthread_self(), thread_name, 4096);
 	AsyncMIDIPort::set_process_thread (pthread_self());
+	/* the trace ring is released when the thread exits */
+	DSPTrace::thread_init (thread_name);
 
 	Temporal::TempoMap::fetch ();
 
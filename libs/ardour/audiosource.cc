@@ -55,12 +55,15 @@
 #include "pbd/file_utils.h"
 #include "pbd/playback_buffer.h"
 #include "pbd/scoped_file_descriptor.h"
+#include "pbd/semutils.h"
 #include "pbd/xml++.h"
 
 #include "ardour/audiosource.h"
+#include "ardour/filename_extensions.h"
 #include "ardour/rc_configuration.h"
 #include "ardour/runtime_functions.h"
 #include "ardour/session.h"
+#include "ardour/source_factory.h"
 #include "ardour/utils.h"
 
 #include "pbd/i18n.h"
@@ -78,6 +81,29 @@ bool AudioSource::_build_peakfiles = false;
 
 #define _FPP 256
 
+/* A peakfile may be accompanied by a pyramid of increasingly coarse
+ * peaks, each level reducing the previous one by peak_pyramid_factor,
+ * stored in a separate file (peak_levels_path ()) that ends with a footer
+ * describing it. The peakfile itself only ever holds level 0, so older
+ * versions, which take the whole file as peaks, are not affected. The
+ * pyramid is only used if the footer matches the layout of the file and
+ * the peakfile it was built from.
+ */
+static const char        peak_pyramid_magic[8] = { 'A', 'r', 'd', 'P', 'e', 'a', 'k', 's' };
+static const uint32_t    peak_pyramid_version  = 2;
+static const samplecnt_t peak_pyramid_factor   = 16;
+static const samplecnt_t peak_pyramid_min_peaks = 1024; // smallest level that is reduced further
+
+struct PeakPyramidFooter {
+	char     magic[8];
+	uint32_t version;
+	uint32_t factor;
+	uint64_t fpp;      ///< samples per peak of level 0
+	uint64_t n_peaks;  ///< number of peaks in level 0
+	uint32_t n_levels; ///< including level 0
+	uint32_t reserved;
+};
+
 AudioSource::AudioSource (Session& s, const string& name)
 	: Source (s, DataType::AUDIO, name)
 	, _peak_byte_max (0)
@@ -253,6 +279,12 @@ AudioSource::touch_peakfile ()
 	tbuf.modtime = time ((time_t*) 0);
 
 	g_utime (_peakpath.c_str(), &tbuf);
+
+	/* the pyramid is only valid if it is not older than the peakfile */
+	string const levels_path = peak_levels_path ();
+	if (Glib::file_test (levels_path, Glib::FILE_TEST_EXISTS)) {
+		g_utime (levels_path.c_str(), &tbuf);
+	}
 }
 
 int
@@ -269,8 +301,20 @@ AudioSource::rename_peakfile (string newpath)
 		}
 	}
 
+	string const old_levels_path = peak_levels_path ();
+
 	_peakpath = newpath;
 
+	if (Glib::file_test (old_levels_path, Glib::FILE_TEST_EXISTS)) {
+		if (g_rename (old_levels_path.c_str(), peak_levels_path ().c_str()) != 0) {
+			/* not fatal, the fine peaks are complete */
+			::g_unlink (old_levels_path.c_str());
+			PBD::Mutex::Lock lm (_peak_levels_lock);
+			_peak_levels.clear ();
+			_first_run = true;
+		}
+	}
+
 	return 0;
 }
 
@@ -327,6 +371,7 @@ AudioSource::initialize_peakfile (const string& audio_path, const bool in_sessio
 
 				_peaks_built = true;
 				_peak_byte_max = statbuf.st_size;
+				load_peak_pyramid (statbuf.st_size, statbuf.st_mtime);
 
 			} else {
 
@@ -340,6 +385,7 @@ AudioSource::initialize_peakfile (const string& audio_path, const bool in_sessio
 				} else {
 					_peaks_built = true;
 					_peak_byte_max = statbuf.st_size;
+					load_peak_pyramid (statbuf.st_size, statbuf.st_mtime);
 				}
 			}
 		}
@@ -484,10 +530,37 @@ AudioSource::read_peaks_with_fpp (PeakData *peaks, samplecnt_t npeaks, samplepos
 		}
 	}
 
-	ScopedFileDescriptor sfd (g_open (_peakpath.c_str(), O_RDONLY, 0444));
+	/* use the coarsest level of the peakfile's pyramid that still has at
+	 * least the requested resolution, so that the amount of data to read
+	 * depends on the number of visual peaks, not on the length of the
+	 * range.
+	 */
+
+	PBD::Mutex::Lock ll (_peak_levels_lock);
+
+	string peak_file = _peakpath;
+	off_t  peak_base = 0;
+	off_t  peak_end  = statbuf.st_size;
+
+	if (!_peak_levels.empty () && samples_per_file_peak == _peak_levels.front ().fpp) {
+		std::vector<PeakLevel>::const_iterator l = _peak_levels.begin ();
+		while (l + 1 != _peak_levels.end () && (l + 1)->fpp <= samples_per_visual_peak) {
+			++l;
+		}
+		if (l != _peak_levels.begin ()) {
+			samples_per_file_peak = l->fpp;
+			peak_file             = peak_levels_path ();
+			peak_base             = l->offset;
+			peak_end              = l->offset + l->count * sizeof (PeakData);
+			expected_peaks        = (cnt / (double) samples_per_file_peak);
+			DEBUG_TRACE (DEBUG::Peaks, string_compose ("RP: using peak level with %1 samples per peak\n", samples_per_file_peak));
+		}
+	}
+
+	ScopedFileDescriptor sfd (g_open (peak_file.c_str(), O_RDONLY, 0444));
 
 	if (sfd < 0) {
-		error << string_compose (_("Cannot open peakfile @ %1 for reading (%2)"), _peakpath, strerror (errno)) << endmsg;
+		error << string_compose (_("Cannot open peakfile @ %1 for reading (%2)"), peak_file, strerror (errno)) << endmsg;
 		return -1;
 	}
 
@@ -536,7 +609,7 @@ AudioSource::read_peaks_with_fpp (PeakData *peaks, samplecnt_t npeaks, samplepos
 	}
 
 	if (scale == 1.0) {
-		off_t first_peak_byte = (start / samples_per_file_peak) * sizeof (PeakData);
+		off_t first_peak_byte = peak_base + (start / samples_per_file_peak) * sizeof (PeakData);
 		size_t bytes_to_read = sizeof (PeakData) * read_npeaks;
 		/* open, read, close */
 
@@ -630,13 +703,13 @@ AudioSource::read_peaks_with_fpp (PeakData *peaks, samplecnt_t npeaks, samplepos
 
 		/* open ... close during out: handling */
 
-		off_t  map_off      =  (uint32_t) (current_stored_peak) * sizeof(PeakData);
+		off_t  map_off      =  peak_base + (uint32_t) (current_stored_peak) * sizeof(PeakData);
 		off_t  read_map_off = map_off & ~(bufsize - 1);
 		off_t  map_delta    = map_off - read_map_off;
 
-		samplecnt_t max_chunk = (statbuf.st_size - read_map_off - map_delta) / sizeof(PeakData);
+		samplecnt_t max_chunk = (peak_end - read_map_off - map_delta) / sizeof(PeakData);
 
-		if (map_off > statbuf.st_size) {
+		if (map_off > peak_end) {
 			/* next_visual_peak is after peak-file end */
 			assert (npeaks == 1);
 			/* only process (next_visual_peak_sample - start), do not use peak-file */
@@ -649,8 +722,8 @@ AudioSource::read_peaks_with_fpp (PeakData *peaks, samplecnt_t npeaks, samplepos
 		size_t raw_map_length = chunksize * sizeof(PeakData);
 		size_t map_length     = raw_map_length + map_delta;
 
-		assert (read_map_off + (off_t)map_length <= statbuf.st_size);
-		assert (read_map_off + map_delta + (off_t)raw_map_length <= statbuf.st_size);
+		assert (read_map_off + (off_t)map_length <= peak_end);
+		assert (read_map_off + map_delta + (off_t)raw_map_length <= peak_end);
 
 		if (_first_run || (_last_scale != samples_per_visual_peak) || (_last_map_off != map_off) || (_last_raw_map_length < raw_map_length)) {
 
@@ -861,6 +934,16 @@ AudioSource::build_peaks_from_scratch ()
 		samplecnt_t cnt = _length.samples();
 
 		_peaks_built = false;
+
+		if (SourceFactory::n_peak_threads () > 1 && cnt > 4 * bufsize) {
+			/* long file, compute peaks on the peak-building threads */
+			if (compute_peaks_in_parallel (lp, bufsize)) {
+				done_with_peakfile_writes (false);
+				goto out;
+			}
+			cnt = 0;
+		}
+
 		std::unique_ptr<Sample[]> buf (new Sample[bufsize]);
 
 		while (cnt) {
@@ -908,11 +991,168 @@ AudioSource::build_peaks_from_scratch ()
 	if (ret) {
 		DEBUG_TRACE (DEBUG::Peaks, string_compose("Could not write peak data, attempting to remove peakfile %1\n", _peakpath));
 		::g_unlink (_peakpath.c_str());
+		::g_unlink (peak_levels_path ().c_str());
+	}
+
+	return ret;
+}
+
+/** Compute the peaks of a chunk of samples, the first peak starting at
+ *  the first sample.
+ */
+static void
+compute_chunk_peaks (Sample const* buf, samplecnt_t cnt, PeakData* peaks)
+{
+	for (samplecnt_t i = 0; i < cnt; i += _FPP, ++peaks) {
+		samplecnt_t const n = min ((samplecnt_t) _FPP, cnt - i);
+		peaks->min = buf[i];
+		peaks->max = buf[i];
+		ARDOUR::find_peaks (buf + i + 1, n - 1, &peaks->min, &peaks->max);
+	}
+}
+
+/** Build the peakfile reading batches of chunks, while the peaks of the
+ *  previous batch are computed on the peak-building threads. Peaks
+ *  never span chunks, so the chunks are independent of each other.
+ *
+ *  _lock MUST be held by the caller (using @p lp), it is released while
+ *  waiting for peaks and held again when this returns.
+ *
+ *  @param chunksize samples per chunk, a multiple of _FPP
+ *  @return 0 if all peaks were written
+ */
+int
+AudioSource::compute_peaks_in_parallel (WriterLock& lp, samplecnt_t chunksize)
+{
+	assert ((chunksize % _FPP) == 0);
+
+	struct Chunk {
+		std::unique_ptr<Sample[]>   buf;
+		std::unique_ptr<PeakData[]> peaks;
+		samplepos_t                 start;
+		samplecnt_t                 cnt;
+	};
+
+	size_t const      n_chunks = SourceFactory::n_peak_threads ();
+	samplecnt_t const length   = _length.samples ();
+
+	/* read one batch while the peaks of the other are computed */
+	std::vector<Chunk> batch[2];
+
+	for (auto& b : batch) {
+		b.resize (n_chunks);
+		for (auto& c : b) {
+			c.buf.reset (new Sample[chunksize]);
+			c.peaks.reset (new PeakData[chunksize / _FPP]);
+			c.start = 0;
+			c.cnt   = 0;
+		}
+	}
+
+	PBD::Semaphore done ("peak chunks", 0);
+
+	samplepos_t pos    = 0;
+	size_t      queued = 0;
+	int         cur    = 0;
+	int         ret    = 0;
+
+	while (true) {
+
+		/* read the next batch, while the previous one is being computed */
+
+		std::vector<Chunk>& b (batch[cur]);
+		size_t              n = 0;
+
+		for (; n < n_chunks && pos < length && ret == 0; ++n) {
+			b[n].start = pos;
+			b[n].cnt   = min (chunksize, length - pos);
+			if (read_unlocked (b[n].buf.get (), b[n].start, b[n].cnt) != b[n].cnt) {
+				error << string_compose(_("%1: could not write read raw data for peak computation (%2)"), _name, strerror (errno)) << endmsg;
+				ret = -1;
+			}
+			pos += b[n].cnt;
+		}
+
+		lp.release (); // allow butler to refill buffers
+
+		/* wait for the previous batch, helping to compute it, and write it */
+
+		if (queued) {
+			while (SourceFactory::run_peak_task ()) {
+				/* rather than wait idle, compute queued chunks here */
+			}
+		}
+
+		for (size_t i = 0; i < queued; ++i) {
+			done.wait ();
+		}
+
+		std::vector<Chunk>& prev (batch[cur ^ 1]);
+
+		for (size_t i = 0; i < queued && ret == 0; ++i) {
+			if (write_peaks (prev[i].peaks.get (), (prev[i].cnt + _FPP - 1) / _FPP, prev[i].start, prev[i].cnt)) {
+				ret = -1;
+			}
+		}
+
+		queued = 0;
+
+		if (_session.deletion_in_progress() || _session.peaks_cleanup_in_progres()) {
+			cerr << "peak file creation interrupted: " << _name << endmsg;
+			ret = -1;
+		}
+
+		if (ret || n == 0) {
+			break;
+		}
+
+		for (size_t i = 0; i < n; ++i) {
+			Chunk* c = &b[i];
+			SourceFactory::queue_peak_task ([c, &done] () {
+				compute_chunk_peaks (c->buf.get (), c->cnt, c->peaks.get ());
+				done.signal ();
+			});
+		}
+
+		queued = n;
+		cur ^= 1;
+
+		lp.acquire ();
 	}
 
+	lp.acquire ();
+
 	return ret;
 }
 
+/** Write peaks computed elsewhere to the peakfile, _lock MUST NOT be held.
+ *  @param first_sample the sample of the first peak, a multiple of _FPP
+ *  @param cnt the number of samples covered by the peaks
+ */
+int
+AudioSource::write_peaks (PeakData const* peaks, samplecnt_t npeaks, samplepos_t first_sample, samplecnt_t cnt)
+{
+	off_t const   byte  = (first_sample / _FPP) * sizeof (PeakData);
+	ssize_t const bytes = npeaks * sizeof (PeakData);
+
+	if (lseek (_peakfile_fd, byte, SEEK_SET) != byte) {
+		error << string_compose(_("%1: could not seek in peak file data (%2)"), _name, strerror (errno)) << endmsg;
+		return -1;
+	}
+
+	if (::write (_peakfile_fd, peaks, bytes) != bytes) {
+		error << string_compose(_("%1: could not write peak file data (%2)"), _name, strerror (errno)) << endmsg;
+		return -1;
+	}
+
+	_peak_byte_max = max (_peak_byte_max, (off_t) (byte + bytes));
+
+	PBD::Mutex::Lock lm (_peaks_ready_lock);
+	PeakRangeReady (first_sample, cnt); /* EMIT SIGNAL */
+
+	return 0;
+}
+
 int
 AudioSource::close_peakfile ()
 {
@@ -923,6 +1163,12 @@ AudioSource::close_peakfile ()
 	}
 	if (!_peakpath.empty()) {
 		::g_unlink (_peakpath.c_str());
+		::g_unlink (peak_levels_path ().c_str());
+	}
+	{
+		PBD::Mutex::Lock lm (_peak_levels_lock);
+		_peak_levels.clear ();
+		_first_run = true;
 	}
 	_peaks_built = false;
 	return 0;
@@ -939,6 +1185,15 @@ AudioSource::prepare_for_peakfile_writes ()
 		error << string_compose(_("AudioSource: cannot open _peakpath (c) \"%1\" (%2)"), _peakpath, strerror (errno)) << endmsg;
 		return -1;
 	}
+
+	/* level 0 is about to change, drop the pyramid, it is
+	 * re-built in done_with_peakfile_writes().
+	 */
+	PBD::Mutex::Lock lm (_peak_levels_lock);
+	_peak_levels.clear ();
+	_first_run = true;
+	::g_unlink (peak_levels_path ().c_str());
+
 	return 0;
 }
 
@@ -957,6 +1212,10 @@ AudioSource::done_with_peakfile_writes (bool done)
 		compute_and_write_peaks (0, 0, 0, true, false, _FPP);
 	}
 
+	if (done && -1 != _peakfile_fd) {
+		write_peak_pyramid ();
+	}
+
 	if (-1 != _peakfile_fd) {
 		close (_peakfile_fd);
 		_peakfile_fd = -1;
@@ -1199,6 +1458,198 @@ AudioSource::truncate_peakfile ()
 	}
 }
 
+string
+AudioSource::peak_levels_path () const
+{
+	return _peakpath + peak_levels_suffix;
+}
+
+size_t
+AudioSource::n_peak_levels () const
+{
+	PBD::Mutex::Lock lm (_peak_levels_lock);
+	return _peak_levels.size ();
+}
+
+/** Write the pyramid of coarser peaks to peak_levels_path (), level 0
+ *  must be complete and the peakfile open for writing.
+ */
+int
+AudioSource::write_peak_pyramid ()
+{
+	PBD::Mutex::Lock lm (_peak_levels_lock);
+
+	_peak_levels.clear ();
+	_first_run = true;
+
+	string const levels_path = peak_levels_path ();
+	::g_unlink (levels_path.c_str());
+
+	/* the footer refers to the natural length of the peakfile */
+	truncate_peakfile ();
+
+	samplecnt_t const n_peaks = _peak_byte_max / sizeof (PeakData);
+
+	if (n_peaks < peak_pyramid_min_peaks) {
+		/* short file, reducing level 0 is cheap enough */
+		return 0;
+	}
+
+	ScopedFileDescriptor lfd (g_open (levels_path.c_str(), O_CREAT|O_TRUNC|O_RDWR, 0664));
+
+	if (lfd < 0) {
+		error << string_compose(_("AudioSource: cannot open peak levels file \"%1\" (%2)"), levels_path, strerror (errno)) << endmsg;
+		return -1;
+	}
+
+	std::vector<PeakLevel> levels;
+	levels.push_back (PeakLevel (_FPP, 0, n_peaks));
+
+	/* reduce a bounded number of peaks at a time */
+	const samplecnt_t chunksize = peak_pyramid_factor * 4096;
+	std::unique_ptr<PeakData[]> src (new PeakData[chunksize]);
+	std::unique_ptr<PeakData[]> dst (new PeakData[chunksize / peak_pyramid_factor]);
+
+	off_t pos = 0;
+	bool  ok  = true;
+
+	while (ok && levels.back ().count >= peak_pyramid_min_peaks) {
+
+		PeakLevel const prev = levels.back ();
+		/* level 0 is read from the peakfile, all others from the levels file */
+		int const       fd   = levels.size () == 1 ? _peakfile_fd : (int) lfd;
+
+		for (samplecnt_t done = 0; done < prev.count; done += chunksize) {
+
+			samplecnt_t const n     = min (chunksize, prev.count - done);
+			samplecnt_t const n_out = (n + peak_pyramid_factor - 1) / peak_pyramid_factor;
+			off_t const       byte  = prev.offset + done * sizeof (PeakData);
+
+			if (lseek (fd, byte, SEEK_SET) != byte || ::read (fd, src.get (), n * sizeof (PeakData)) != (ssize_t) (n * sizeof (PeakData))) {
+				error << string_compose(_("%1: could not read peak file data (%2)"), _name, strerror (errno)) << endmsg;
+				ok = false;
+				break;
+			}
+
+			for (samplecnt_t i = 0; i < n_out; ++i) {
+				samplecnt_t const end = min (n, (i + 1) * peak_pyramid_factor);
+				dst[i] = src[i * peak_pyramid_factor];
+				for (samplecnt_t j = i * peak_pyramid_factor + 1; j < end; ++j) {
+					dst[i].min = min (dst[i].min, src[j].min);
+					dst[i].max = max (dst[i].max, src[j].max);
+				}
+			}
+
+			if (lseek (lfd, pos, SEEK_SET) != pos || ::write (lfd, dst.get (), n_out * sizeof (PeakData)) != (ssize_t) (n_out * sizeof (PeakData))) {
+				error << string_compose(_("%1: could not write peak file data (%2)"), _name, strerror (errno)) << endmsg;
+				ok = false;
+				break;
+			}
+
+			pos += n_out * sizeof (PeakData);
+		}
+
+		off_t const offset = levels.size () == 1 ? 0 : prev.offset + prev.count * sizeof (PeakData);
+		levels.push_back (PeakLevel (prev.fpp * peak_pyramid_factor, offset, (prev.count + peak_pyramid_factor - 1) / peak_pyramid_factor));
+	}
+
+	if (ok) {
+		PeakPyramidFooter footer;
+		memset (&footer, 0, sizeof (footer));
+		memcpy (footer.magic, peak_pyramid_magic, sizeof (footer.magic));
+		footer.version  = peak_pyramid_version;
+		footer.factor   = peak_pyramid_factor;
+		footer.fpp      = _FPP;
+		footer.n_peaks  = n_peaks;
+		footer.n_levels = levels.size ();
+
+		if (lseek (lfd, pos, SEEK_SET) != pos || ::write (lfd, &footer, sizeof (footer)) != sizeof (footer)) {
+			error << string_compose(_("%1: could not write peak file data (%2)"), _name, strerror (errno)) << endmsg;
+			ok = false;
+		}
+	}
+
+	if (!ok) {
+		/* the peakfile is complete without it */
+		::g_unlink (levels_path.c_str());
+		return -1;
+	}
+
+	_peak_levels.swap (levels);
+
+	return 0;
+}
+
+/** Look for a pyramid of coarser peaks that matches the peakfile.
+ *  @param peakfile_size size of the peakfile in bytes
+ *  @param peakfile_mtime modification time of the peakfile
+ */
+void
+AudioSource::load_peak_pyramid (off_t peakfile_size, time_t peakfile_mtime)
+{
+	PBD::Mutex::Lock lm (_peak_levels_lock);
+
+	_peak_levels.clear ();
+	_first_run = true;
+
+	string const levels_path = peak_levels_path ();
+	GStatBuf     statbuf;
+
+	if (g_stat (levels_path.c_str(), &statbuf) != 0) {
+		/* level 0 only */
+		return;
+	}
+
+	if (statbuf.st_mtime < peakfile_mtime) {
+		/* the peakfile was re-written, e.g. by a version without pyramid support */
+		DEBUG_TRACE (DEBUG::Peaks, string_compose ("Peak levels %1 are older than the peakfile\n", levels_path));
+		return;
+	}
+
+	PeakPyramidFooter footer;
+	off_t const       footer_byte = statbuf.st_size - (off_t) sizeof (footer);
+
+	if (footer_byte < 0) {
+		return;
+	}
+
+	{
+		ScopedFileDescriptor sfd (g_open (levels_path.c_str(), O_RDONLY, 0444));
+
+		if (sfd < 0 || lseek (sfd, footer_byte, SEEK_SET) != footer_byte || ::read (sfd, &footer, sizeof (footer)) != sizeof (footer)) {
+			return;
+		}
+	}
+
+	if (memcmp (footer.magic, peak_pyramid_magic, sizeof (footer.magic)) || footer.version != peak_pyramid_version
+	    || footer.fpp != _FPP || footer.factor < 2 || footer.factor > 256 || footer.n_levels < 2 || footer.n_levels > 16
+	    || footer.n_peaks * sizeof (PeakData) != (uint64_t) peakfile_size) {
+		DEBUG_TRACE (DEBUG::Peaks, string_compose ("Peak levels %1 do not match the peakfile\n", levels_path));
+		return;
+	}
+
+	std::vector<PeakLevel> levels;
+	samplecnt_t fpp    = footer.fpp;
+	samplecnt_t count  = footer.n_peaks;
+	off_t       offset = 0;
+
+	levels.push_back (PeakLevel (fpp, 0, count));
+
+	for (uint32_t n = 1; n < footer.n_levels; ++n) {
+		fpp   *= footer.factor;
+		count  = (count + footer.factor - 1) / footer.factor;
+		levels.push_back (PeakLevel (fpp, offset, count));
+		offset += count * sizeof (PeakData);
+	}
+
+	if (offset != footer_byte) {
+		DEBUG_TRACE (DEBUG::Peaks, string_compose ("Peak levels %1 are truncated or invalid\n", levels_path));
+		return;
+	}
+
+	_peak_levels.swap (levels);
+}
+
 samplecnt_t
 AudioSource::available_peaks (double zoom_factor) const
 {
@@ -64,6 +64,7 @@ static void dumpit (const AutomationList& al, string prefix = "")
 AutomationList::AutomationList (const Evoral::Parameter& id, const Evoral::ParameterDescriptor& desc, Temporal::TimeDomainProvider const & tdp)
 	: ControlList(id, desc, tdp)
 	, _before (0)
+	, _events_cache_count (0)
 {
 	_state = Off;
 	_touching.store (0);
@@ -78,6 +79,7 @@ AutomationList::AutomationList (const Evoral::Parameter& id, const Evoral::Param
 AutomationList::AutomationList (const Evoral::Parameter& id, Temporal::TimeDomainProvider const & tdp)
 	: ControlList(id, ARDOUR::ParameterDescriptor(id), tdp)
 	, _before (0)
+	, _events_cache_count (0)
 {
 	_state = Off;
 	_touching.store (0);
@@ -93,6 +95,7 @@ AutomationList::AutomationList (const AutomationList& other)
 	: ControlList(other)
 	, StatefulDestructible()
 	, _before (0)
+	, _events_cache_count (0)
 {
 	_state = other._state;
 	_touching.store (other.touching());
@@ -106,6 +109,7 @@ AutomationList::AutomationList (const AutomationList& other)
 AutomationList::AutomationList (const AutomationList& other, timepos_t const & start, timepos_t const & end)
 	: ControlList(other, start, end)
 	, _before (0)
+	, _events_cache_count (0)
 {
 	_state = other._state;
 	_touching.store (other.touching());
@@ -122,6 +126,7 @@ AutomationList::AutomationList (const AutomationList& other, timepos_t const & s
 AutomationList::AutomationList (const XMLNode& node, Evoral::Parameter id)
 	: ControlList(id, ARDOUR::ParameterDescriptor(id), Temporal::TimeDomainProvider (Temporal::AudioTime)) /* domain may change in ::set_state */
 	, _before (0)
+	, _events_cache_count (0)
 {
 	_touching.store (0);
 	_interpolation = default_interpolation ();
@@ -368,23 +373,33 @@ XMLNode&
 AutomationList::serialize_events (bool need_lock) const
 {
 	XMLNode* node = new XMLNode (X_("events"));
-	stringstream str;
 
 	PBD::RWLock::ReaderLock lm (Evoral::ControlList::_lock, PBD::RWLock::NotLock);
 	if (need_lock) {
 		lm.acquire ();
 	}
-	for (const_iterator xx = _events.begin(); xx != _events.end(); ++xx) {
-		str << PBD::to_string ((*xx)->when);
-		str << ' ';
-		str << PBD::to_string ((*xx)->value);
-		str << '\n';
+
+	/* Lists are usually unchanged between two saves, re-use the
+	 * text from the last time, unless the events were modified since.
+	 */
+	PBD::Mutex::Lock cl (_events_cache_lock);
+
+	if (_events_cache_count != edit_count ()) {
+		stringstream str;
+		for (const_iterator xx = _events.begin(); xx != _events.end(); ++xx) {
+			str << PBD::to_string ((*xx)->when);
+			str << ' ';
+			str << PBD::to_string ((*xx)->value);
+			str << '\n';
+		}
+		_events_cache = str.str ();
+		_events_cache_count = edit_count ();
 	}
 
 	/* XML is a bit weird */
 
 	XMLNode* content_node = new XMLNode (X_("foo")); /* it gets renamed by libxml when we set content */
-	content_node->set_content (str.str());
+	content_node->set_content (_events_cache);
 
 	node->add_child_nocopy (*content_node);
 
@@ -25,6 +25,7 @@
 
 #include "pbd/error.h"
 #include "ardour/coreaudiosource.h"
+#include "ardour/runtime_functions.h"
 #include "ardour/utils.h"
 
 #include "CAExtAudioFile.h"
@@ -203,14 +204,9 @@ CoreAudioSource::read_unlocked (Sample *dst, samplepos_t start, samplecnt_t cnt)
 		return 0;
 	}
 
-	Sample *ptr = interleave_buf + _channel;
-
 	/* stride through the interleaved data */
 
-	for (samplecnt_t n = 0; n < file_cnt; ++n) {
-		dst[n] = *ptr;
-		ptr += n_channels;
-	}
+	deinterleave (dst, interleave_buf + _channel, n_channels, file_cnt);
 
 	return cnt;
 }
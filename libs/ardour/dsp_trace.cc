@@ -0,0 +1,418 @@
+/*
+ * Copyright (C) 2026 Ardour Developers
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#include <algorithm>
+#include <cstdio>
+#include <limits>
+#include <sstream>
+
+#include <glib.h>
+#include <glibmm/timer.h>
+
+#include "pbd/compose.h"
+#include "pbd/error.h"
+
+#include "ardour/dsp_trace.h"
+#include "ardour/processor.h"
+#include "ardour/route.h"
+#include "ardour/session.h"
+
+#include "pbd/i18n.h"
+
+using namespace ARDOUR;
+using namespace PBD;
+
+std::atomic<bool>     DSPTrace::_enabled (false);
+std::atomic<uint64_t> DSPTrace::_cycle (0);
+
+PBD::Mutex                         DSPTrace::_rings_lock;
+std::vector<DSPTrace::ThreadRing*> DSPTrace::_rings;
+uint32_t                           DSPTrace::_ring_cnt = 0;
+
+thread_local DSPTrace::ThreadRing* DSPTrace::_thread_ring = 0;
+
+namespace {
+/* Release the ring when a thread exits, for threads that are not
+ * managed by libardour (e.g. backend threads that are set up via
+ * AudioEngine::thread_init_callback) and never call thread_fini().
+ */
+struct ThreadFini {
+	~ThreadFini () { DSPTrace::thread_fini (); }
+};
+}
+
+DSPTrace::Accumulator::Accumulator ()
+	: kind (0)
+	, count (0)
+	, min (std::numeric_limits<microseconds_t>::max ())
+	, max (0)
+	, sum (0)
+	, recent_pos (0)
+{
+}
+
+void
+DSPTrace::Accumulator::add (microseconds_t dt)
+{
+	++count;
+	sum += dt;
+	min = std::min (min, dt);
+	max = std::max (max, dt);
+
+	if (recent.size () < 1000) {
+		recent.push_back (dt);
+	} else {
+		recent[recent_pos] = dt;
+		recent_pos = (recent_pos + 1) % recent.size ();
+	}
+}
+
+DSPTrace::DSPTrace (Session& s)
+	: SessionHandleRef (s)
+	, _collector (0)
+	, _capture_start (0)
+	, _capture_end (0)
+	, _captured_dropped (0)
+	, _dropped (0)
+	, _collected_cycle (0)
+{
+	_run_collector.store (false);
+}
+
+DSPTrace::~DSPTrace ()
+{
+	set_enabled (false);
+}
+
+void
+DSPTrace::thread_init (std::string const& name)
+{
+	if (_thread_ring) {
+		return;
+	}
+	PBD::Mutex::Lock lm (_rings_lock);
+	_thread_ring = new ThreadRing (name, _ring_cnt++);
+	_rings.push_back (_thread_ring);
+
+	static thread_local ThreadFini fini;
+	(void)fini;
+}
+
+void
+DSPTrace::thread_fini ()
+{
+	if (!_thread_ring) {
+		return;
+	}
+	PBD::Mutex::Lock lm (_rings_lock);
+	if (!_enabled.load ()) {
+		/* no collector is running, release the ring right away */
+		_rings.erase (std::find (_rings.begin (), _rings.end (), _thread_ring));
+		delete _thread_ring;
+	} else {
+		_thread_ring->dead.store (true);
+	}
+	_thread_ring = 0;
+}
+
+void
+DSPTrace::record (Event& ev)
+{
+	ThreadRing* tr = _thread_ring;
+	if (!tr) {
+		return;
+	}
+	ev.cycle  = _cycle.load (std::memory_order_relaxed);
+	ev.thread = tr->index;
+	/* drop the event if the collector cannot keep up, but count it */
+	if (tr->rb.write (&ev, 1) != 1) {
+		tr->dropped.fetch_add (1, std::memory_order_relaxed);
+	}
+}
+
+void
+DSPTrace::set_enabled (bool yn)
+{
+	if (yn == enabled ()) {
+		return;
+	}
+
+	if (yn) {
+		_run_collector.store (true);
+		_collector = PBD::Thread::create (std::bind (&DSPTrace::collector_thread, this), "DSPTrace");
+		if (!_collector) {
+			_run_collector.store (false);
+			error << _("Cannot create DSP trace collector thread") << endmsg;
+			return;
+		}
+		_enabled.store (true);
+	} else {
+		_enabled.store (false);
+		_run_collector.store (false);
+		_collector->join ();
+		delete _collector;
+		_collector = 0;
+		/* drain remaining events, release rings of terminated threads */
+		collect ();
+	}
+}
+
+void
+DSPTrace::collector_thread ()
+{
+	while (_run_collector.load ()) {
+		collect ();
+		Glib::usleep (20000);
+	}
+}
+
+void
+DSPTrace::collect ()
+{
+	PBD::Mutex::Lock lr (_rings_lock);
+	PBD::Mutex::Lock ls (_stats_lock);
+
+	uint64_t const cycle = _cycle.load ();
+
+	for (auto i = _rings.begin (); i != _rings.end ();) {
+		ThreadRing* tr = *i;
+		Event       ev;
+
+		_thread_names[tr->index] = tr->name;
+
+		while (tr->rb.read (&ev, 1) == 1) {
+			Accumulator& a = _stats[ev.id];
+			a.kind = ev.kind;
+			a.add (ev.end - ev.start);
+
+			if (ev.cycle >= _capture_start && ev.cycle < _capture_end) {
+				_captured.push_back (ev);
+			}
+		}
+
+		/* events are lost when the ring is full, so they are from
+		 * cycles since the previous collection
+		 */
+		uint64_t const dropped = tr->dropped.load (std::memory_order_relaxed);
+		if (dropped != tr->dropped_seen) {
+			uint64_t const n = dropped - tr->dropped_seen;
+			tr->dropped_seen = dropped;
+			_dropped += n;
+			if (_collected_cycle < _capture_end && cycle >= _capture_start) {
+				_captured_dropped += n;
+				_thread_dropped[tr->index] += n;
+			}
+		}
+
+		if (tr->dead.load ()) {
+			delete tr;
+			i = _rings.erase (i);
+		} else {
+			++i;
+		}
+	}
+
+	_collected_cycle = cycle;
+}
+
+void
+DSPTrace::reset ()
+{
+	PBD::Mutex::Lock ls (_stats_lock);
+	_stats.clear ();
+	_captured.clear ();
+	_thread_dropped.clear ();
+	_capture_start = _capture_end = 0;
+	_captured_dropped = _dropped = 0;
+}
+
+void
+DSPTrace::capture (uint32_t n_cycles)
+{
+	PBD::Mutex::Lock ls (_stats_lock);
+	_captured.clear ();
+	_thread_dropped.clear ();
+	_captured_dropped = 0;
+	_capture_start = _cycle.load () + 1;
+	_capture_end   = _capture_start + n_cycles;
+}
+
+bool
+DSPTrace::capture_complete () const
+{
+	return _cycle.load () >= _capture_end;
+}
+
+uint64_t
+DSPTrace::dropped () const
+{
+	PBD::Mutex::Lock ls (_stats_lock);
+	return _dropped;
+}
+
+std::string
+DSPTrace::object_name (uint64_t id, uint32_t kind) const
+{
+	if (kind == RouteProcess) {
+		std::shared_ptr<Route> r = _session.route_by_id (PBD::ID (id));
+		if (r) {
+			return r->name ();
+		}
+	} else {
+		std::shared_ptr<Processor> p = _session.processor_by_id (PBD::ID (id));
+		if (p && p->owner ()) {
+			return string_compose ("%1/%2", p->owner ()->name (), p->name ());
+		} else if (p) {
+			return p->name ();
+		}
+	}
+	return PBD::ID (id).to_s ();
+}
+
+std::vector<DSPTrace::Stats>
+DSPTrace::stats () const
+{
+	std::vector<Stats> rv;
+
+	PBD::Mutex::Lock ls (_stats_lock);
+
+	for (auto const& i : _stats) {
+		Accumulator const& a = i.second;
+		if (a.count == 0) {
+			continue;
+		}
+
+		Stats s;
+		s.name  = object_name (i.first, a.kind);
+		s.kind  = a.kind;
+		s.count = a.count;
+		s.min   = a.min;
+		s.max   = a.max;
+		s.avg   = a.sum / (double)a.count;
+
+		std::vector<microseconds_t> r (a.recent);
+		size_t n = (r.size () * 99) / 100;
+		std::nth_element (r.begin (), r.begin () + n, r.end ());
+		s.p99 = r[n];
+
+		rv.push_back (s);
+	}
+
+	std::sort (rv.begin (), rv.end (), [] (Stats const& a, Stats const& b) { return a.max > b.max; });
+	return rv;
+}
+
+static std::string
+json_escape (std::string const& s)
+{
+	std::string rv;
+	rv.reserve (s.size ());
+	for (char c : s) {
+		switch (c) {
+			case '"':
+				rv += "\\\"";
+				break;
+			case '\\':
+				rv += "\\\\";
+				break;
+			case '\n':
+				rv += "\\n";
+				break;
+			case '\r':
+				rv += "\\r";
+				break;
+			case '\t':
+				rv += "\\t";
+				break;
+			default:
+				if ((unsigned char)c < 0x20) {
+					char buf[8];
+					snprintf (buf, sizeof (buf), "\\u%04x", (unsigned int)(unsigned char)c);
+					rv += buf;
+				} else {
+					rv += c;
+				}
+				break;
+		}
+	}
+	return rv;
+}
+
+bool
+DSPTrace::write_chrome_trace (std::string const& path) const
+{
+	std::stringstream ss;
+
+	PBD::Mutex::Lock ls (_stats_lock);
+
+	std::map<uint64_t, std::string> names;
+	microseconds_t                  t0 = _captured.empty () ? 0 : _captured.front ().start;
+
+	for (auto const& ev : _captured) {
+		t0 = std::min (t0, ev.start);
+		if (names.find (ev.id) == names.end ()) {
+			names[ev.id] = json_escape (object_name (ev.id, ev.kind));
+		}
+	}
+
+	ss << "{\"traceEvents\":[\n";
+
+	for (auto const& t : _thread_names) {
+		auto const d = _thread_dropped.find (t.first);
+		ss << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << t.first
+		   << ",\"args\":{\"name\":\"" << json_escape (t.second) << "\"";
+		if (d != _thread_dropped.end ()) {
+			ss << ",\"dropped_events\":" << d->second;
+		}
+		ss << "}},\n";
+	}
+
+	bool first = true;
+	for (auto const& ev : _captured) {
+		std::string const& name = names[ev.id];
+
+		if (!first) {
+			ss << ",\n";
+		}
+		first = false;
+
+		ss << "{\"name\":\"" << name << "\""
+		   << ",\"cat\":\"" << (ev.kind == RouteProcess ? "route" : "plugin") << "\""
+		   << ",\"ph\":\"X\""
+		   << ",\"ts\":" << (ev.start - t0)
+		   << ",\"dur\":" << (ev.end - ev.start)
+		   << ",\"pid\":1,\"tid\":" << ev.thread
+		   << ",\"args\":{\"cycle\":" << ev.cycle << "}}";
+	}
+
+	ss << "\n],\"otherData\":{\"dropped_events\":" << _captured_dropped << "}}\n";
+
+	if (_captured_dropped > 0) {
+		warning << string_compose (_("DSP trace: %1 events were dropped during the capture, the trace is incomplete"), _captured_dropped) << endmsg;
+	}
+
+	GError* err = NULL;
+	if (!g_file_set_contents (path.c_str (), ss.str ().c_str (), -1, &err)) {
+		if (err) {
+			error << string_compose (_("Could not write DSP trace to file (%1)"), err->message) << endmsg;
+			g_error_free (err);
+		}
+		return false;
+	}
+	return true;
+}
@@ -38,7 +38,9 @@
 #include "audiographer/process_context.h"
 #include "audiographer/general/chunker.h"
 #include "audiographer/general/cmdpipe_writer.h"
+#include "audiographer/general/decoupler.h"
 #include "audiographer/general/demo_noise.h"
+#include "audiographer/general/fan_out.h"
 #include "audiographer/general/interleaver.h"
 #include "audiographer/general/limiter.h"
 #include "audiographer/general/normalizer.h"
@@ -48,7 +50,6 @@
 #include "audiographer/general/sample_format_converter.h"
 #include "audiographer/general/sr_converter.h"
 #include "audiographer/general/silence_trimmer.h"
-#include "audiographer/general/threader.h"
 #include "audiographer/sndfile/tmp_file.h"
 #include "audiographer/sndfile/tmp_file_rt.h"
 #include "audiographer/sndfile/tmp_file_sync.h"
@@ -71,7 +72,9 @@ using namespace AudioGrapher;
 using std::string;
 
 /*
- * The Export Graph is evaluated for each Timespan.
+ * The Export Graph is evaluated for each Timespan. Several disjoint
+ * timespans can share one pass, each has its own set of ChannelConfigs
+ * and is fed only the part of the cycle that falls inside its range.
  *
  *  - The Graph has at least one ChannelConfig
  *  - Each ChannnelConfig has at least one SilenceHandler.
@@ -115,7 +118,7 @@ using std::string;
  * |     Peak Reader -> Loudness Reader -> TMP File       |
  * |                                         |            |
  * |                                         v            |
- * |               Threader (run SFC childs in parallel)  |
+ * |               FanOut (run SFC childs in parallel)    |
  * }                                         |            |
  *                                           v            |
  *      /------------------------------------/            |
@@ -157,7 +160,6 @@ namespace ARDOUR {
 
 ExportGraphBuilder::ExportGraphBuilder (Session const & session)
 	: session (session)
-	, thread_pool (PBD::hardware_concurrency())
 {
 	process_buffer_samples = session.engine().samples_per_cycle();
 }
@@ -167,37 +169,62 @@ ExportGraphBuilder::~ExportGraphBuilder ()
 }
 
 samplecnt_t
-ExportGraphBuilder::process (samplecnt_t samples, bool last_cycle)
+ExportGraphBuilder::process (samplepos_t position, samplecnt_t samples)
 {
 	assert(samples <= process_buffer_samples);
 
+	/* read each source exactly once, this also advances the delay-lines */
+	for (size_t i = 0; i < sources.size (); ++i) {
+		sources[i]->read (source_buffers[i], samples);
+	}
+
+	if (session.remaining_latency_preroll () >= _master_align + samples) {
+		/* Skip processing during pre-roll, only read/write export ringbuffers */
+		return 0;
+	}
+
 	sampleoffset_t off = 0;
-	for (ChannelMap::iterator it = channels.begin(); it != channels.end(); ++it) {
-		Buffer const* buf;
-		it->first->read (buf, samples);
+	if (session.remaining_latency_preroll () > _master_align) {
+		off = session.remaining_latency_preroll () - _master_align;
+		assert (off < samples);
+	}
 
-		if (session.remaining_latency_preroll () >= _master_align + samples) {
-			/* Skip processing during pre-roll, only read/write export ringbuffers */
-			return 0;
-		}
+	samplepos_t const end = position + samples - off;
 
-		off = 0;
-		if (session.remaining_latency_preroll () > _master_align) {
-			off = session.remaining_latency_preroll () - _master_align;
-			assert (off < samples);
+	for (TimespanGraphList::iterator t = timespans.begin (); t != timespans.end (); ++t) {
+		if (t->done) {
+			continue;
 		}
-
-		AudioBuffer const* ab = dynamic_cast<AudioBuffer const*> (buf);
-		MidiBuffer const*  mb;
-		if (ab) {
-			Sample const* process_buffer = ab->data ();
-			ConstProcessContext<Sample> context(&process_buffer[off], samples - off, 1);
-			if (last_cycle) { context().set_flag (ProcessContext<Sample>::EndOfInput); }
-			it->second->process (context);
+		samplepos_t const ts_start = t->timespan->get_start ();
+		samplepos_t const ts_end   = t->timespan->get_end ();
+
+		/* gate the cycle to the timespan's range */
+		samplepos_t const s = std::max (position, ts_start);
+		samplepos_t const e = std::min (end, ts_end);
+		if (s >= e) {
+			continue;
 		}
-		if  ((mb = dynamic_cast<MidiBuffer const*> (buf))) {
-			it->second->process (*mb, off, samples - off, last_cycle);
+
+		sampleoffset_t const o    = off + (s - position);
+		samplecnt_t const    n    = e - s;
+		bool const           last = (e == ts_end);
+
+		for (std::vector<std::pair<size_t, AnyExportPtr> >::iterator it = t->inputs.begin (); it != t->inputs.end (); ++it) {
+			Buffer const*      buf = source_buffers[it->first];
+			AudioBuffer const* ab  = dynamic_cast<AudioBuffer const*> (buf);
+			MidiBuffer const*  mb;
+			if (ab) {
+				Sample const* process_buffer = ab->data ();
+				ConstProcessContext<Sample> context(&process_buffer[o], n, 1);
+				if (last) { context().set_flag (ProcessContext<Sample>::EndOfInput); }
+				it->second->process (context);
+			}
+			if  ((mb = dynamic_cast<MidiBuffer const*> (buf))) {
+				it->second->process (*mb, o, n, last);
+			}
 		}
+
+		t->done = last;
 	}
 
 	return samples - off;
@@ -231,9 +258,11 @@ void
 ExportGraphBuilder::reset ()
 {
 	timespan.reset();
-	channel_configs.clear ();
-	channels.clear ();
+	timespans.clear ();
+	sources.clear ();
+	source_buffers.clear ();
 	intermediates.clear ();
+	fan_out_workers.reset ();
 	analysis_map.clear();
 	_exported_files.clear();
 	_realtime = false;
@@ -243,11 +272,13 @@ ExportGraphBuilder::reset ()
 void
 ExportGraphBuilder::cleanup (bool remove_out_files/*=false*/)
 {
-	ChannelConfigList::iterator iter = channel_configs.begin();
+	for (TimespanGraphList::iterator t = timespans.begin (); t != timespans.end (); ++t) {
+		ChannelConfigList::iterator iter = t->channel_configs.begin();
 
-	while (iter != channel_configs.end() ) {
-		iter->remove_children(remove_out_files);
-		iter = channel_configs.erase(iter);
+		while (iter != t->channel_configs.end() ) {
+			iter->remove_children(remove_out_files);
+			iter = t->channel_configs.erase(iter);
+		}
 	}
 }
 
@@ -257,6 +288,50 @@ ExportGraphBuilder::set_current_timespan (std::shared_ptr<ExportTimespan> span)
 	timespan = span;
 }
 
+ExportGraphBuilder::TimespanGraph&
+ExportGraphBuilder::current_graph ()
+{
+	assert (timespan);
+	for (TimespanGraphList::iterator t = timespans.begin (); t != timespans.end (); ++t) {
+		if (t->timespan == timespan) {
+			return *t;
+		}
+	}
+	timespans.push_back (new TimespanGraph (timespan));
+	return timespans.back ();
+}
+
+void
+ExportGraphBuilder::update_sources ()
+{
+	sources.clear ();
+	std::map<ExportChannelPtr, size_t> index;
+
+	for (TimespanGraphList::iterator t = timespans.begin (); t != timespans.end (); ++t) {
+		t->inputs.clear ();
+		for (ChannelMap::iterator it = t->channels.begin (); it != t->channels.end (); ++it) {
+			std::map<ExportChannelPtr, size_t>::iterator i = index.find (it->first);
+			if (i == index.end ()) {
+				i = index.insert (std::make_pair (it->first, sources.size ())).first;
+				sources.push_back (it->first);
+			}
+			t->inputs.push_back (std::make_pair (i->second, it->second));
+		}
+	}
+
+	source_buffers.assign (sources.size (), 0);
+}
+
+std::vector<std::string>
+ExportGraphBuilder::exported_files (std::shared_ptr<ExportTimespan> span) const
+{
+	std::map<ExportTimespan const*, std::vector<std::string> >::const_iterator i = _exported_files.find (span.get ());
+	if (i == _exported_files.end ()) {
+		return std::vector<std::string> ();
+	}
+	return i->second;
+}
+
 void
 ExportGraphBuilder::add_config (FileSpec const & config, bool rt)
 {
@@ -293,6 +368,7 @@ ExportGraphBuilder::add_config (FileSpec const & config, bool rt)
 
 	if (!new_config.channel_config->get_split ()) {
 		add_split_config (new_config);
+		update_sources ();
 		return;
 	}
 
@@ -314,6 +390,8 @@ ExportGraphBuilder::add_config (FileSpec const & config, bool rt)
 
 		add_split_config (copy);
 	}
+
+	update_sources ();
 }
 
 void
@@ -329,7 +407,9 @@ ExportGraphBuilder::get_analysis_results (AnalysisResults& results) {
 void
 ExportGraphBuilder::add_split_config (FileSpec const & config)
 {
-	for (ChannelConfigList::iterator it = channel_configs.begin(); it != channel_configs.end(); ++it) {
+	TimespanGraph& graph = current_graph ();
+
+	for (ChannelConfigList::iterator it = graph.channel_configs.begin(); it != graph.channel_configs.end(); ++it) {
 		if (*it == config) {
 			it->add_child (config);
 			return;
@@ -337,7 +417,7 @@ ExportGraphBuilder::add_split_config (FileSpec const & config)
 	}
 
 	// No duplicate channel config found, create new one
-	channel_configs.push_back (new ChannelConfig (*this, config, channels));
+	graph.channel_configs.push_back (new ChannelConfig (*this, config, graph.channels));
 }
 
 /* Encoder */
@@ -798,7 +878,10 @@ ExportGraphBuilder::Intermediate::Intermediate (ExportGraphBuilder & parent, Fil
 
 	peak_reader.reset (new PeakReader ());
 	loudness_reader.reset (new LoudnessReader (config.format->sample_rate(), channels, max_samples));
-	threader.reset (new Threader<Sample> (parent.thread_pool));
+	if (!parent.fan_out_workers) {
+		parent.fan_out_workers.reset (new FanOutWorkers (PBD::hardware_concurrency()));
+	}
+	fan_out.reset (new FanOut<Sample> (parent.fan_out_workers));
 
 	int format = ExportFormatBase::F_RAW | ExportFormatBase::SF_Float;
 
@@ -845,7 +928,7 @@ ExportGraphBuilder::Intermediate::add_child (FileSpec const & new_config)
 	}
 
 	children.push_back (SFC (parent, new_config, max_samples_out));
-	threader->add_output (children.back().sink());
+	fan_out->add_output (children.back().sink());
 }
 
 void
@@ -891,7 +974,7 @@ ExportGraphBuilder::Intermediate::prepare_post_processing()
 		}
 	}
 
-	tmp_file->add_output (threader);
+	tmp_file->add_output (fan_out);
 	parent.intermediates.push_back (this);
 }
 
@@ -934,12 +1017,25 @@ ExportGraphBuilder::SRC::SRC (ExportGraphBuilder & parent, FileSpec const & new_
 	converter->init (parent.session.nominal_sample_rate(), format.sample_rate(), format.src_quality());
 	max_samples_out = converter->allocate_buffers (max_samples);
 
+	/* Resample and encode in a separate thread, so that the process
+	 * thread can continue to produce data. With realtime export, encoding
+	 * is deferred to post-processing anyway.
+	 */
+	uint32_t const queue = Config->get_export_encoder_queue ();
+	if (queue > 0 && !parent._realtime) {
+		decoupler.reset (new Decoupler<Sample> (max_samples, queue));
+		decoupler->add_output (converter);
+	}
+
 	add_child (new_config);
 }
 
 ExportGraphBuilder::FloatSinkPtr
 ExportGraphBuilder::SRC::sink ()
 {
+	if (decoupler) {
+		return decoupler;
+	}
 	return converter;
 }
 
@@ -956,6 +1052,11 @@ ExportGraphBuilder::SRC::add_child (FileSpec const & new_config)
 void
 ExportGraphBuilder::SRC::remove_children (bool remove_out_files)
 {
+	if (decoupler) {
+		/* do not pull the rug out from under the worker thread */
+		decoupler->stop ();
+	}
+
 	boost::ptr_list<SFC>::iterator sfc_iter = children.begin();
 
 	while (sfc_iter != children.end() ) {
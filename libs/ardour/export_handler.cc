@@ -22,6 +22,8 @@
  * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
  */
 
+#include <algorithm>
+
 #include "pbd/gstdio_compat.h"
 #include <glibmm.h>
 #include <glibmm/convert.h>
@@ -118,6 +120,8 @@ ExportHandler::ExportHandler (Session & session)
   , graph_builder (new ExportGraphBuilder (session))
   , export_status (session.get_export_status ())
   , post_processing (false)
+  , process_position (0)
+  , process_end (0)
   , cue_tracknum (0)
   , cue_indexnum (0)
 {
@@ -245,38 +249,81 @@ ExportHandler::start_timespan ()
 		return -1;
 	}
 
-	export_status->timespan++;
-
-	/* finish_timespan pops the config_map entry that has been done, so
+	/* finish_timespan pops the config_map entries that have been done, so
 	   this is the timespan to do this time
 	*/
 	current_timespan = config_map.begin()->first;
 
-	export_status->total_samples_current_timespan = current_timespan->get_length();
-	export_status->timespan_name = current_timespan->name();
+	current_timespans.clear ();
+
+	if (Config->get_export_timespans_in_one_pass ()) {
+		/* Collect timespans that can be exported in the same freewheel pass.
+		 * config_map is ordered by pointer, go by start instead.
+		 */
+		for (ConfigMap::iterator it = config_map.begin (); it != config_map.end (); it = config_map.upper_bound (it->first)) {
+			current_timespans.push_back (it->first);
+		}
+		std::stable_sort (current_timespans.begin (), current_timespans.end (),
+		                  [] (ExportTimespanPtr const& a, ExportTimespanPtr const& b) { return a->get_start () < b->get_start (); });
+
+		std::vector<PassCandidate> candidates;
+		for (std::vector<ExportTimespanPtr>::const_iterator t = current_timespans.begin (); t != current_timespans.end (); ++t) {
+			candidates.push_back (PassCandidate ((*t)->get_start (), (*t)->get_end (), can_share_pass (*t)));
+		}
+
+		samplecnt_t const max_gap = Config->get_export_preroll () * session.nominal_sample_rate () + session.worst_latency_preroll ();
+		current_timespans.resize (pass_size (candidates, max_gap));
+		current_timespan = current_timespans.front ();
+	} else {
+		current_timespans.push_back (current_timespan);
+	}
+
+	process_end = current_timespan->get_end ();
+	for (std::vector<ExportTimespanPtr>::const_iterator t = current_timespans.begin (); t != current_timespans.end (); ++t) {
+		process_end = std::max (process_end, (*t)->get_end ());
+	}
+
+	export_status->timespan += current_timespans.size ();
+
+	samplecnt_t length = 0;
+	std::string name;
+	for (std::vector<ExportTimespanPtr>::const_iterator t = current_timespans.begin (); t != current_timespans.end (); ++t) {
+		length += (*t)->get_length ();
+		name += (name.empty () ? "" : ", ") + (*t)->name ();
+	}
+
+	/* the gaps between timespans are processed as well */
+	export_status->total_samples += process_end - current_timespan->get_start () - length;
+	export_status->total_samples_current_timespan = process_end - current_timespan->get_start ();
+	export_status->timespan_name = name;
 	export_status->processed_samples_current_timespan = 0;
 
 	/* Register file configurations to graph builder */
 
-	/* Here's the config_map entries that use this timespan */
-	timespan_bounds = config_map.equal_range (current_timespan);
 	graph_builder->reset ();
-	graph_builder->set_current_timespan (current_timespan);
-	handle_duplicate_format_extensions();
 	bool realtime = current_timespan->realtime ();
 	bool region_export = true;
-	for (ConfigMap::iterator it = timespan_bounds.first; it != timespan_bounds.second; ++it) {
-		// Filenames can be shared across timespans
-		FileSpec & spec = it->second;
-		spec.filename->set_timespan (it->first);
-		switch (spec.channel_config->region_processing_type ()) {
-			case RegionExportChannelFactory::None:
-				region_export = false;
-				break;
-			default:
-				break;
+	for (std::vector<ExportTimespanPtr>::const_iterator t = current_timespans.begin (); t != current_timespans.end (); ++t) {
+		TimespanBounds bounds = config_map.equal_range (*t);
+		graph_builder->set_current_timespan (*t);
+		handle_duplicate_format_extensions (bounds.first, bounds.second);
+		for (ConfigMap::iterator it = bounds.first; it != bounds.second; ++it) {
+			// Filenames can be shared across timespans
+			FileSpec & spec = it->second;
+			if (current_timespans.size () > 1) {
+				/* all files of the pass are open at the same time */
+				spec.filename.reset (new ExportFilename (*spec.filename));
+			}
+			spec.filename->set_timespan (it->first);
+			switch (spec.channel_config->region_processing_type ()) {
+				case RegionExportChannelFactory::None:
+					region_export = false;
+					break;
+				default:
+					break;
+			}
+			graph_builder->add_config (spec, realtime);
 		}
-		graph_builder->add_config (spec, realtime);
 	}
 
 	// ExportDialog::update_realtime_selection does not allow this
@@ -296,13 +343,53 @@ ExportHandler::start_timespan ()
 	return session.start_audio_export (process_position, realtime, region_export);
 }
 
+size_t
+ExportHandler::pass_size (std::vector<PassCandidate> const& candidates, samplecnt_t max_gap)
+{
+	if (candidates.empty ()) {
+		return 0;
+	}
+	if (!candidates.front ().shareable) {
+		return 1;
+	}
+
+	samplepos_t const start = candidates.front ().start;
+	samplepos_t       end   = candidates.front ().end;
+
+	size_t n = 1;
+	for (; n < candidates.size (); ++n) {
+		PassCandidate const& c (candidates[n]);
+		/* the pass cannot go back in time, and only rolls
+		 * through gaps that are shorter than a pre-roll */
+		if (!c.shareable || c.start < start || c.start > end + max_gap) {
+			break;
+		}
+		end = std::max (end, c.end);
+	}
+	return n;
+}
+
+bool
+ExportHandler::can_share_pass (ExportTimespanPtr ts) const
+{
+	if (ts->realtime () || !ts->vapor ().empty ()) {
+		return false;
+	}
+	for (ConfigMap::const_iterator it = config_map.lower_bound (ts); it != config_map.upper_bound (ts); ++it) {
+		if (it->second.channel_config->region_processing_type () != RegionExportChannelFactory::None) {
+			return false;
+		}
+	}
+	return true;
+}
+
 void
-ExportHandler::handle_duplicate_format_extensions()
+ExportHandler::handle_duplicate_format_extensions (ConfigMap::iterator first, ConfigMap::iterator last)
 {
 	typedef std::map<std::string, int> ExtCountMap;
 
 	ExtCountMap counts;
-	for (ConfigMap::iterator it = timespan_bounds.first; it != timespan_bounds.second; ++it) {
+	for (ConfigMap::iterator it = first; it != last; ++it) {
 		std::string pfx;
 		if (it->second.filename->include_timespan) {
 			pfx = it->first->name();
@@ -325,7 +412,7 @@ ExportHandler::handle_duplicate_format_extensions()
 	}
 
 	// Set this always, as the filenames are shared...
-	for (ConfigMap::iterator it = timespan_bounds.first; it != timespan_bounds.second; ++it) {
+	for (ConfigMap::iterator it = first; it != last; ++it) {
 		assert (it->second.filename->include_format_name == duplicates_found);
 		it->second.filename->include_format_name = duplicates_found;
 	}
@@ -358,7 +445,7 @@ ExportHandler::process_timespan (samplecnt_t samples)
 	/* update position */
 
 	samplecnt_t samples_to_read = 0;
-	samplepos_t const end = current_timespan->get_end();
+	samplepos_t const end = process_end;
 
 	if (process_position >= end) {
 		/* export complete, post-roll to feed and flush latent plugins
@@ -390,7 +477,7 @@ ExportHandler::process_timespan (samplecnt_t samples)
 	}
 
 	/* Do actual processing */
-	samplecnt_t ret = graph_builder->process (samples_to_read, last_cycle);
+	samplecnt_t ret = graph_builder->process (process_position, samples_to_read);
 	if (ret > 0) {
 		process_position += ret;
 		export_status->processed_samples += ret;
@@ -439,37 +526,49 @@ ExportHandler::finish_timespan ()
 	 * for a single config, config_map iterator below does not yet
 	 * take that into account.
 	 */
-	for (auto const& f : graph_builder->exported_files ()) {
-		Session::Exported (current_timespan->name(), f, config_map.begin()->second.format->reimport(), current_timespan->get_start ()); /* EMIT SIGNAL */
+	for (std::vector<ExportTimespanPtr>::const_iterator t = current_timespans.begin (); t != current_timespans.end (); ++t) {
+		bool const reimport = config_map.find (*t)->second.format->reimport ();
+		for (auto const& f : graph_builder->exported_files (*t)) {
+			Session::Exported ((*t)->name(), f, reimport, (*t)->get_start ()); /* EMIT SIGNAL */
+		}
 	}
 
-	while (config_map.begin() != timespan_bounds.second) {
+	std::vector<ExportTimespanPtr>::const_iterator pass_ts = current_timespans.begin ();
+
+	while (pass_ts != current_timespans.end ()) {
+
+		ConfigMap::iterator cit = config_map.find (*pass_ts);
+		if (cit == config_map.end ()) {
+			++pass_ts;
+			continue;
+		}
 
 		// XXX single timespan+format may produce multiple files
 		// e.g export selection == session
 		// -> TagLib::FileRef is null
 
-		FileSpec& config = config_map.begin()->second;
+		ExportTimespanPtr ts = cit->first;
+		FileSpec& config = cit->second;
 		ExportFormatSpecPtr fmt = config.format;
 		config.filename->set_channel_config (config.channel_config);
 		std::string filename = config.filename->get_path (fmt);
 
 		if (fmt->type () == ExportFormatBase::T_None) {
 			graph_builder->reset ();
-			config_map.erase (config_map.begin());
+			config_map.erase (cit);
 			continue;
 		}
 
 		if (fmt->with_cue()) {
-			export_cd_marker_file (current_timespan, fmt, filename, CDMarkerCUE);
+			export_cd_marker_file (ts, fmt, filename, CDMarkerCUE);
 		}
 
 		if (fmt->with_toc()) {
-			export_cd_marker_file (current_timespan, fmt, filename, CDMarkerTOC);
+			export_cd_marker_file (ts, fmt, filename, CDMarkerTOC);
 		}
 
 		if (fmt->with_mp4chaps()) {
-			export_cd_marker_file (current_timespan, fmt, filename, MP4Chaps);
+			export_cd_marker_file (ts, fmt, filename, MP4Chaps);
 		}
 
 		/* close file first, otherwise TagLib enounters an ERROR_SHARING_VIOLATION
@@ -517,7 +616,7 @@ ExportHandler::finish_timespan ()
 				{'G', metadata.genre ()},
 				{'L', total_tracks.str ()},
 				{'M', metadata.mixer ()},
-				{'N', current_timespan->name()}, // =?= config_map.begin()->first->name ()
+				{'N', ts->name()},
 				{'O', metadata.composer ()},
 				{'P', metadata.producer ()},
 				{'S', metadata.disc_subtitle ()},
@@ -575,7 +674,7 @@ ExportHandler::finish_timespan ()
 			}
 			delete soundcloud_uploader;
 		}
-		config_map.erase (config_map.begin());
+		config_map.erase (cit);
 	}
 
 	/* finish timespan is called in freewheeling rt-context,
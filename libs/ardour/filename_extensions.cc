@@ -29,9 +29,11 @@ const char* const template_suffix = X_(".template");
 const char* const statefile_suffix = X_(".ardour");
 const char* const pending_suffix = X_(".pending");
 const char* const peakfile_suffix = X_(".peak");
+const char* const peak_levels_suffix = X_(".levels");
 const char* const backup_suffix = X_(".bak");
 const char* const temp_suffix = X_(".tmp");
 const char* const history_suffix = X_(".history");
+const char* const history_journal_suffix = X_(".history-journal");
 const char* const export_preset_suffix = X_(".preset");
 const char* const export_format_suffix = X_(".format");
 const char* const session_archive_suffix = X_(".ardour-session-archive");
@@ -134,9 +134,12 @@
 #include "ardour/transport_master_manager.h"
 #include "ardour/triggerbox.h"
 #include "ardour/uri_map.h"
+#include "ardour/worker.h"
 
 #include "audiographer/routines.h"
 
+#include "evoral/ControlList.h"
+
 #if defined(__APPLE__)
 #include <CoreFoundation/CoreFoundation.h>
 #endif
@@ -159,6 +162,11 @@ apply_gain_to_buffer_t  ARDOUR::apply_gain_to_buffer  = 0;
 mix_buffers_with_gain_t ARDOUR::mix_buffers_with_gain = 0;
 mix_buffers_no_gain_t   ARDOUR::mix_buffers_no_gain   = 0;
 copy_vector_t           ARDOUR::copy_vector           = 0;
+fill_ramp_t             ARDOUR::fill_ramp             = 0;
+apply_gain_vector_t     ARDOUR::apply_gain_vector     = 0;
+interleave_t            ARDOUR::interleave            = 0;
+deinterleave_t          ARDOUR::deinterleave          = 0;
+mix_buffers_with_gain_vector_t ARDOUR::mix_buffers_with_gain_vector = 0;
 
 PBD::Signal<void(std::string)>                    ARDOUR::BootMessage;
 PBD::Signal<void(std::string, std::string, bool)> ARDOUR::PluginScanMessage;
@@ -213,6 +221,11 @@ setup_hardware_optimization (bool try_optimization)
 			mix_buffers_with_gain = x86_avx512f_mix_buffers_with_gain;
 			mix_buffers_no_gain   = x86_avx512f_mix_buffers_no_gain;
 			copy_vector           = x86_avx512f_copy_vector;
+			fill_ramp             = x86_avx512f_fill_ramp;
+			apply_gain_vector     = x86_avx512f_apply_gain_vector;
+			mix_buffers_with_gain_vector = x86_avx512f_mix_buffers_with_gain_vector;
+			interleave            = x86_sse_interleave;
+			deinterleave          = x86_sse_deinterleave;
 
 			generic_mix_functions = false;
 
@@ -230,6 +243,11 @@ setup_hardware_optimization (bool try_optimization)
 			mix_buffers_with_gain = x86_fma_mix_buffers_with_gain;
 			mix_buffers_no_gain   = x86_sse_avx_mix_buffers_no_gain;
 			copy_vector           = x86_sse_avx_copy_vector;
+			fill_ramp             = x86_sse_avx_fill_ramp;
+			apply_gain_vector     = x86_sse_avx_apply_gain_vector;
+			mix_buffers_with_gain_vector = x86_fma_mix_buffers_with_gain_vector;
+			interleave            = x86_sse_interleave;
+			deinterleave          = x86_sse_deinterleave;
 
 			generic_mix_functions = false;
 
@@ -245,6 +263,11 @@ setup_hardware_optimization (bool try_optimization)
 			mix_buffers_with_gain = x86_sse_avx_mix_buffers_with_gain;
 			mix_buffers_no_gain   = x86_sse_avx_mix_buffers_no_gain;
 			copy_vector           = x86_sse_avx_copy_vector;
+			fill_ramp             = x86_sse_avx_fill_ramp;
+			apply_gain_vector     = x86_sse_avx_apply_gain_vector;
+			mix_buffers_with_gain_vector = x86_sse_avx_mix_buffers_with_gain_vector;
+			interleave            = x86_sse_interleave;
+			deinterleave          = x86_sse_deinterleave;
 
 			generic_mix_functions = false;
 
@@ -258,6 +281,11 @@ setup_hardware_optimization (bool try_optimization)
 			mix_buffers_with_gain = x86_sse_mix_buffers_with_gain;
 			mix_buffers_no_gain   = x86_sse_mix_buffers_no_gain;
 			copy_vector           = default_copy_vector;
+			fill_ramp             = x86_sse_fill_ramp;
+			apply_gain_vector     = x86_sse_apply_gain_vector;
+			mix_buffers_with_gain_vector = x86_sse_mix_buffers_with_gain_vector;
+			interleave            = x86_sse_interleave;
+			deinterleave          = x86_sse_deinterleave;
 
 			generic_mix_functions = false;
 		}
@@ -273,6 +301,11 @@ setup_hardware_optimization (bool try_optimization)
 			mix_buffers_with_gain = arm_neon_mix_buffers_with_gain;
 			mix_buffers_no_gain   = arm_neon_mix_buffers_no_gain;
 			copy_vector           = arm_neon_copy_vector;
+			fill_ramp             = arm_neon_fill_ramp;
+			apply_gain_vector     = arm_neon_apply_gain_vector;
+			mix_buffers_with_gain_vector = arm_neon_mix_buffers_with_gain_vector;
+			interleave            = arm_neon_interleave;
+			deinterleave          = arm_neon_deinterleave;
 
 			generic_mix_functions = false;
 		}
@@ -286,6 +319,11 @@ setup_hardware_optimization (bool try_optimization)
 			mix_buffers_with_gain = veclib_mix_buffers_with_gain;
 			mix_buffers_no_gain   = veclib_mix_buffers_no_gain;
 			copy_vector           = default_copy_vector;
+			fill_ramp             = veclib_fill_ramp;
+			apply_gain_vector     = veclib_apply_gain_vector;
+			mix_buffers_with_gain_vector = veclib_mix_buffers_with_gain_vector;
+			interleave            = default_interleave;
+			deinterleave          = default_deinterleave;
 
 			generic_mix_functions = false;
 
@@ -305,12 +343,18 @@ setup_hardware_optimization (bool try_optimization)
 		mix_buffers_with_gain = default_mix_buffers_with_gain;
 		mix_buffers_no_gain   = default_mix_buffers_no_gain;
 		copy_vector           = default_copy_vector;
+		fill_ramp             = default_fill_ramp;
+		apply_gain_vector     = default_apply_gain_vector;
+		mix_buffers_with_gain_vector = default_mix_buffers_with_gain_vector;
+		interleave            = default_interleave;
+		deinterleave          = default_deinterleave;
 
 		info << "No H/W specific optimizations in use" << endmsg;
 	}
 
 	AudioGrapher::Routines::override_compute_peak (compute_peak);
 	AudioGrapher::Routines::override_apply_gain_to_buffer (apply_gain_to_buffer);
+	Evoral::ControlList::override_fill_ramp (fill_ramp);
 }
 
 static void
@@ -842,6 +886,7 @@ ARDOUR::cleanup ()
 
 	Analyser::terminate ();
 	SourceFactory::terminate ();
+	WorkerPool::terminate ();
 
 	release_dma_latency ();
 	config_connection.disconnect ();
@@ -32,9 +32,11 @@
 
 #include "ardour/audioengine.h"
 #include "ardour/debug.h"
+#include "ardour/dsp_trace.h"
 #include "ardour/graph.h"
 #include "ardour/io_plug.h"
 #include "ardour/process_thread.h"
+#include "ardour/rc_configuration.h"
 #include "ardour/route.h"
 #include "ardour/rt_task.h"
 #include "ardour/rt_tasklist.h"
@@ -60,6 +62,10 @@ alloc_allowed ()
 }
 #endif
 
+thread_local int          Graph::_worker_id  = -1;
+thread_local ProcessNode* Graph::_next_node  = 0;
+thread_local uint32_t     Graph::_steal_seed = 0;
+
 Graph::Graph (Session& session)
 	: SessionHandleRef (session)
 	, _execution_sem ("graph_execution", 0)
@@ -67,11 +73,13 @@ Graph::Graph (Session& session)
 	, _callback_done_sem ("graph_done", 0)
 	, _graph_empty (true)
 	, _graph_chain (0)
+	, _work_stealing (false)
 {
 	_terminal_refcnt.store (0);
 	_terminate.store (0);
 	_n_workers.store (0);
 	_idle_thread_cnt.store (0);
+	_pending_wakeups.store (0);
 	_trigger_queue_size.store (0);
 
 	/* pre-allocate memory */
@@ -124,6 +132,13 @@ Graph::reset_thread_list ()
 	/* Allow threads to run */
 	_terminate.store (0);
 
+	/* One work-stealing deque per thread. Only ever grow the list, since
+	 * threads may steal from any of them, at any time.
+	 */
+	while (_worker_queues.size () < num_threads) {
+		_worker_queues.emplace_back (new WorkerQueue (1024));
+	}
+
 	if (AudioEngine::instance ()->create_process_thread (std::bind (&Graph::main_thread, this)) != 0) {
 		throw failed_constructor ();
 	}
@@ -177,6 +192,7 @@ Graph::drop_threads ()
 
 	_n_workers.store (0);
 	_idle_thread_cnt.store (0);
+	_pending_wakeups.store (0);
 
 	/* signal main process thread if it's waiting for an already terminated thread */
 	_callback_done_sem.signal ();
@@ -218,10 +234,22 @@ Graph::prep ()
 		_trigger_queue.reserve (_graph_chain->_nodes_rt.size ());
 	}
 
+	/* All threads are idle at this point, it is safe to change modes.
+	 * The worker deques are not resized here: a thread that was woken
+	 * spuriously may still look for work to steal.
+	 */
+	_work_stealing = Config->get_graph_work_stealing () && _n_workers.load () > 0;
+
 	_terminal_refcnt.store (_graph_chain->_n_terminal_nodes);
 
+	/* Latch the trigger order for this cycle; GraphNode::finish uses it.
+	 * Replaced orders are kept alive by the RCU manager until the next
+	 * resort, so this never drops the last reference.
+	 */
+	_graph_chain->_rt_order = _graph_chain->_trigger_order.reader ();
+
 	/* Trigger the initial nodes for processing, which are the ones at the `input' end */
-	for (auto const& i : _graph_chain->_init_trigger_list) {
+	for (auto const& i : _graph_chain->_rt_order->init_trigger_list) {
 		_trigger_queue_size.fetch_add (1);
 		_trigger_queue.push_back (i.get ());
 	}
@@ -231,9 +259,60 @@ void
 Graph::trigger (ProcessNode* n)
 {
 	_trigger_queue_size.fetch_add (1);
+
+	if (_work_stealing && _worker_id >= 0) {
+		/* The last downstream node that becomes ready is processed
+		 * next by this thread (data is likely still in the cache).
+		 * GraphNode::finish triggers nodes lowest priority first, so
+		 * this is the one with the longest critical path, and the
+		 * thread's LIFO queue pops the remaining ones in priority order.
+		 */
+		ProcessNode* prev = _next_node;
+		_next_node        = n;
+
+		if (!prev) {
+			return;
+		}
+		if (_worker_queues[_worker_id]->push (prev)) {
+			/* Wake up an idle thread to steal it, unless enough
+			 * threads have already been woken for the work that is
+			 * available to other threads (this one runs _next_node).
+			 */
+			uint32_t const pending = _pending_wakeups.load ();
+			if (pending < _idle_thread_cnt.load () && pending + 1 < _trigger_queue_size.load ()) {
+				wake_idle_threads (1);
+			}
+			return;
+		}
+		n = prev;
+	}
+
 	_trigger_queue.push_back (n);
 }
 
+void
+Graph::wake_idle_threads (uint32_t n)
+{
+	_pending_wakeups.fetch_add (n);
+	for (uint32_t i = 0; i < n; ++i) {
+		_execution_sem.signal ();
+	}
+}
+
+void
+Graph::woke_up ()
+{
+	/* signals from drop_threads () are not counted */
+	uint32_t pending = _pending_wakeups.load ();
+	while (pending > 0 && !_pending_wakeups.compare_exchange_weak (pending, pending - 1)) ;
+}
+
+bool
+Graph::reverse_trigger_order () const
+{
+	return _work_stealing && _worker_id >= 0;
+}
+
 /** Called when a node at the `output' end of the chain (ie one that has no-one to feed)
  *  is finished.
  */
@@ -285,6 +364,39 @@ Graph::reached_terminal_node ()
 	}
 }
 
+/** Try to take a node from another thread's deque,
+ * starting with a random victim.
+ */
+ProcessNode*
+Graph::steal_one ()
+{
+	ProcessNode* to_run = NULL;
+	uint32_t const n_queues = _worker_queues.size ();
+
+	if (_steal_seed == 0) {
+		_steal_seed = 2654435761U * (_worker_id + 1);
+	}
+
+	/* xorshift32 */
+	_steal_seed ^= _steal_seed << 13;
+	_steal_seed ^= _steal_seed >> 17;
+	_steal_seed ^= _steal_seed << 5;
+
+	uint32_t const victim = _steal_seed % n_queues;
+
+	for (uint32_t i = 0; i < n_queues; ++i) {
+		uint32_t const v = (victim + i) % n_queues;
+		if ((int)v == _worker_id) {
+			continue;
+		}
+		if (_worker_queues[v]->steal (to_run)) {
+			DEBUG_TRACE (DEBUG::ProcessThreads, string_compose ("%1 stole work from thread %2\n", pthread_name (), v));
+			return to_run;
+		}
+	}
+	return NULL;
+}
+
 /** Called by both the main thread and all helpers. */
 void
 Graph::run_one ()
@@ -295,7 +407,20 @@ Graph::run_one ()
 		return;
 	}
 
-	if (_trigger_queue.pop_front (to_run)) {
+	assert (_worker_id >= 0);
+
+	if (_work_stealing) {
+		/* locality: first try the node that was triggered last by
+		 * this thread, then the thread's own queue (LIFO).
+		 */
+		to_run     = _next_node;
+		_next_node = NULL;
+		if (!to_run) {
+			_worker_queues[_worker_id]->pop (to_run);
+		}
+	}
+
+	if (!to_run && _trigger_queue.pop_front (to_run)) {
 		/* Wake up idle threads, but at most as many as there's
 		 * work in the trigger queue that can be processed by
 		 * other threads.
@@ -306,11 +431,15 @@ Graph::run_one ()
 		uint32_t wakeup     = std::min (idle_cnt + 1, work_avail);
 
 		DEBUG_TRACE (DEBUG::ProcessThreads, string_compose ("%1 signals %2 threads\n", pthread_name (), wakeup));
-		for (guint i = 1; i < wakeup; ++i) {
-			_execution_sem.signal ();
+		if (wakeup > 1) {
+			wake_idle_threads (wakeup - 1);
 		}
 	}
 
+	if (!to_run && _work_stealing) {
+		to_run = steal_one ();
+	}
+
 	while (!to_run) {
 		/* Wait for work, fall asleep */
 		_idle_thread_cnt.fetch_add (1);
@@ -325,10 +454,13 @@ Graph::run_one ()
 
 		DEBUG_TRACE (DEBUG::ProcessThreads, string_compose ("%1 is awake\n", pthread_name ()));
 
+		woke_up ();
 		PBD::atomic_dec_and_test (_idle_thread_cnt);
 
 		/* Try to find some work to do */
-		_trigger_queue.pop_front (to_run);
+		if (!_trigger_queue.pop_front (to_run) && _work_stealing) {
+			to_run = steal_one ();
+		}
 	}
 
 	/* Update the thread-local tempo map ptr.
@@ -349,8 +481,8 @@ Graph::run_one ()
 void
 Graph::helper_thread ()
 {
-	_n_workers.fetch_add (1);
-	uint32_t id = _n_workers.load();
+	uint32_t id = _n_workers.fetch_add (1) + 1;
+	_worker_id  = id;
 
 	/* This is needed for ARDOUR::Session requests called from rt-processors
 	 * in particular Lua scripts may do cross-thread calls */
@@ -364,6 +496,7 @@ Graph::helper_thread ()
 
 	suspend_rt_malloc_checks ();
 	ProcessThread* pt = new ProcessThread ();
+	DSPTrace::thread_init (pthread_name ());
 	resume_rt_malloc_checks ();
 
 	pt->get_buffers ();
@@ -374,6 +507,7 @@ Graph::helper_thread ()
 
 	pt->drop_buffers ();
 	delete pt;
+	DSPTrace::thread_fini ();
 }
 
 /** Here's the main graph thread */
@@ -381,6 +515,7 @@ void
 Graph::main_thread ()
 {
 	/* first time setup */
+	_worker_id = 0;
 
 	suspend_rt_malloc_checks ();
 	ProcessThread* pt = new ProcessThread ();
@@ -394,6 +529,7 @@ Graph::main_thread ()
 		SessionEvent::create_per_thread_pool (name, 64);
 		PBD::notify_event_loops_about_thread_creation (pthread_self (), name, 64);
 	}
+	DSPTrace::thread_init (pthread_name ());
 	resume_rt_malloc_checks ();
 
 	pt->get_buffers ();
@@ -407,6 +543,7 @@ again:
 	if (_terminate.load ()) {
 		pt->drop_buffers ();
 		delete (pt);
+		DSPTrace::thread_fini ();
 		return;
 	}
 
@@ -427,6 +564,7 @@ again:
 
 	pt->drop_buffers ();
 	delete (pt);
+	DSPTrace::thread_fini ();
 }
 
 int
@@ -538,6 +676,8 @@ Graph::process_one_route (Route* route)
 
 	DEBUG_TRACE (DEBUG::ProcessThreads, string_compose ("%1 runs route %2\n", pthread_name (), route->name ()));
 
+	DSPTrace::Timer dt (DSPTrace::RouteProcess, route->id ());
+
 	switch (_process_mode) {
 		case Roll:
 			retval = route->roll (_process_nframes, _process_start_sample, _process_end_sample, need_butler);
@@ -601,9 +741,20 @@ Graph::process_tasklist (RTTaskList const& rt)
 
 /* ****************************************************************************/
 
+/* A node's cost estimate has to change by this much [usec], and by
+ * this fraction, before the chain is re-sorted */
+static const float resort_min_drift = 20.f;
+static const float resort_rel_drift = .25f;
+
+PBD::Mutex GraphChain::_activation_lock;
+
 GraphChain::GraphChain (GraphNodeList const& nodelist, GraphEdges const& edges)
+	: _trigger_order (new TriggerOrder)
 {
 	DEBUG_TRACE (DEBUG::Graph, string_compose ("GraphChain constructed in thread:%1\n", pthread_name ()));
+
+	PBD::Mutex::Lock lm (_activation_lock);
+
 	/* This will become the number of nodes that do not feed any other node;
 	 * once we have processed this number of those nodes, we have finished.
 	 */
@@ -620,6 +771,10 @@ GraphChain::GraphChain (GraphNodeList const& nodelist, GraphEdges const& edges)
 		_nodes_rt.push_back (ni);
 	}
 
+	/* the chain is not in use yet, modify the order in place */
+	std::shared_ptr<TriggerOrder const> to (_trigger_order.reader ());
+	TriggerOrder* order = const_cast<TriggerOrder*> (&(*to));
+
 	/* now add refs for the connections. */
 	for (auto const& ni : _nodes_rt) {
 		/* The nodes that are directly fed by ni */
@@ -633,11 +788,10 @@ GraphChain::GraphChain (GraphNodeList const& nodelist, GraphEdges const& edges)
 			std::shared_ptr<GraphActivision::ActivationMap const> m (ni->_activation_set.reader ());
 			for (auto const& i : fed_from_r) {
 				auto mm = const_cast<GraphActivision::ActivationMap*> (&(*m));
-				auto it = (*mm)[this].insert (i);
-				assert (it.second);
+				(*mm)[this].push_back (i);
 
 				/* Increment the refcount of any node that we directly feed */
-				std::shared_ptr<GraphActivision::RefCntMap const> a ((*it.first)->_init_refcount.reader ());
+				std::shared_ptr<GraphActivision::RefCntMap const> a (i->_init_refcount.reader ());
 				auto aa = const_cast<GraphActivision::RefCntMap*> (&(*a));
 				(*aa)[this] += 1;
 			}
@@ -648,7 +802,7 @@ GraphChain::GraphChain (GraphNodeList const& nodelist, GraphEdges const& edges)
 
 		if (!has_input) {
 			/* no input, so this node needs to be triggered initially to get things going */
-			_init_trigger_list.push_back (ni);
+			order->init_trigger_list.push_back (ni);
 		}
 
 		if (!has_output) {
@@ -658,13 +812,121 @@ GraphChain::GraphChain (GraphNodeList const& nodelist, GraphEdges const& edges)
 			_n_terminal_nodes += 1;
 		}
 	}
+
+	/* Order the initial nodes and each node's downstream nodes, so that
+	 * the nodes with the longest (estimated) path to a terminal node are
+	 * triggered first. This prevents a long chain from being started last,
+	 * stretching the overall cycle time.
+	 */
+	update_critical_path ();
+
+	auto by_critical_path = [this] (node_ptr_t const& a, node_ptr_t const& b) {
+		return _critical_path.at (a) > _critical_path.at (b);
+	};
+
+	for (auto const& ni : _nodes_rt) {
+		node_list_t& as (order->activation_set[ni.get ()]);
+		as = ni->activation_set (this);
+		as.sort (by_critical_path);
+	}
+
+	order->init_trigger_list.sort (by_critical_path);
+
 	dump ();
 }
 
+bool
+GraphChain::resort ()
+{
+	PBD::Mutex::Lock lm (_activation_lock);
+
+	bool drift = false;
+	for (auto const& ni : _nodes_rt) {
+		float const was = _sorted_cost[ni];
+		float const now = ni->cost_estimate ();
+		if (fabsf (now - was) > std::max (resort_min_drift, resort_rel_drift * was)) {
+			drift = true;
+			break;
+		}
+	}
+
+	if (!drift) {
+		return false;
+	}
+
+	update_critical_path ();
+
+	auto by_critical_path = [this] (node_ptr_t const& a, node_ptr_t const& b) {
+		return _critical_path.at (a) > _critical_path.at (b);
+	};
+
+	/* The process threads may be using the current order,
+	 * publish a new one if anything changed.
+	 */
+	std::shared_ptr<TriggerOrder const> cur (_trigger_order.reader ());
+	TriggerOrder                        order (*cur);
+
+	for (auto& as : order.activation_set) {
+		as.second.sort (by_critical_path);
+	}
+	order.init_trigger_list.sort (by_critical_path);
+
+	bool const changed = order.init_trigger_list != cur->init_trigger_list || order.activation_set != cur->activation_set;
+
+	if (changed) {
+		RCUWriter<TriggerOrder> wt (_trigger_order);
+		*wt.get_copy () = order;
+		DEBUG_TRACE (DEBUG::Graph, "GraphChain re-sorted by cost estimates\n");
+		dump ();
+	}
+
+	return changed;
+}
+
+void
+GraphChain::update_critical_path ()
+{
+	/* use a consistent set of estimates, the process threads keep updating them */
+	_sorted_cost.clear ();
+	for (auto const& ni : _nodes_rt) {
+		_sorted_cost[ni] = ni->cost_estimate ();
+	}
+
+	_critical_path.clear ();
+	for (auto const& ni : _nodes_rt) {
+		critical_path (ni);
+	}
+}
+
+/** Longest path from the given node to a terminal node, weighted by
+ * each node's recent processing time (see GraphNode::cost_estimate).
+ */
+float
+GraphChain::critical_path (node_ptr_t const& n)
+{
+	auto i = _critical_path.find (n);
+	if (i != _critical_path.end ()) {
+		return i->second;
+	}
+
+	float downstream = 0;
+	for (auto const& a : n->activation_set (this)) {
+		downstream = std::max (downstream, critical_path (a));
+	}
+
+	/* Count every node, so that the topology is taken into account
+	 * before any timing information is available. */
+	float cp = std::max (1.f, _sorted_cost.at (n)) + downstream;
+
+	_critical_path[n] = cp;
+	return cp;
+}
+
 GraphChain::~GraphChain ()
 {
 	/* clear chain */
 	DEBUG_TRACE (DEBUG::Graph, string_compose ("~GraphChain destroyed in thread:%1\n", pthread_name ()));
+	PBD::Mutex::Lock lm (_activation_lock);
 	for (auto const& ni : _nodes_rt) {
 		RCUWriter<GraphActivision::ActivationMap>         wa (ni->_activation_set);
 		RCUWriter<GraphActivision::RefCntMap>             wr (ni->_init_refcount);
@@ -678,9 +940,7 @@ GraphChain::~GraphChain ()
 bool
 GraphChain::plot (std::string const& file_name) const
 {
-	node_list_t::const_iterator ni;
-	node_set_t::const_iterator  ai;
-	stringstream                ss;
+	stringstream ss;
 
 	ss << "digraph {\n";
 	ss << "  node [shape = ellipse];\n";
@@ -726,14 +986,15 @@ GraphChain::dump () const
 #ifndef NDEBUG
 	DEBUG_TRACE (DEBUG::Graph, "--8<-- Graph dump ----------------------------\n");
 	for (auto const& ni : _nodes_rt) {
-		DEBUG_TRACE (DEBUG::Graph, string_compose ("GraphNode: %1  refcount: %2\n", ni->graph_node_name (), ni->init_refcount (this)));
+		DEBUG_TRACE (DEBUG::Graph, string_compose ("GraphNode: %1  refcount: %2  critical-path: %3 us\n", ni->graph_node_name (), ni->init_refcount (this), _critical_path.at (ni)));
 		for (auto const& ai : ni->activation_set (this)) {
 			DEBUG_TRACE (DEBUG::Graph, string_compose ("  triggers: %1\n", ai->graph_node_name ()));
 		}
 	}
 
 	DEBUG_TRACE (DEBUG::Graph, " --- trigger list ---\n");
-	for (auto const& ni : _init_trigger_list) {
+	std::shared_ptr<TriggerOrder const> order (_trigger_order.reader ());
+	for (auto const& ni : order->init_trigger_list) {
 		DEBUG_TRACE (DEBUG::Graph, string_compose ("GraphNode: %1  refcount: %2\n", ni->graph_node_name (), ni->init_refcount (this)));
 	}
 
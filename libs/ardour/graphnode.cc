@@ -19,6 +19,7 @@
  */
 
 #include "pbd/atomic.h"
+#include "pbd/microseconds.h"
 
 #include "ardour/graphnode.h"
 #include "ardour/graph.h"
@@ -32,7 +33,7 @@ GraphActivision::GraphActivision ()
 {
 }
 
-node_set_t const&
+node_list_t const&
 GraphActivision::activation_set (GraphChain const* const g) const
 {
 	std::shared_ptr<ActivationMap const> m (_activation_set.reader ());
@@ -58,6 +59,7 @@ GraphNode::GraphNode (std::shared_ptr<Graph> graph)
 	: _graph (graph)
 {
 	_refcount.store (0);
+	_cost_estimate.store (0);
 }
 
 void
@@ -70,10 +72,27 @@ GraphNode::prep (GraphChain const* chain)
 void
 GraphNode::run (GraphChain const* chain)
 {
+	PBD::microseconds_t t0 = PBD::get_microseconds ();
 	process ();
+	PBD::microseconds_t t1 = PBD::get_microseconds ();
+
+	if (t1 > t0) {
+		update_cost_estimate ((float)(t1 - t0));
+	}
+
 	finish (chain);
 }
 
+void
+GraphNode::update_cost_estimate (float usec)
+{
+	/* Only the thread running this node writes the estimate,
+	 * GraphChain reads it when sorting nodes by critical path.
+	 */
+	float c = _cost_estimate.load (std::memory_order_relaxed);
+	_cost_estimate.store (c + .125f * (usec - c), std::memory_order_relaxed);
+}
+
 /** Called by an upstream node, when it has completed processing */
 void
 GraphNode::trigger ()
@@ -92,13 +111,24 @@ GraphNode::trigger ()
 void
 GraphNode::finish (GraphChain const* chain)
 {
-	node_set_t::iterator i;
-	bool                 feeds = false;
+	bool feeds = false;
+
+	/* in the order latched by Graph::prep, see GraphChain::resort */
+	node_list_t const& as = chain->activation_set (this);
 
-	/* Notify downstream nodes that depend on this node */
-	for (auto const& i : activation_set (chain)) {
-		i->trigger ();
-		feeds = true;
+	/* Notify downstream nodes that depend on this node,
+	 * those on the critical path first, unless the graph
+	 * prefers them in reverse (see Graph::trigger). */
+	if (_graph->reverse_trigger_order ()) {
+		for (auto i = as.rbegin (); i != as.rend (); ++i) {
+			(*i)->trigger ();
+			feeds = true;
+		}
+	} else {
+		for (auto const& i : as) {
+			i->trigger ();
+			feeds = true;
+		}
 	}
 
 	if (!feeds) {
@@ -55,6 +55,7 @@
 #include "ardour/disk_reader.h"
 #include "ardour/disk_writer.h"
 #include "ardour/dsp_filter.h"
+#include "ardour/dsp_trace.h"
 #include "ardour/file_source.h"
 #include "ardour/filesystem_paths.h"
 #include "ardour/fluid_synth.h"
@@ -277,6 +278,7 @@ CLASSKEYS(ARDOUR::ChanCount);
 CLASSKEYS(ARDOUR::ChanMapping);
 CLASSKEYS(ARDOUR::CoreSelection);
 CLASSKEYS(ARDOUR::DSP::DspShm);
+CLASSKEYS(ARDOUR::DSPTrace::Stats);
 CLASSKEYS(ARDOUR::DataType);
 CLASSKEYS(ARDOUR::FluidSynth);
 CLASSKEYS(ARDOUR::InternalSend);
@@ -325,6 +327,7 @@ CLASSKEYS(std::list<ARDOUR::TimelineRange>);
 
 CLASSKEYS(std::vector<Evoral::Parameter>);
 CLASSKEYS(std::vector<ARDOUR::Plugin::PresetRecord>);
+CLASSKEYS(std::vector<ARDOUR::DSPTrace::Stats>);
 
 CLASSKEYS(std::vector<std::shared_ptr<ARDOUR::Processor> >);
 CLASSKEYS(std::vector<std::shared_ptr<ARDOUR::Source> >);
@@ -348,6 +351,7 @@ CLASSKEYS(std::shared_ptr<ARDOUR::Automatable>);
 CLASSKEYS(std::shared_ptr<ARDOUR::AutomatableSequence<Temporal::Beats> >);
 CLASSKEYS(std::shared_ptr<ARDOUR::AutomationList>);
 CLASSKEYS(std::shared_ptr<ARDOUR::Bundle>);
+CLASSKEYS(std::shared_ptr<ARDOUR::DSPTrace>);
 CLASSKEYS(std::shared_ptr<ARDOUR::FileSource>);
 CLASSKEYS(std::shared_ptr<ARDOUR::MidiModel>);
 CLASSKEYS(std::shared_ptr<ARDOUR::MidiPlaylist>);
@@ -1591,6 +1595,30 @@ LuaBindings::common (lua_State* L)
 		.addFunction ("set_note_mode", &MidiPlaylist::set_note_mode)
 		.endClass ()
 
+		.beginClass <DSPTrace::Stats> ("DSPTraceStats")
+		.addData ("name", &DSPTrace::Stats::name, false)
+		.addData ("kind", &DSPTrace::Stats::kind, false)
+		.addData ("count", &DSPTrace::Stats::count, false)
+		.addData ("min", &DSPTrace::Stats::min, false)
+		.addData ("max", &DSPTrace::Stats::max, false)
+		.addData ("p99", &DSPTrace::Stats::p99, false)
+		.addData ("avg", &DSPTrace::Stats::avg, false)
+		.endClass ()
+
+		.beginStdVector <DSPTrace::Stats> ("DSPTraceStatsVector")
+		.endClass ()
+
+		.beginWSPtrClass <DSPTrace> ("DSPTrace")
+		.addFunction ("set_enabled", &DSPTrace::set_enabled)
+		.addFunction ("enabled", &DSPTrace::get_enabled)
+		.addFunction ("reset", &DSPTrace::reset)
+		.addFunction ("stats", &DSPTrace::stats)
+		.addFunction ("dropped", &DSPTrace::dropped)
+		.addFunction ("capture", &DSPTrace::capture)
+		.addFunction ("capture_complete", &DSPTrace::capture_complete)
+		.addFunction ("write_chrome_trace", &DSPTrace::write_chrome_trace)
+		.endClass ()
+
 		.beginWSPtrClass <SessionPlaylists> ("SessionPlaylists")
 		.addFunction ("by_name", &SessionPlaylists::by_name)
 		.addFunction ("by_id", &SessionPlaylists::by_id)
@@ -3149,6 +3177,7 @@ LuaBindings::common (lua_State* L)
 		.addFunction ("get_stripables", (StripableList (Session::*)() const)&Session::get_stripables)
 		.addFunction ("get_routelist", &Session::get_routelist)
 		.addFunction ("plot_process_graph", &Session::plot_process_graph)
+		.addFunction ("dsp_trace", &Session::dsp_trace)
 
 		.addFunction ("bundles", &Session::bundles)
 
@@ -444,6 +444,56 @@ PeakMeter::meter_level (uint32_t n, MeterType type)
 	return minus_infinity ();
 }
 
+float
+PeakMeter::meter_coefficient (uint32_t n, MeterType type)
+{
+	if (_reset_max.load ()) {
+		if (n < current_meters.n_midi () && type != MeterMaxPeak) {
+			return GAIN_COEFF_UNITY;
+		} else {
+			return GAIN_COEFF_ZERO;
+		}
+	}
+
+	const uint32_t n_midi = current_meters.n_midi ();
+
+	switch (type) {
+		case MeterKrms:
+		case MeterK20:
+		case MeterK14:
+		case MeterK12:
+			if (CHECKSIZE (_kmeter)) {
+				return _kmeter[n - n_midi]->read ();
+			}
+			break;
+		case MeterIEC1DIN:
+		case MeterIEC1NOR:
+			if (CHECKSIZE (_iec1meter)) {
+				return _iec1meter[n - n_midi]->read ();
+			}
+			break;
+		case MeterIEC2BBC:
+		case MeterIEC2EBU:
+			if (CHECKSIZE (_iec2meter)) {
+				return _iec2meter[n - n_midi]->read ();
+			}
+			break;
+		case MeterVU:
+			if (CHECKSIZE (_vumeter)) {
+				return _vumeter[n - n_midi]->read ();
+			}
+			break;
+		case MeterMaxPeak:
+			if (n < _max_peak_signal.size ()) {
+				return _max_peak_signal[n];
+			}
+			break;
+		default:
+			return dB_to_coefficient (meter_level (n, type));
+	}
+	return GAIN_COEFF_ZERO;
+}
+
 void
 PeakMeter::set_meter_type (MeterType t)
 {
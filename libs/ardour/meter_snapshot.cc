@@ -0,0 +1,139 @@
+/*
+ * Copyright (C) 2026 Ardour Developers
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+
+#include <cmath>
+#include <limits>
+
+#include "ardour/dB.h"
+#include "ardour/meter.h"
+#include "ardour/meter_snapshot.h"
+
+using namespace ARDOUR;
+
+MeterSnapshot::MeterSnapshot ()
+	: sample (0)
+	, n_routes (0)
+	, channels_used (0)
+{
+}
+
+MeterSnapshot::MeterSnapshot (uint32_t max_routes, uint32_t max_channels)
+	: sample (0)
+	, n_routes (0)
+	, channels_used (0)
+	, route_id (max_routes, PBD::ID (0))
+	, meter_type (max_routes, MeterPeak)
+	, first_channel (max_routes, 0)
+	, n_channels (max_routes, 0)
+	, n_midi (max_routes, 0)
+	, mcp (max_routes, -std::numeric_limits<float>::infinity ())
+	, peak (max_channels, -std::numeric_limits<float>::infinity ())
+	, max_peak (max_channels, GAIN_COEFF_ZERO)
+	, level (max_channels, GAIN_COEFF_ZERO)
+{
+}
+
+int
+MeterSnapshot::route_index (PBD::ID const& id) const
+{
+	for (uint32_t r = 0; r < n_routes; ++r) {
+		if (route_id[r] == id) {
+			return r;
+		}
+	}
+	return -1;
+}
+
+static bool
+type_has_level (MeterType type)
+{
+	switch (type) {
+		case MeterKrms:
+		case MeterK20:
+		case MeterK14:
+		case MeterK12:
+		case MeterIEC1DIN:
+		case MeterIEC1NOR:
+		case MeterIEC2BBC:
+		case MeterIEC2EBU:
+		case MeterVU:
+			return true;
+		default:
+			return false;
+	}
+}
+
+float
+MeterSnapshot::max_peak_db (uint32_t c) const
+{
+	return accurate_coefficient_to_dB (max_peak[c]);
+}
+
+float
+MeterSnapshot::level_db (uint32_t r, uint32_t c) const
+{
+	if (!type_has_level (meter_type[r]) || c < first_channel[r] + n_midi[r]) {
+		return peak[c];
+	}
+	return accurate_coefficient_to_dB (level[c]);
+}
+
+void
+MeterSnapshot::clear (samplepos_t when)
+{
+	sample        = when;
+	n_routes      = 0;
+	channels_used = 0;
+}
+
+bool
+MeterSnapshot::add (PBD::ID const& id, PeakMeter& meter)
+{
+	ChanCount const  streams = meter.input_streams ();
+	uint32_t const   n_ch    = streams.n_total ();
+
+	if (n_routes >= max_routes () || channels_used + n_ch > max_channels ()) {
+		return false;
+	}
+
+	MeterType const type = meter.meter_type ();
+	uint32_t const  r    = n_routes;
+	uint32_t const  n_md = streams.n_midi ();
+
+	route_id[r]      = id;
+	meter_type[r]    = type;
+	first_channel[r] = channels_used;
+	n_channels[r]    = n_ch;
+	n_midi[r]        = n_md;
+	mcp[r]           = meter.meter_level (0, MeterMCP);
+
+	bool const has_level = type_has_level (type);
+
+	/* no dB conversion here, peak is kept in dB by the meter */
+	for (uint32_t c = 0; c < n_ch; ++c) {
+		uint32_t const i = channels_used + c;
+		peak[i]     = meter.meter_level (c, MeterPeak);
+		max_peak[i] = meter.meter_coefficient (c, MeterMaxPeak);
+		level[i]    = has_level && c >= n_md ? meter.meter_coefficient (c, type) : GAIN_COEFF_ZERO;
+	}
+
+	++n_routes;
+	channels_used += n_ch;
+	return true;
+}
@@ -145,6 +145,46 @@ default_copy_vector (ARDOUR::Sample * dst, const ARDOUR::Sample * src, pframes_t
 	memcpy(dst, src, nframes*sizeof(ARDOUR::Sample));
 }
 
+void
+default_fill_ramp (ARDOUR::Sample * dst, pframes_t nframes, float start, float step)
+{
+	for (pframes_t i = 0; i < nframes; i++) {
+		dst[i] = start + i * step;
+	}
+}
+
+void
+default_apply_gain_vector (ARDOUR::Sample * buf, const ARDOUR::gain_t * gain, pframes_t nframes)
+{
+	for (pframes_t i = 0; i < nframes; i++) {
+		buf[i] *= gain[i];
+	}
+}
+
+void
+default_mix_buffers_with_gain_vector (ARDOUR::Sample * dst, const ARDOUR::Sample * src, const ARDOUR::gain_t * gain, pframes_t nframes)
+{
+	for (pframes_t i = 0; i < nframes; i++) {
+		dst[i] += src[i] * gain[i];
+	}
+}
+
+void
+default_interleave (ARDOUR::Sample * dst, const ARDOUR::Sample * src, uint32_t stride, pframes_t nframes)
+{
+	for (pframes_t i = 0; i < nframes; i++) {
+		dst[i * stride] = src[i];
+	}
+}
+
+void
+default_deinterleave (ARDOUR::Sample * dst, const ARDOUR::Sample * src, uint32_t stride, pframes_t nframes)
+{
+	for (pframes_t i = 0; i < nframes; i++) {
+		dst[i] = src[i * stride];
+	}
+}
+
 #if defined (__APPLE__) && defined (BUILD_VECLIB_OPTIMIZATIONS)
 #include <Accelerate/Accelerate.h>
 
@@ -187,6 +227,24 @@ veclib_mix_buffers_no_gain (ARDOUR::Sample * dst, const ARDOUR::Sample * src, pf
 	vDSP_vsma(src, 1, &gain, dst, 1, dst, 1, nframes);
 }
 
+void
+veclib_fill_ramp (ARDOUR::Sample * dst, pframes_t nframes, float start, float step)
+{
+	vDSP_vramp(&start, &step, dst, 1, nframes);
+}
+
+void
+veclib_apply_gain_vector (ARDOUR::Sample * buf, const ARDOUR::gain_t * gain, pframes_t nframes)
+{
+	vDSP_vmul(buf, 1, gain, 1, buf, 1, nframes);
+}
+
+void
+veclib_mix_buffers_with_gain_vector (ARDOUR::Sample * dst, const ARDOUR::Sample * src, const ARDOUR::gain_t * gain, pframes_t nframes)
+{
+	vDSP_vma(src, 1, gain, 1, dst, 1, dst, 1, nframes);
+}
+
 #endif
 
 
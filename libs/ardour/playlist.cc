@@ -65,6 +65,8 @@ namespace ARDOUR {
 	}
 }
 
+std::atomic<bool> Playlist::_region_index_enabled (true);
+
 struct ShowMeTheList {
 	ShowMeTheList (std::shared_ptr<Playlist> pl, const string& n)
 		: playlist (pl)
@@ -351,6 +353,8 @@ Playlist::init (bool hide)
 	_combine_ops                = 0;
 
 	_refcnt.store (0);
+	_region_index_serial.store (0);
+	_region_index_blocked.store (0);
 
 	_end_space = timecnt_t (_type == DataType::AUDIO ? Temporal::AudioTime : Temporal::BeatTime);
 	_playlist_shift_active = false;
@@ -1691,6 +1695,13 @@ Playlist::region_changed (const PropertyChange& what_changed, std::shared_ptr<Re
 	PropertyChange bounds;
 	bool           save = false;
 
+	if (what_changed.contains (Properties::length) || what_changed.contains (Properties::region_fx) || what_changed.contains (Properties::time_domain)) {
+		/* this may happen without the region write-lock (e.g. during
+		 * set_state), the index is rebuilt when it is next used.
+		 */
+		invalidate_region_index ();
+	}
+
 	if (in_set_state || in_flush) {
 		return false;
 	}
@@ -1825,6 +1836,18 @@ Playlist::count_regions_at (timepos_t const & pos) const
 	RegionReadLock rlock (const_cast<Playlist*> (this));
 	uint32_t       cnt = 0;
 
+	std::shared_ptr<RegionIndex const> idx (region_index ());
+
+	if (idx) {
+		auto c = idx->candidates (pos, pos);
+		for (auto i = c.first; i != c.second; ++i) {
+			if (i->region->covers (pos)) {
+				cnt++;
+			}
+		}
+		return cnt;
+	}
+
 	for (auto const & r : regions) {
 		if (r->covers (pos)) {
 			cnt++;
@@ -1958,6 +1981,18 @@ Playlist::find_regions_at (timepos_t const & pos)
 
 	std::shared_ptr<RegionList> rlist (new RegionList);
 
+	std::shared_ptr<RegionIndex const> idx (region_index ());
+
+	if (idx) {
+		auto c = idx->candidates (pos, pos);
+		for (auto i = c.first; i != c.second; ++i) {
+			if (i->region->covers (pos)) {
+				rlist->push_back (i->region);
+			}
+		}
+		return rlist;
+	}
+
 	for (auto & r : regions) {
 		if (r->covers (pos)) {
 			rlist->push_back (r);
@@ -1967,12 +2002,137 @@ Playlist::find_regions_at (timepos_t const & pos)
 	return rlist;
 }
 
+/* Below this size, a linear search of the region list is as fast as using
+ * (and building) the index.
+ */
+static const size_t region_index_min_size = 64;
+
+std::pair<Playlist::RegionIndex::const_iterator, Playlist::RegionIndex::const_iterator>
+Playlist::RegionIndex::candidates (timepos_t const& s, timepos_t const& e) const
+{
+	/* entries are sorted by start; max_last is non-decreasing */
+
+	const_iterator last = std::upper_bound (entries.begin (), entries.end (), e,
+	                                        [] (timepos_t const& t, Entry const& x) { return t < x.start; });
+
+	const_iterator first = std::lower_bound (entries.begin (), last, s,
+	                                         [] (Entry const& x, timepos_t const& t) { return x.max_last < t; });
+
+	return std::make_pair (first, last);
+}
+
+std::shared_ptr<Playlist::RegionIndex const>
+Playlist::region_index () const
+{
+	/* Caller must hold lock */
+
+	if (!_region_index_enabled.load () || _region_index_blocked.load () > 0) {
+		/* disabled, or regions are being modified by the holder of the write-lock */
+		return std::shared_ptr<RegionIndex const> ();
+	}
+
+	PBD::Mutex::Lock lm (_region_index_lock);
+
+	uint64_t serial = _region_index_serial.load ();
+
+	if (!_region_index || _region_index->serial != serial) {
+
+		std::shared_ptr<RegionIndex> idx (new RegionIndex);
+
+		idx->serial        = serial;
+		idx->usable        = regions.size () >= region_index_min_size;
+		idx->has_region_fx = false;
+
+		if (idx->usable) {
+
+			/* The index relies on the region list being sorted by
+			 * position, and on the order of positions not depending
+			 * on the tempo map. Fall back to a linear search if
+			 * either is not the case.
+			 */
+
+			Temporal::TimeDomain td = regions.front ()->position ().time_domain ();
+
+			idx->entries.reserve (regions.size ());
+
+			for (auto const& r : regions) {
+				timepos_t const pos (r->position ());
+
+				if (pos.time_domain () != td || r->length ().time_domain () != td) {
+					idx->usable = false;
+					break;
+				}
+
+				if (!idx->entries.empty () && pos < idx->entries.back ().start) {
+					idx->usable = false;
+					break;
+				}
+
+				timepos_t last (r->nt_last ());
+
+				if (!idx->entries.empty () && last < idx->entries.back ().max_last) {
+					last = idx->entries.back ().max_last;
+				}
+
+				idx->entries.push_back (RegionIndex::Entry (r, pos, last));
+
+				if (r->has_region_fx ()) {
+					idx->has_region_fx = true;
+				}
+			}
+
+			if (!idx->usable) {
+				idx->entries.clear ();
+			}
+		}
+
+		_region_index = idx;
+	}
+
+	if (!_region_index->usable) {
+		return std::shared_ptr<RegionIndex const> ();
+	}
+
+	return _region_index;
+}
+
+void
+Playlist::block_region_index ()
+{
+	/* called with the write-lock held; drop the index, so that it does
+	 * not hold references to regions which are being removed.
+	 */
+	_region_index_blocked.fetch_add (1);
+
+	PBD::Mutex::Lock lm (_region_index_lock);
+	_region_index.reset ();
+}
+
+void
+Playlist::unblock_region_index ()
+{
+	invalidate_region_index ();
+	_region_index_blocked.fetch_sub (1);
+}
+
 std::shared_ptr<RegionList>
 Playlist::regions_with_start_within (Temporal::Range range)
 {
 	RegionReadLock              rlock (this);
 	std::shared_ptr<RegionList> rlist (new RegionList);
 
+	std::shared_ptr<RegionIndex const> idx (region_index ());
+
+	if (idx) {
+		auto c = idx->candidates (range.start (), range.end ());
+		for (auto i = c.first; i != c.second; ++i) {
+			if (i->start >= range.start () && i->start < range.end ()) {
+				rlist->push_back (i->region);
+			}
+		}
+		return rlist;
+	}
+
 	for (auto & r : regions) {
 		if (r->position() >= range.start() && r->position() < range.end()) {
 			rlist->push_back (r);
@@ -2009,6 +2169,19 @@ Playlist::regions_touched_locked (timepos_t const & start, timepos_t const & end
 {
 	std::shared_ptr<RegionList> rlist (new RegionList);
 
+	std::shared_ptr<RegionIndex const> idx (region_index ());
+
+	/* the index does not know about region FX tails */
+	if (idx && !(with_tail && idx->has_region_fx)) {
+		auto c = idx->candidates (start, end);
+		for (auto i = c.first; i != c.second; ++i) {
+			if (i->region->coverage (start, end, with_tail) != Temporal::OverlapNone) {
+				rlist->push_back (i->region);
+			}
+		}
+		return rlist;
+	}
+
 	for (auto & r : regions) {
 		if (r->coverage (start, end, with_tail) != Temporal::OverlapNone) {
 			rlist->push_back (r);
@@ -2083,6 +2256,31 @@ Playlist::find_next_region (timepos_t const & pos, RegionPoint point, int dir)
 	std::shared_ptr<Region> ret;
 	timecnt_t closest = timecnt_t::max (pos.time_domain());
 
+	std::shared_ptr<RegionIndex const> idx;
+
+	if (point == Start && (idx = region_index ())) {
+		if (dir == 1) {
+			/* first region starting after pos */
+			auto i = std::upper_bound (idx->entries.begin (), idx->entries.end (), pos,
+			                           [] (timepos_t const& t, RegionIndex::Entry const& x) { return t < x.start; });
+			if (i != idx->entries.end ()) {
+				ret = i->region;
+			}
+		} else {
+			/* first of the last regions starting before pos */
+			auto i = std::lower_bound (idx->entries.begin (), idx->entries.end (), pos,
+			                           [] (RegionIndex::Entry const& x, timepos_t const& t) { return x.start < t; });
+			if (i != idx->entries.begin ()) {
+				--i;
+				while (i != idx->entries.begin () && (i - 1)->start == i->start) {
+					--i;
+				}
+				ret = i->region;
+			}
+		}
+		return ret;
+	}
+
 	bool end_iter = false;
 
 	for (auto const & r : regions) {
@@ -37,6 +37,7 @@
 #include "ardour/automation_list.h"
 #include "ardour/buffer_set.h"
 #include "ardour/debug.h"
+#include "ardour/dsp_trace.h"
 #include "ardour/event_type_map.h"
 #include "ardour/ladspa_plugin.h"
 #include "ardour/luaproc.h"
@@ -1346,6 +1347,8 @@ PluginInsert::run (BufferSet& bufs, samplepos_t start_sample, samplepos_t end_sa
 	}
 
 	if (_pending_active) {
+		DSPTrace::Timer dt (DSPTrace::PluginRun, id ());
+
 #if defined MIXBUS && defined NDEBUG
 		if (!is_channelstrip ()) {
 			_timing_stats.start ();
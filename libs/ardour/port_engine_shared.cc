@@ -18,6 +18,7 @@
  * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
  */
 
+#include <cstring>
 #include <regex>
 
 #include "glibmm/threads.h"
@@ -26,6 +27,7 @@
 #include "ardour/audioengine.h"
 #include "ardour/port_engine_shared.h"
 #include "ardour/port_manager.h"
+#include "ardour/runtime_functions.h"
 
 #include "pbd/i18n.h"
 
@@ -35,6 +37,7 @@ BackendPort::BackendPort (PortEngineSharedImpl &b, const std::string& name, Port
 	: _backend (b)
 	, _name  (name)
 	, _flags (flags)
+	, _mix_plan (new MixPlan)
 {
 	_capture_latency_range.min = 0;
 	_capture_latency_range.max = 0;
@@ -105,6 +108,7 @@ BackendPort::store_connection (BackendPortHandle port)
 	 */
 	PBD::Mutex::Lock lm (AudioEngine::instance()->process_lock (), PBD::Mutex::TryLock);
 	_connections.insert (port);
+	update_mix_plan ();
 }
 
 int
@@ -141,6 +145,7 @@ void BackendPort::remove_connection (BackendPortHandle port)
 	std::set<BackendPortPtr>::iterator it = _connections.find (port);
 	assert (it != _connections.end ());
 	_connections.erase (it);
+	update_mix_plan ();
 }
 
 
@@ -158,6 +163,51 @@ void BackendPort::disconnect_all (BackendPortHandle self)
 		_backend.port_connect_callback (name(), (*it)->name(), false);
 		_connections.erase (it);
 	}
+	update_mix_plan ();
+}
+
+void
+BackendPort::update_mix_plan ()
+{
+	if (!is_input () || type () != DataType::AUDIO) {
+		return;
+	}
+
+	RCUWriter<MixPlan> writer (_mix_plan);
+	std::shared_ptr<MixPlan> plan = writer.get_copy ();
+
+	plan->ports.clear ();
+	plan->buffers.clear ();
+
+	for (std::set<BackendPortPtr>::const_iterator it = _connections.begin (); it != _connections.end (); ++it) {
+		assert ((*it)->is_output () && (*it)->const_audio_buffer ());
+		plan->ports.push_back (*it);
+		plan->buffers.push_back ((*it)->const_audio_buffer ());
+	}
+}
+
+void*
+BackendPort::mix_connections (Sample* buf, pframes_t n_samples) const
+{
+	std::shared_ptr<MixPlan const> plan = _mix_plan.reader ();
+	std::vector<const Sample*> const& src (plan->buffers);
+
+	switch (src.size ()) {
+		case 0:
+			memset (buf, 0, n_samples * sizeof (Sample));
+			return buf;
+		case 1:
+			/* zero-copy, the caller only reads input ports */
+			return const_cast<Sample*> (src[0]);
+		default:
+			break;
+	}
+
+	copy_vector (buf, src[0], n_samples);
+	for (size_t i = 1; i < src.size (); ++i) {
+		mix_buffers_no_gain (buf, src[i], n_samples);
+	}
+	return buf;
 }
 
 bool
@@ -4367,7 +4367,7 @@ Route::roll (pframes_t nframes, samplepos_t start_sample, samplepos_t end_sample
 
 	run_route (start_sample, end_sample, nframes, (!_disk_writer || !_disk_writer->record_enabled()) && _session.transport_rolling(), true);
 
-	if ((_disk_reader && _disk_reader->need_butler()) || (_disk_writer && _disk_writer->need_butler())) {
+	if ((_disk_reader && _disk_reader->need_butler()) || (_disk_writer && _disk_writer->need_butler()) || (_triggerbox && _triggerbox->need_butler())) {
 		need_butler = true;
 	}
 	return 0;
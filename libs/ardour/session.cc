@@ -76,6 +76,7 @@
 #include "ardour/data_type.h"
 #include "ardour/debug.h"
 #include "ardour/disk_reader.h"
+#include "ardour/dsp_trace.h"
 #include "ardour/directory_names.h"
 #include "ardour/filename_extensions.h"
 #include "ardour/gain_control.h"
@@ -255,6 +256,8 @@ Session::Session (AudioEngine &eng,
 	, _save_queued (false)
 	, _save_queued_pending (false)
 	, _no_save_signal (false)
+	, _state_writer (0)
+	, _saving_state (false)
 	, _last_roll_location (0)
 	, _last_roll_or_reversal_location (0)
 	, _last_record_location (0)
@@ -308,6 +311,9 @@ Session::Session (AudioEngine &eng,
 	, midi_control_ui (0)
 	, _punch_or_loop (NoConstraint)
 	, routes (new RouteList)
+	, _meter_snapshot (new MeterSnapshotBufferPtr)
+	, _meter_snapshot_resize (1)
+	, _meter_snapshot_read (0)
 	, _adding_routes_in_progress (false)
 	, _reconnecting_routes_in_progress (false)
 	, _route_deletion_in_progress (false)
@@ -342,6 +348,8 @@ Session::Session (AudioEngine &eng,
 	, roll_started_loop (false)
 	, _step_editors (0)
 	,  _speakers (new Speakers)
+	, _graph_resort_samples (0)
+	, _graph_resort_pending (0)
 	, _ignore_route_processor_changes (0)
 	, _ignored_a_processor_change (0)
 	, midi_clock (0)
@@ -615,6 +623,7 @@ Session::immediately_post_engine ()
 
 	_process_graph.reset (new Graph (*this));
 	_rt_tasklist.reset (new RTTaskList (_process_graph));
+	_dsp_trace.reset (new DSPTrace (*this));
 
 	_io_tasklist.reset (new IOTaskList (how_many_io_threads ()));
 
@@ -663,6 +672,7 @@ Session::destroy ()
 	 * is a mistake.
 	 */
 
+	wait_for_state_writer ();
 	remove_pending_capture_state ();
 
 	Analyser::flush ();
@@ -742,12 +752,14 @@ Session::destroy ()
 	Stateful::loading_state_version = 0;
 
 	/* drop GraphNode references */
-	_graph_chain.reset ();
+	{
+		PBD::Mutex::Lock lm (_graph_chain_lock);
+		_graph_chain.reset ();
+		_io_graph_chain[0].reset ();
+		_io_graph_chain[1].reset ();
+	}
 	_current_route_graph = GraphEdges ();
 
-	_io_graph_chain[0].reset ();
-	_io_graph_chain[1].reset ();
-
 	_io_tasklist.reset ();
 
 	_butler->drop_references ();
@@ -2614,8 +2626,11 @@ Session::rechain_process_graph (GraphNodeList& g)
 			 * However, the graph-chain may be in use (session process), and the last reference
 			 * be helf by the process-callback. So we delegate deletion to the butler thread.
 			 */
-			_graph_chain = std::shared_ptr<GraphChain> (new GraphChain (g, edges), std::bind (&rt_safe_delete<GraphChain>, this, _1));
+			std::shared_ptr<GraphChain> gc (new GraphChain (g, edges), std::bind (&rt_safe_delete<GraphChain>, this, _1));
+			PBD::Mutex::Lock lm (_graph_chain_lock);
+			_graph_chain = gc;
 		} else {
+			PBD::Mutex::Lock lm (_graph_chain_lock);
 			_graph_chain.reset ();
 		}
 
@@ -2633,6 +2648,7 @@ Session::rechain_ioplug_graph (bool pre)
 	std::shared_ptr<IOPlugList const> io_plugins (_io_plugins.reader ());
 
 	if (io_plugins->empty ()) {
+		PBD::Mutex::Lock lm (_graph_chain_lock);
 		_io_graph_chain[pre ? 0 : 1].reset ();
 		return true;
 	}
@@ -2647,12 +2663,59 @@ Session::rechain_ioplug_graph (bool pre)
 	GraphEdges edges;
 
 	if (topological_sort (gnl, edges)) {
-		_io_graph_chain[pre ? 0 : 1] = std::shared_ptr<GraphChain> (new GraphChain (gnl, edges), std::bind (&rt_safe_delete<GraphChain>, this, _1));
+		std::shared_ptr<GraphChain> gc (new GraphChain (gnl, edges), std::bind (&rt_safe_delete<GraphChain>, this, _1));
+		PBD::Mutex::Lock lm (_graph_chain_lock);
+		_io_graph_chain[pre ? 0 : 1] = gc;
 		return true;
 	}
 	return false;
 }
 
+void
+Session::maybe_resort_process_graph (pframes_t nframes)
+{
+	/* About once a second, let the butler re-order the graph
+	 * using the measured processing time of each node.
+	 */
+	_graph_resort_samples += nframes;
+
+	if (_graph_resort_samples < nominal_sample_rate ()) {
+		return;
+	}
+
+	_graph_resort_samples = 0;
+
+	if (!_graph_chain && !_io_graph_chain[0] && !_io_graph_chain[1]) {
+		return;
+	}
+
+	if (_graph_resort_pending.exchange (1) == 0) {
+		if (!_butler->delegate (sigc::mem_fun (*this, &Session::resort_process_graph))) {
+			_graph_resort_pending.store (0);
+		}
+	}
+}
+
+void
+Session::resort_process_graph ()
+{
+	std::shared_ptr<GraphChain> chains[3];
+	{
+		PBD::Mutex::Lock lm (_graph_chain_lock);
+		chains[0] = _graph_chain;
+		chains[1] = _io_graph_chain[0];
+		chains[2] = _io_graph_chain[1];
+	}
+
+	for (auto const& c : chains) {
+		if (c) {
+			c->resort ();
+		}
+	}
+
+	_graph_resort_pending.store (0);
+}
+
 /** Find a route name starting with \a base, maybe followed by the
  *  lowest \a id.  \a id will always be added if \a definitely_add_number
  *  is true on entry; otherwise it will only be added if required
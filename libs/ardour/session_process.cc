@@ -25,6 +25,8 @@
 #include <cerrno>
 #include <algorithm>
 
+#include <glib.h>
+
 #include "pbd/i18n.h"
 #include "pbd/error.h"
 #include "pbd/enumwriter.h"
@@ -37,8 +39,10 @@
 #include "ardour/butler.h"
 #include "ardour/debug.h"
 #include "ardour/disk_reader.h"
+#include "ardour/dsp_trace.h"
 #include "ardour/graph.h"
 #include "ardour/io_plug.h"
+#include "ardour/meter.h"
 #include "ardour/port.h"
 #include "ardour/process_thread.h"
 #include "ardour/rt_tasklist.h"
@@ -81,6 +85,8 @@ Session::process (pframes_t nframes)
 {
 	TimerRAII tr (dsp_stats[OverallProcess]);
 
+	DSPTrace::cycle_start ();
+
 	if (processing_blocked()) {
 		_silent = true;
 		return;
@@ -119,6 +125,8 @@ Session::process (pframes_t nframes)
 		io_graph_chain.reset (); /* drop reference */
 	}
 
+	maybe_resort_process_graph (nframes);
+
 	/* realtime-safe meter-position and processor-order changes
 	 *
 	 * ideally this would be done in
@@ -170,6 +178,8 @@ Session::process (pframes_t nframes)
 
 	_engine.main_thread()->drop_buffers ();
 
+	publish_meter_snapshot ();
+
 	/* deliver MIDI clock. Note that we need to use the transport sample
 	 * position at the start of process(), not the value at the end of
 	 * it. We may already have ticked() because of a transport state
@@ -185,6 +195,70 @@ Session::process (pframes_t nframes)
 	SendFeedback (); /* EMIT SIGNAL */
 }
 
+void
+Session::publish_meter_snapshot ()
+{
+	if (g_get_monotonic_time () - _meter_snapshot_read.load () > 2000000) {
+		/* nobody asked for meters recently */
+		return;
+	}
+
+	std::shared_ptr<MeterSnapshotBufferPtr const> b = _meter_snapshot.reader ();
+
+	if (!*b) {
+		_meter_snapshot_resize.store (1);
+		return;
+	}
+
+	MeterSnapshot& snapshot = (*b)->write_buffer ();
+	snapshot.clear (_transport_sample);
+
+	std::shared_ptr<RouteList const> r = routes.reader ();
+	for (auto const& i : *r) {
+		if (!snapshot.add (i->id (), *i->peak_meter ())) {
+			/* publish what fits, the next reader grows the buffer */
+			_meter_snapshot_resize.store (1);
+			break;
+		}
+	}
+
+	(*b)->publish ();
+}
+
+void
+Session::resize_meter_snapshot ()
+{
+	uint32_t n_routes   = 0;
+	uint32_t n_channels = 0;
+
+	std::shared_ptr<RouteList const> r = routes.reader ();
+	for (auto const& i : *r) {
+		++n_routes;
+		n_channels += i->peak_meter ()->input_streams ().n_total ();
+	}
+
+	/* leave some headroom for added routes and changed channel counts */
+	n_routes  += 16;
+	n_channels = std::max (2 * n_channels, n_channels + 32);
+
+	RCUWriter<MeterSnapshotBufferPtr>       writer (_meter_snapshot);
+	std::shared_ptr<MeterSnapshotBufferPtr> b = writer.get_copy ();
+	*b = std::make_shared<MeterSnapshotBuffer> (MeterSnapshot (n_routes, n_channels));
+}
+
+bool
+Session::meter_snapshot (MeterSnapshot& snapshot)
+{
+	_meter_snapshot_read.store (g_get_monotonic_time ());
+
+	if (_meter_snapshot_resize.exchange (0)) {
+		resize_meter_snapshot ();
+	}
+
+	std::shared_ptr<MeterSnapshotBufferPtr const> b = _meter_snapshot.reader ();
+	return *b && (*b)->read (snapshot) > 0;
+}
+
 int
 Session::fail_roll (pframes_t nframes)
 {
@@ -222,6 +296,8 @@ Session::no_roll (pframes_t nframes)
 				continue;
 			}
 
+			DSPTrace::Timer dt (DSPTrace::RouteProcess, i->id ());
+
 			if (i->no_roll (nframes, _transport_sample, end_sample, non_realtime_work_pending())) {
 				error << string_compose(_("Session: error in no roll for %1"), i->name()) << endmsg;
 				ret = -1;
@@ -275,6 +351,8 @@ Session::process_routes (pframes_t nframes, bool& need_butler)
 
 			bool b = false;
 
+			DSPTrace::Timer dt (DSPTrace::RouteProcess, i->id ());
+
 			if ((ret = i->roll (nframes, start_sample, end_sample, b)) < 0) {
 				cerr << "ERR1 STOP\n";
 				TFSM_STOP (false, false);
@@ -770,7 +770,7 @@ Session::save_state (string snapshot_name, bool pending, bool switch_to_snapshot
 	/* pending saves are for current snapshot only */
 	assert (!pending || ((snapshot_name.empty () || snapshot_name == _current_snapshot_name) && !template_only && !for_archive));
 
-	XMLTree tree;
+	std::unique_ptr<XMLTree> tree (new XMLTree);
 	std::string xml_path(_session_dir->root_path());
 
 	if (!pending) {
@@ -814,9 +814,11 @@ Session::save_state (string snapshot_name, bool pending, bool switch_to_snapshot
 		fork_state = switch_to_snapshot ? SwitchToSnapshot : SnapshotKeep;
 	}
 
-#ifndef NDEBUG
+	/* a previous pending save may still be writing the state file */
+	wait_for_state_writer ();
+
 	const int64_t save_start_time = g_get_monotonic_time();
-#endif
+	_save_timing.clear ();
 
 	/* tell sources we're saving first, in case they write out to a new file
 	 * which should be saved with the state rather than the old one */
@@ -828,6 +830,8 @@ Session::save_state (string snapshot_name, bool pending, bool switch_to_snapshot
 		}
 	}
 
+	_save_timing.push_back (std::make_pair (X_("Sources (data)"), g_get_monotonic_time() - save_start_time));
+
 	PBD::Unwinder<bool> uw (LV2Plugin::force_state_save, for_archive);
 
 	PBD::Unwinder<PBD::UUID> uw2 (_uuid, fork_state != NormalSave ? PBD::UUID () : _uuid);
@@ -839,11 +843,15 @@ Session::save_state (string snapshot_name, bool pending, bool switch_to_snapshot
 		mark_as_clean = false;
 	}
 
-	if (template_only) {
-		mark_as_clean = false;
-		tree.set_root (&get_template());
-	} else {
-		tree.set_root (&state (false, fork_state, for_archive, only_used_assets));
+	{
+		PBD::Unwinder<bool> uw3 (_saving_state, true);
+
+		if (template_only) {
+			mark_as_clean = false;
+			tree->set_root (&get_template());
+		} else {
+			tree->set_root (&state (false, fork_state, for_archive, only_used_assets));
+		}
 	}
 
 	if (snapshot_name.empty()) {
@@ -876,54 +884,23 @@ Session::save_state (string snapshot_name, bool pending, bool switch_to_snapshot
 	std::string tmp_path(_session_dir->root_path());
 	tmp_path = Glib::build_filename (tmp_path, legalize_for_path (snapshot_name + temp_suffix));
 
-	DEBUG_TRACE (DEBUG::SaveState, string_compose ("writing state to '%1'\n", tmp_path));
-
-	if (!tree.write (tmp_path)) {
-		error << string_compose (_("state could not be saved to %1"), tmp_path) << endmsg;
-		if (g_remove (tmp_path.c_str()) != 0) {
-			error << string_compose(_("Could not remove temporary session file at path \"%1\" (%2)"),
-					tmp_path, g_strerror (errno)) << endmsg;
+	if (pending) {
+		/* pending state is written often (e.g. when recording starts),
+		 * there is no need to wait for it to be on disk.
+		 */
+		XMLTree* t = tree.release ();
+		_state_writer = PBD::Thread::create (std::bind (&Session::write_pending_state, this, t, tmp_path, xml_path), "SaveState");
+		if (!_state_writer) {
+			write_pending_state (t, tmp_path, xml_path);
 		}
-		return -1;
-
 	} else {
+		const int64_t write_start_time = g_get_monotonic_time();
 
-		DEBUG_TRACE (DEBUG::SaveState, string_compose ("renaming state to '%1'\n", xml_path));
-
-		if (::g_rename (tmp_path.c_str(), xml_path.c_str()) != 0) {
-			error << string_compose (_("could not rename temporary session file %1 to %2 (%3)"),
-					tmp_path, xml_path, g_strerror(errno)) << endmsg;
-			if (g_remove (tmp_path.c_str()) != 0) {
-				error << string_compose(_("Could not remove temporary session file at path \"%1\" (%2)"),
-						tmp_path, g_strerror (errno)) << endmsg;
-			}
+		if (write_state_file (*tree, tmp_path, xml_path)) {
 			return -1;
 		}
-	}
 
-	//Mixbus auto-backup mechanism
-	if(Profile->get_mixbus()) {
-		if (pending) {  //"pending" save means it's a backup, or some other non-user-initiated save;  a good time to make a backup
-			// make a serialized safety backup
-			// (will make one periodically but only one per hour is left on disk)
-			// these backup files go into a separated folder
-			char timebuf[128];
-			time_t n;
-			struct tm local_time;
-			time (&n);
-			localtime_r (&n, &local_time);
-			strftime (timebuf, sizeof(timebuf), "%y-%m-%d.%H", &local_time);
-			std::string save_path(session_directory().backup_path());
-			save_path += G_DIR_SEPARATOR;
-			save_path += legalize_for_path(_current_snapshot_name);
-			save_path += "-";
-			save_path += timebuf;
-			save_path += statefile_suffix;
-			if (!copy_file (xml_path, save_path)) {
-					error << string_compose(_("Could not save backup file at path \"%1\" (%2)"),
-							save_path, g_strerror (errno)) << endmsg;
-			}
-		}
+		_save_timing.push_back (std::make_pair (X_("Write"), g_get_monotonic_time() - write_start_time));
 	}
 
 	if (!pending && !for_archive) {
@@ -943,6 +920,9 @@ Session::save_state (string snapshot_name, bool pending, bool switch_to_snapshot
 	if (DEBUG_ENABLED (DEBUG::SaveState)) {
 		const int64_t elapsed_time_us = g_get_monotonic_time() - save_start_time;
 		DEBUG_TRACE (DEBUG::SaveState, string_compose ("saved in %1%2%3 ms\n", fixed, setprecision (1), elapsed_time_us / 1000.));
+		for (auto const& t : _save_timing) {
+			DEBUG_TRACE (DEBUG::SaveState, string_compose ("  %1: %2%3%4 ms\n", t.first, fixed, setprecision (1), t.second / 1000.));
+		}
 	}
 #endif
 
@@ -953,6 +933,89 @@ Session::save_state (string snapshot_name, bool pending, bool switch_to_snapshot
 	return 0;
 }
 
+void
+Session::wait_for_state_writer ()
+{
+	if (_state_writer) {
+		_state_writer->join ();
+		delete _state_writer;
+		_state_writer = 0;
+	}
+}
+
+/** Write @p tree to @p tmp_path and atomically rename it to @p xml_path */
+int
+Session::write_state_file (XMLTree& tree, std::string const& tmp_path, std::string const& xml_path)
+{
+	DEBUG_TRACE (DEBUG::SaveState, string_compose ("writing state to '%1'\n", tmp_path));
+
+	if (!tree.write (tmp_path)) {
+		error << string_compose (_("state could not be saved to %1"), tmp_path) << endmsg;
+		if (g_remove (tmp_path.c_str()) != 0) {
+			error << string_compose(_("Could not remove temporary session file at path \"%1\" (%2)"),
+					tmp_path, g_strerror (errno)) << endmsg;
+		}
+		return -1;
+	}
+
+	DEBUG_TRACE (DEBUG::SaveState, string_compose ("renaming state to '%1'\n", xml_path));
+
+	if (::g_rename (tmp_path.c_str(), xml_path.c_str()) != 0) {
+		error << string_compose (_("could not rename temporary session file %1 to %2 (%3)"),
+				tmp_path, xml_path, g_strerror(errno)) << endmsg;
+		if (g_remove (tmp_path.c_str()) != 0) {
+			error << string_compose(_("Could not remove temporary session file at path \"%1\" (%2)"),
+					tmp_path, g_strerror (errno)) << endmsg;
+		}
+		return -1;
+	}
+
+	return 0;
+}
+
+/* runs in the _state_writer thread */
+void
+Session::write_pending_state (XMLTree* tree, std::string tmp_path, std::string xml_path)
+{
+	const int64_t write_start_time = g_get_monotonic_time();
+
+	if (write_state_file (*tree, tmp_path, xml_path) == 0) {
+		backup_pending_state (xml_path);
+	}
+
+	delete tree;
+
+	DEBUG_TRACE (DEBUG::SaveState, string_compose ("pending state written in %1%2%3 ms\n", fixed, setprecision (1), (g_get_monotonic_time() - write_start_time) / 1000.));
+}
+
+void
+Session::backup_pending_state (std::string const& xml_path)
+{
+	//Mixbus auto-backup mechanism
+	if(Profile->get_mixbus()) {
+		//"pending" save means it's a backup, or some other non-user-initiated save;  a good time to make a backup
+		// make a serialized safety backup
+		// (will make one periodically but only one per hour is left on disk)
+		// these backup files go into a separated folder
+		char timebuf[128];
+		time_t n;
+		struct tm local_time;
+		time (&n);
+		localtime_r (&n, &local_time);
+		strftime (timebuf, sizeof(timebuf), "%y-%m-%d.%H", &local_time);
+		std::string save_path(session_directory().backup_path());
+		save_path += G_DIR_SEPARATOR;
+		save_path += legalize_for_path(_current_snapshot_name);
+		save_path += "-";
+		save_path += timebuf;
+		save_path += statefile_suffix;
+		if (!copy_file (xml_path, save_path)) {
+				error << string_compose(_("Could not save backup file at path \"%1\" (%2)"),
+						save_path, g_strerror (errno)) << endmsg;
+		}
+	}
+}
+
 int
 Session::restore_state (string snapshot_name)
 {
@@ -1515,6 +1578,18 @@ Session::state (bool save_template, snapshot_t snapshot_type, bool for_archive,
 
 	PBD::Unwinder<bool> uw (Automatable::skip_saving_automation, save_template);
 
+	int64_t lap_time = g_get_monotonic_time ();
+
+	/* record the time spent on each part of the state, when saving */
+	auto lap = [this, &lap_time] (char const* what) {
+		if (!_saving_state) {
+			return;
+		}
+		int64_t now = g_get_monotonic_time ();
+		_save_timing.push_back (std::make_pair (what, now - lap_time));
+		lap_time = now;
+	};
+
 	node->set_property("version", CURRENT_SESSION_FILE_VERSION);
 
 	child = node->add_child ("ProgramVersion");
@@ -1631,6 +1706,8 @@ Session::state (bool save_template, snapshot_t snapshot_type, bool for_archive,
 
 	node->add_child_nocopy (ARDOUR::SessionMetadata::Metadata()->get_state());
 
+	lap (X_("Config"));
+
 	child = node->add_child ("Sources");
 
 	if (!save_template) {
@@ -1688,6 +1765,8 @@ Session::state (bool save_template, snapshot_t snapshot_type, bool for_archive,
 		}
 	}
 
+	lap (X_("Sources"));
+
 	node->add_child_nocopy (*TriggerBox::get_custom_midi_binding_state());
 
 	child = node->add_child ("Regions");
@@ -1787,6 +1866,8 @@ Session::state (bool save_template, snapshot_t snapshot_type, bool for_archive,
 		}
 	}
 
+	lap (X_("Regions"));
+
 	if (!save_template) {
 
 		node->add_child_nocopy (_selection->get_state());
@@ -1817,6 +1898,8 @@ Session::state (bool save_template, snapshot_t snapshot_type, bool for_archive,
 		}
 	}
 
+	lap (X_("Locations"));
+
 	child = node->add_child ("Bundles");
 	{
 		std::shared_ptr<BundleList const> bundles = _bundles.reader ();
@@ -1830,6 +1913,8 @@ Session::state (bool save_template, snapshot_t snapshot_type, bool for_archive,
 
 	node->add_child_nocopy (_vca_manager->get_state());
 
+	lap (X_("Bundles, VCAs"));
+
 	child = node->add_child ("Routes");
 	{
 		std::shared_ptr<RouteList const> r = routes.reader ();
@@ -1849,8 +1934,12 @@ Session::state (bool save_template, snapshot_t snapshot_type, bool for_archive,
 		}
 	}
 
+	lap (X_("Routes"));
+
 	_playlists->add_state (node, save_template, !only_used_assets);
 
+	lap (X_("Playlists"));
+
 	child = node->add_child ("RouteGroups");
 	for (auto const & rg : _route_groups) {
 		child->add_child_nocopy (rg->get_state());
@@ -1927,6 +2016,8 @@ Session::state (bool save_template, snapshot_t snapshot_type, bool for_archive,
 		node->add_child_nocopy (*iop_node);
 	}
 
+	lap (X_("Other"));
+
 	return *node;
 }
 
@@ -4262,6 +4353,8 @@ Session::cleanup_sources (CleanupReport& rep)
 			}
 		}
 
+		::g_unlink ((peakpath + peak_levels_suffix).c_str ());
+
 		rep.paths.push_back (*x);
 		rep.space += statbuf.st_size;
 	}
@@ -4430,6 +4523,9 @@ Session::save_history (string snapshot_name)
 	const string backup_filename = history_filename + backup_suffix;
 	const std::string xml_path(Glib::build_filename (_session_dir->root_path(), history_filename));
 	const std::string backup_path(Glib::build_filename (_session_dir->root_path(), backup_filename));
+	const std::string journal_filename = legalize_for_path (snapshot_name + history_journal_suffix);
+	const std::string journal_path (Glib::build_filename (_session_dir->root_path(), journal_filename));
+	const bool journal = Config->get_save_history_journal ();
 
 	if (Glib::file_test (xml_path, Glib::FILE_TEST_EXISTS)) {
 		if (::g_rename (xml_path.c_str(), backup_path.c_str()) != 0) {
@@ -4440,9 +4536,25 @@ Session::save_history (string snapshot_name)
 
 	if (!Config->get_save_history() || Config->get_saved_history_depth() < 0 ||
 	    (_history.undo_depth() == 0 && _history.redo_depth() == 0)) {
+		::g_remove (journal_path.c_str());
+		_history_journal.reset ();
 		return 0;
 	}
 
+	if (journal) {
+		/* only append transactions that were added since the last save */
+		if (_history_journal.save (_history, Config->get_saved_history_depth(), journal_path)) {
+			error << string_compose (_("history could not be saved to %1"), journal_path) << endmsg;
+			return -1;
+		}
+		return 0;
+	}
+
+	if (Glib::file_test (journal_path, Glib::FILE_TEST_EXISTS)) {
+		::g_remove (journal_path.c_str());
+	}
+	_history_journal.reset ();
+
 	tree.set_root (&_history.get_state (Config->get_saved_history_depth()));
 
 	if (!tree.write (xml_path))
@@ -4464,6 +4576,104 @@ Session::save_history (string snapshot_name)
 	return 0;
 }
 
+UndoTransaction*
+Session::undo_transaction_from_state (XMLNode const& t)
+{
+	std::string name;
+	std::string timestamp;
+
+	int64_t tv_sec;
+	int64_t tv_usec;
+	Glib::DateTime dt;
+
+	if (!t.get_property ("name", name)) {
+		return 0;
+	}
+
+	/* new since 9.3 timestamp */
+	if (t.get_property ("timestamp", timestamp)) {
+#if 0 // glibmm >= 2.62
+		dt = Glib::DateTime::create_from_iso8601 (timestamp);
+#else
+		dt = Glib::DateTime (g_date_time_new_from_iso8601 (timestamp.c_str(), NULL));
+#endif
+	} else if (t.get_property ("tv-sec", tv_sec) && t.get_property ("tv-usec", tv_usec)) {
+#if 0 // glibmm >= 2.80
+		dt.create_from_utc_usec (tv_sec * 1e6 + tv_usec);
+#else
+		dt = Glib::DateTime::create_now_local (tv_sec);
+		dt.add_seconds (tv_usec / 1e6);
+#endif
+	} else {
+		return 0;
+	}
+
+	UndoTransaction* ut = new UndoTransaction ();
+	ut->set_name (name);
+	ut->set_timestamp (dt);
+
+	for (XMLNodeConstIterator child_it  = t.children().begin();
+	     child_it != t.children().end(); child_it++)
+	{
+		XMLNode *n = *child_it;
+		Command *c;
+
+		if (n->name() == "MementoCommand" ||
+		    n->name() == "MementoUndoCommand" ||
+		    n->name() == "MementoRedoCommand") {
+
+			if ((c = memento_command_factory(n))) {
+				ut->add_command(c);
+			}
+
+		} else if (n->name() == "TempoCommand") {
+
+			ut->add_command (new TempoCommand (*n));
+
+		} else if (n->name() == "NoteDiffCommand") {
+			PBD::ID id (n->property("midi-source")->value());
+			std::shared_ptr<MidiSource> midi_source =
+				std::dynamic_pointer_cast<MidiSource, Source>(source_by_id(id));
+			if (midi_source) {
+				ut->add_command (new MidiModel::NoteDiffCommand(midi_source->model(), *n));
+			} else {
+				error << _("Failed to downcast MidiSource for NoteDiffCommand") << endmsg;
+			}
+
+		} else if (n->name() == "SysExDiffCommand") {
+
+			PBD::ID id (n->property("midi-source")->value());
+			std::shared_ptr<MidiSource> midi_source =
+				std::dynamic_pointer_cast<MidiSource, Source>(source_by_id(id));
+			if (midi_source) {
+				ut->add_command (new MidiModel::SysExDiffCommand (midi_source->model(), *n));
+			} else {
+				error << _("Failed to downcast MidiSource for SysExDiffCommand") << endmsg;
+			}
+
+		} else if (n->name() == "PatchChangeDiffCommand") {
+
+			PBD::ID id (n->property("midi-source")->value());
+			std::shared_ptr<MidiSource> midi_source =
+				std::dynamic_pointer_cast<MidiSource, Source>(source_by_id(id));
+			if (midi_source) {
+				ut->add_command (new MidiModel::PatchChangeDiffCommand (midi_source->model(), *n));
+			} else {
+				error << _("Failed to downcast MidiSource for PatchChangeDiffCommand") << endmsg;
+			}
+
+		} else if (n->name() == "StatefulDiffCommand") {
+			if ((c = stateful_diff_command_factory (n))) {
+				ut->add_command (c);
+			}
+		} else {
+			error << string_compose(_("Couldn't figure out how to make a Command out of a %1 XMLNode."), n->name()) << endmsg;
+		}
+	}
+
+	return ut;
+}
+
 int
 Session::restore_history (string snapshot_name)
 {
@@ -4475,6 +4685,47 @@ Session::restore_history (string snapshot_name)
 
 	const std::string xml_filename = legalize_for_path (snapshot_name + history_suffix);
 	const std::string xml_path(Glib::build_filename (_session_dir->root_path(), xml_filename));
+	const std::string journal_filename = legalize_for_path (snapshot_name + history_journal_suffix);
+	const std::string journal_path (Glib::build_filename (_session_dir->root_path(), journal_filename));
+
+	_history_journal.reset ();
+
+	/* Saving the journal moves the .history file aside, and saving a
+	 * .history file removes the journal. If both exist, the .history
+	 * file was written by a version that does not know about journals,
+	 * so only use the journal if it is more recent.
+	 */
+	GStatBuf journal_stat;
+	GStatBuf xml_stat;
+	bool     use_journal = g_stat (journal_path.c_str(), &journal_stat) == 0;
+
+	if (use_journal && g_stat (xml_path.c_str(), &xml_stat) == 0 && xml_stat.st_mtime >= journal_stat.st_mtime) {
+		info << string_compose (_("Ignoring session history journal \"%1\", the history file is more recent"), journal_path) << endmsg;
+		use_journal = false;
+	}
+
+	if (use_journal) {
+
+		info << "Loading history from " << journal_path << endmsg;
+
+		// replace history
+		_history.clear();
+
+		try {
+			if (_history_journal.load (journal_path, _history, [this] (XMLNode const& n) { return undo_transaction_from_state (n); }) == 0) {
+				return 0;
+			}
+			error << string_compose (_("Could not understand session history journal \"%1\""), journal_path) << endmsg;
+		} catch (std::exception const & e) {
+			error << string_compose (_("Error during loading undo history (%1). Undo history will be ignored"), e.what()) << endmsg;
+			_history.clear();
+			_history_journal.reset ();
+			return 0;
+		}
+
+		_history.clear();
+		_history_journal.reset ();
+	}
 
 	info << "Loading history from " << xml_path << endmsg;
 
@@ -4495,102 +4746,10 @@ Session::restore_history (string snapshot_name)
 
 	try {
 		for (XMLNodeConstIterator it  = tree.root()->children().begin(); it != tree.root()->children().end(); ++it) {
-
-			XMLNode *t = *it;
-
-			std::string name;
-			std::string timestamp;
-
-			int64_t tv_sec;
-			int64_t tv_usec;
-			Glib::DateTime dt;
-
-			if (!t->get_property ("name", name)) {
-				continue;
-			}
-
-			/* new since 9.3 timestamp */
-			if (t->get_property ("timestamp", timestamp)) {
-#if 0 // glibmm >= 2.62
-				dt = Glib::DateTime::create_from_iso8601 (timestamp);
-#else
-				dt = Glib::DateTime (g_date_time_new_from_iso8601 (timestamp.c_str(), NULL));
-#endif
-			} else if (t->get_property ("tv-sec", tv_sec) && t->get_property ("tv-usec", tv_usec)) {
-#if 0 // glibmm >= 2.80
-				dt.create_from_utc_usec (tv_sec * 1e6 + tv_usec);
-#else
-				dt = Glib::DateTime::create_now_local (tv_sec);
-				dt.add_seconds (tv_usec / 1e6);
-#endif
-			} else {
-				continue;
-			}
-
-			UndoTransaction* ut = new UndoTransaction ();
-			ut->set_name (name);
-			ut->set_timestamp (dt);
-
-			for (XMLNodeConstIterator child_it  = t->children().begin();
-			     child_it != t->children().end(); child_it++)
-			{
-				XMLNode *n = *child_it;
-				Command *c;
-
-				if (n->name() == "MementoCommand" ||
-				    n->name() == "MementoUndoCommand" ||
-				    n->name() == "MementoRedoCommand") {
-
-					if ((c = memento_command_factory(n))) {
-						ut->add_command(c);
-					}
-
-				} else if (n->name() == "TempoCommand") {
-
-					ut->add_command (new TempoCommand (*n));
-
-				} else if (n->name() == "NoteDiffCommand") {
-					PBD::ID id (n->property("midi-source")->value());
-					std::shared_ptr<MidiSource> midi_source =
-						std::dynamic_pointer_cast<MidiSource, Source>(source_by_id(id));
-					if (midi_source) {
-						ut->add_command (new MidiModel::NoteDiffCommand(midi_source->model(), *n));
-					} else {
-						error << _("Failed to downcast MidiSource for NoteDiffCommand") << endmsg;
-					}
-
-				} else if (n->name() == "SysExDiffCommand") {
-
-					PBD::ID id (n->property("midi-source")->value());
-					std::shared_ptr<MidiSource> midi_source =
-						std::dynamic_pointer_cast<MidiSource, Source>(source_by_id(id));
-					if (midi_source) {
-						ut->add_command (new MidiModel::SysExDiffCommand (midi_source->model(), *n));
-					} else {
-						error << _("Failed to downcast MidiSource for SysExDiffCommand") << endmsg;
-					}
-
-				} else if (n->name() == "PatchChangeDiffCommand") {
-
-					PBD::ID id (n->property("midi-source")->value());
-					std::shared_ptr<MidiSource> midi_source =
-						std::dynamic_pointer_cast<MidiSource, Source>(source_by_id(id));
-					if (midi_source) {
-						ut->add_command (new MidiModel::PatchChangeDiffCommand (midi_source->model(), *n));
-					} else {
-						error << _("Failed to downcast MidiSource for PatchChangeDiffCommand") << endmsg;
-					}
-
-				} else if (n->name() == "StatefulDiffCommand") {
-					if ((c = stateful_diff_command_factory (n))) {
-						ut->add_command (c);
-					}
-				} else {
-					error << string_compose(_("Couldn't figure out how to make a Command out of a %1 XMLNode."), n->name()) << endmsg;
-				}
+			UndoTransaction* ut = undo_transaction_from_state (**it);
+			if (ut) {
+				_history.add (ut);
 			}
-
-			_history.add (ut);
 		}
 
 	} catch (std::exception const & e) {
@@ -5139,6 +5298,18 @@ Session::rename (const std::string& new_name)
 		}
 	}
 
+	oldstr = Glib::build_filename (new_path, _current_snapshot_name) + history_journal_suffix;
+
+	if (Glib::file_test (oldstr, Glib::FILE_TEST_EXISTS))  {
+		newstr = Glib::build_filename (new_path, legal_name) + history_journal_suffix;
+
+		if (::g_rename (oldstr.c_str(), newstr.c_str()) != 0) {
+			error << string_compose (_("renaming %1 as %2 failed (%3)"), oldstr, newstr, g_strerror (errno)) << endmsg;
+			return 1;
+		}
+	}
+	_history_journal.reset ();
+
 	/* remove old name from recent sessions */
 	remove_recent_sessions (_path);
 	_path = new_path;
@@ -5481,6 +5652,7 @@ Session::save_as (SaveAs& saveas)
 	do_not_copy_extensions.push_back (backup_suffix);
 	do_not_copy_extensions.push_back (temp_suffix);
 	do_not_copy_extensions.push_back (history_suffix);
+	do_not_copy_extensions.push_back (history_journal_suffix);
 
 	/* get total size */
 
@@ -5973,6 +6145,7 @@ Session::archive_session (const std::string& dest,
 	do_not_copy_extensions.push_back (backup_suffix);
 	do_not_copy_extensions.push_back (temp_suffix);
 	do_not_copy_extensions.push_back (history_suffix);
+	do_not_copy_extensions.push_back (history_journal_suffix);
 	do_not_copy_extensions.push_back (".DS_Store");
 
 	vector<string> blacklist_dirs;
@@ -6243,6 +6416,7 @@ Session::archive_session (const std::string& dest,
 	/* collect session-state files */
 	do_not_copy_extensions.clear ();
 	do_not_copy_extensions.push_back (history_suffix);
+	do_not_copy_extensions.push_back (history_journal_suffix);
 
 	blacklist_dirs.clear ();
 	blacklist_dirs.push_back (string (externals_dir_name) + G_DIR_SEPARATOR);
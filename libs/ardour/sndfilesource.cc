@@ -31,6 +31,9 @@
 #include <climits>
 #include <cstdarg>
 #include <fcntl.h>
+#include <list>
+#include <map>
+#include <vector>
 
 #include <sys/stat.h>
 
@@ -48,6 +51,8 @@
 #include <glibmm/fileutils.h>
 #include <glibmm/miscutils.h>
 
+#include "pbd/mutex.h"
+
 #include "ardour/runtime_functions.h"
 #include "ardour/sndfilesource.h"
 #include "ardour/sndfile_helpers.h"
@@ -67,6 +72,65 @@ const Source::Flag SndFileSource::default_writable_flags = Source::Flag (
 		Source::RemovableIfEmpty |
 		Source::CanRename );
 
+/* do not keep more than this many (interleaved) samples per file */
+static const samplecnt_t max_read_cache_size = 4194304;
+
+/* number of most recently read blocks to keep per file */
+static const size_t read_cache_blocks = 4;
+
+/** Interleaved data recently read from a multichannel file,
+ * shared by all SndFileSources of the file.
+ */
+struct SndFileSource::ReadCache {
+	/** A block of interleaved data, not modified once it is cached */
+	struct Block {
+		Block (samplepos_t s) : start (s), cnt (0) {}
+		samplepos_t         start; ///< first sample in buf
+		samplecnt_t         cnt;   ///< number of samples per channel in buf
+		std::vector<Sample> buf;
+	};
+
+	typedef std::shared_ptr<Block const> BlockPtr;
+
+	ReadCache () : size (0) {}
+
+	/** @return the block holding [start, start + cnt), or an empty pointer */
+	BlockPtr find (samplepos_t start, samplecnt_t cnt)
+	{
+		PBD::Mutex::Lock lm (lock);
+		for (std::list<BlockPtr>::iterator i = blocks.begin (); i != blocks.end (); ++i) {
+			if (start >= (*i)->start && start + cnt <= (*i)->start + (*i)->cnt) {
+				/* most recently used first */
+				blocks.splice (blocks.begin (), blocks, i);
+				return blocks.front ();
+			}
+		}
+		return BlockPtr ();
+	}
+
+	void add (BlockPtr const& b)
+	{
+		PBD::Mutex::Lock lm (lock);
+		blocks.push_front (b);
+		size += b->buf.size ();
+		/* evict the least recently used blocks, readers
+		 * may still hold a reference to them.
+		 */
+		while (blocks.size () > 1 && (blocks.size () > read_cache_blocks || size > (size_t) max_read_cache_size)) {
+			size -= blocks.back ()->buf.size ();
+			blocks.pop_back ();
+		}
+	}
+
+	PBD::Mutex          lock;
+	std::list<BlockPtr> blocks; ///< most recently used first
+	size_t              size;   ///< number of samples in all blocks
+};
+
+std::atomic<bool>     SndFileSource::_read_cache_enabled (true);
+std::atomic<uint64_t> SndFileSource::_read_cache_hits (0);
+std::atomic<uint64_t> SndFileSource::_read_cache_misses (0);
+
 SndFileSource::SndFileSource (Session& s, const XMLNode& node)
 	: Source(s, node)
 	, AudioFileSource (s, node)
@@ -353,6 +417,7 @@ SndFileSource::close ()
 		_sndfile = 0;
 		file_closed ();
 	}
+	_read_cache.reset ();
 }
 
 int
@@ -403,6 +468,10 @@ SndFileSource::open ()
 
 	_length = timecnt_t (_info.frames);
 
+	if (_info.channels > 1 && !writable () && !_read_cache) {
+		_read_cache = read_cache_for (_path);
+	}
+
 #ifdef HAVE_RF64_RIFF
 	if (_file_is_new && _length == 0 && writable()) {
 		if (_flags & RF64_RIFF) {
@@ -550,6 +619,10 @@ SndFileSource::read_unlocked (Sample *dst, samplepos_t start, samplecnt_t cnt) c
 		memset (dst+file_cnt, 0, sizeof (Sample) * delta);
 	}
 
+	if (file_cnt && _read_cache && _read_cache_enabled.load () && file_cnt * _info.channels <= max_read_cache_size) {
+		return read_cached (dst, start, file_cnt);
+	}
+
 	if (file_cnt) {
 
 		if (sf_seek (_sndfile, (sf_count_t) start, SEEK_SET|SFM_READ) != (sf_count_t) start) {
@@ -568,10 +641,8 @@ SndFileSource::read_unlocked (Sample *dst, samplepos_t start, samplecnt_t cnt) c
 				sf_error_str (0, errbuf, sizeof (errbuf) - 1);
 				error << string_compose(_("SndFileSource: @ %1 could not read %2 within %3 (%4) (len = %5, ret was %6)"), start, file_cnt, _name, errbuf, _length, ret) << endl;
 			}
-			if (_gain != 1.f) {
-				for (samplecnt_t i = 0; i < ret; ++i) {
-					dst[i] *= _gain;
-				}
+			if (_gain != 1.f && ret > 0) {
+				apply_gain_to_buffer (dst, ret, _gain);
 			}
 			return ret;
 		}
@@ -585,21 +656,116 @@ SndFileSource::read_unlocked (Sample *dst, samplepos_t start, samplecnt_t cnt) c
 	ptr = interleave_buf + _channel;
 	nread /= _info.channels;
 
-	/* stride through the interleaved data */
+	if (nread > 0) {
+		/* stride through the interleaved data */
+		deinterleave (dst, ptr, _info.channels, nread);
 
-	if (_gain != 1.f) {
-		for (samplecnt_t n = 0; n < nread; ++n) {
-			dst[n] = *ptr * _gain;
-			ptr += _info.channels;
+		if (_gain != 1.f) {
+			apply_gain_to_buffer (dst, nread, _gain);
 		}
+	}
+
+	return nread;
+}
+
+/** Read @p cnt samples of our channel, starting at @p start, using the
+ * data that is shared with other channels of the same file. On a cache miss,
+ * all channels of the given range are read from disk.
+ *
+ * The cache is only locked to look up and add blocks, disk reads use this
+ * source's own SNDFILE and do not block other channels.
+ */
+samplecnt_t
+SndFileSource::read_cached (Sample* dst, samplepos_t start, samplecnt_t cnt) const
+{
+	ReadCache& rc (*_read_cache);
+	const int  nchn = _info.channels;
+
+	ReadCache::BlockPtr b = rc.find (start, cnt);
+
+	if (b) {
+		_read_cache_hits.fetch_add (1);
 	} else {
-		for (samplecnt_t n = 0; n < nread; ++n) {
-			dst[n] = *ptr;
-			ptr += _info.channels;
+		_read_cache_misses.fetch_add (1);
+
+		if (sf_seek (_sndfile, (sf_count_t) start, SEEK_SET|SFM_READ) != (sf_count_t) start) {
+			/* only cached for read-only files, for which seek errors are not reported */
+			return 0;
+		}
+
+		std::shared_ptr<ReadCache::Block> nb (new ReadCache::Block (start));
+		nb->buf.resize (cnt * nchn);
+
+		samplecnt_t ret = sf_read_float (_sndfile, &nb->buf[0], cnt * nchn);
+
+		if (ret != cnt * nchn) {
+			char errbuf[256];
+			sf_error_str (0, errbuf, sizeof (errbuf) - 1);
+			error << string_compose(_("SndFileSource: @ %1 could not read %2 within %3 (%4) (len = %5, ret was %6)"), start, cnt, _name, errbuf, _length, ret) << endl;
+		}
+
+		nb->cnt = std::max<samplecnt_t> (0, ret / nchn);
+		nb->buf.resize (nb->cnt * nchn);
+
+		b = nb;
+
+		if (nb->cnt > 0) {
+			rc.add (b);
 		}
 	}
 
-	return nread;
+	samplecnt_t nread = std::min (cnt, b->start + b->cnt - start);
+
+	if (nread > 0) {
+		deinterleave (dst, &b->buf[(start - b->start) * nchn + _channel], nchn, nread);
+
+		if (_gain != 1.f) {
+			apply_gain_to_buffer (dst, nread, _gain);
+		}
+	}
+
+	return std::max<samplecnt_t> (0, nread);
+}
+
+std::shared_ptr<SndFileSource::ReadCache>
+SndFileSource::read_cache_for (std::string const& path)
+{
+	static PBD::Mutex                                  caches_lock;
+	static std::map<std::string, std::weak_ptr<ReadCache> > caches;
+
+	PBD::Mutex::Lock lm (caches_lock);
+
+	/* drop entries of files that are no longer used */
+	for (auto i = caches.begin (); i != caches.end ();) {
+		if (i->second.expired ()) {
+			i = caches.erase (i);
+		} else {
+			++i;
+		}
+	}
+
+	std::shared_ptr<ReadCache> rc (caches[path].lock ());
+
+	if (!rc) {
+		rc.reset (new ReadCache);
+		caches[path] = rc;
+	}
+
+	return rc;
+}
+
+void
+SndFileSource::read_cache_stats (uint64_t& hits, uint64_t& misses)
+{
+	hits   = _read_cache_hits.load ();
+	misses = _read_cache_misses.load ();
+}
+
+void
+SndFileSource::reset_read_cache_stats ()
+{
+	_read_cache_hits.store (0);
+	_read_cache_misses.store (0);
 }
 
 samplecnt_t
@@ -851,4 +1017,5 @@ void
 SndFileSource::set_path (const string& p)
 {
         FileSource::set_path (p);
+        _read_cache.reset ();
 }
@@ -35,12 +35,14 @@
 #include "ardour/ffmpegfilesource.h"
 #include "ardour/midi_playlist.h"
 #include "ardour/mp3filesource.h"
+#include "ardour/rc_configuration.h"
 #include "ardour/session.h"
 #include "ardour/silentfilesource.h"
 #include "ardour/smf_source.h"
 #include "ardour/sndfilesource.h"
 #include "ardour/source.h"
 #include "ardour/source_factory.h"
+#include "ardour/utils.h"
 
 #ifdef HAVE_COREAUDIO
 #include "ardour/coreaudiosource.h"
@@ -56,6 +58,7 @@ PBD::Signal<void(std::shared_ptr<Source>)> SourceFactory::SourceCreated;
 PBD::Cond                                  SourceFactory::PeaksToBuild;
 PBD::Mutex                                 SourceFactory::peak_building_lock;
 std::list<std::weak_ptr<AudioSource>>      SourceFactory::files_with_peaks;
+std::list<std::function<void ()>>          SourceFactory::peak_tasks;
 std::vector<PBD::Thread*>                  SourceFactory::peak_thread_pool;
 bool                                       SourceFactory::peak_thread_run = false;
 
@@ -69,7 +72,7 @@ peak_thread_work ()
 		SourceFactory::peak_building_lock.lock ();
 
 	wait:
-		if (SourceFactory::files_with_peaks.empty () && SourceFactory::peak_thread_run) {
+		if (SourceFactory::files_with_peaks.empty () && SourceFactory::peak_tasks.empty () && SourceFactory::peak_thread_run) {
 			SourceFactory::PeaksToBuild.wait (SourceFactory::peak_building_lock);
 			(void) Temporal::TempoMap::fetch();
 		}
@@ -79,6 +82,15 @@ peak_thread_work ()
 			return;
 		}
 
+		if (!SourceFactory::peak_tasks.empty ()) {
+			/* finish files that are being built, before starting new ones */
+			std::function<void ()> fn (std::move (SourceFactory::peak_tasks.front ()));
+			SourceFactory::peak_tasks.pop_front ();
+			SourceFactory::peak_building_lock.unlock ();
+			fn ();
+			continue;
+		}
+
 		if (SourceFactory::files_with_peaks.empty ()) {
 			goto wait;
 		}
@@ -116,7 +128,15 @@ SourceFactory::init ()
 		return;
 	}
 	peak_thread_run = true;
-	for (int n = 0; n < 2; ++n) {
+
+	/* I/O bound, use as many threads as for disk I/O unless configured otherwise */
+	int n_threads = Config->get_peak_builder_threads ();
+	if (n_threads <= 0) {
+		n_threads = how_many_io_threads ();
+	}
+	n_threads = max (2, n_threads);
+
+	for (int n = 0; n < n_threads; ++n) {
 		peak_thread_pool.push_back (PBD::Thread::create (&peak_thread_work, string_compose ("PeakFileBuilder-%1", n)));
 	}
 }
@@ -134,6 +154,30 @@ SourceFactory::terminate ()
 	}
 }
 
+void
+SourceFactory::queue_peak_task (std::function<void ()> fn)
+{
+	PBD::Mutex::Lock lm (peak_building_lock);
+	peak_tasks.push_back (fn);
+	PeaksToBuild.signal ();
+}
+
+bool
+SourceFactory::run_peak_task ()
+{
+	std::function<void ()> fn;
+	{
+		PBD::Mutex::Lock lm (peak_building_lock);
+		if (peak_tasks.empty ()) {
+			return false;
+		}
+		fn = std::move (peak_tasks.front ());
+		peak_tasks.pop_front ();
+	}
+	fn ();
+	return true;
+}
+
 int
 SourceFactory::setup_peakfile (std::shared_ptr<Source> s, bool async)
 {
@@ -17,6 +17,7 @@
  * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
  */
 
+#include <string.h>
 #include <xmmintrin.h>
 #include "ardour/types.h"
 
@@ -114,5 +115,113 @@ x86_sse_find_peaks(const ARDOUR::Sample* buf, ARDOUR::pframes_t nframes, float *
 	_mm_store_ss(max, work);
 }
 
+void
+x86_sse_fill_ramp (float* dst, uint32_t nframes, float start, float step)
+{
+	__m128 vstart = _mm_set1_ps (start);
+	__m128 vstep  = _mm_set1_ps (step);
+	__m128 vidx0  = _mm_set_ps (3.f, 2.f, 1.f, 0.f);
+	__m128 vidx1  = _mm_set_ps (7.f, 6.f, 5.f, 4.f);
+	__m128 vinc   = _mm_set1_ps (8.f);
+
+	uint32_t i = 0;
+
+	// dst[i] = start + i * step, 8 at a time
+	for (; i + 8 <= nframes; i += 8) {
+		_mm_storeu_ps (dst + i + 0, _mm_add_ps (vstart, _mm_mul_ps (vidx0, vstep)));
+		_mm_storeu_ps (dst + i + 4, _mm_add_ps (vstart, _mm_mul_ps (vidx1, vstep)));
+		vidx0 = _mm_add_ps (vidx0, vinc);
+		vidx1 = _mm_add_ps (vidx1, vinc);
+	}
+
+	if (i + 4 <= nframes) {
+		_mm_storeu_ps (dst + i, _mm_add_ps (vstart, _mm_mul_ps (vidx0, vstep)));
+		i += 4;
+	}
+
+	for (; i < nframes; ++i) {
+		dst[i] = start + i * step;
+	}
+}
+
+void
+x86_sse_apply_gain_vector (float* dst, const float* gain, uint32_t nframes)
+{
+	uint32_t i = 0;
+
+	for (; i + 8 <= nframes; i += 8) {
+		_mm_storeu_ps (dst + i + 0, _mm_mul_ps (_mm_loadu_ps (dst + i + 0), _mm_loadu_ps (gain + i + 0)));
+		_mm_storeu_ps (dst + i + 4, _mm_mul_ps (_mm_loadu_ps (dst + i + 4), _mm_loadu_ps (gain + i + 4)));
+	}
+
+	for (; i < nframes; ++i) {
+		dst[i] *= gain[i];
+	}
+}
+
+void
+x86_sse_mix_buffers_with_gain_vector (float* dst, const float* src, const float* gain, uint32_t nframes)
+{
+	uint32_t i = 0;
+
+	for (; i + 8 <= nframes; i += 8) {
+		__m128 s0 = _mm_mul_ps (_mm_loadu_ps (src + i + 0), _mm_loadu_ps (gain + i + 0));
+		__m128 s1 = _mm_mul_ps (_mm_loadu_ps (src + i + 4), _mm_loadu_ps (gain + i + 4));
+		_mm_storeu_ps (dst + i + 0, _mm_add_ps (_mm_loadu_ps (dst + i + 0), s0));
+		_mm_storeu_ps (dst + i + 4, _mm_add_ps (_mm_loadu_ps (dst + i + 4), s1));
+	}
 
+	for (; i < nframes; ++i) {
+		dst[i] += src[i] * gain[i];
+	}
+}
+
+void
+x86_sse_interleave (float* dst, const float* src, uint32_t stride, uint32_t nframes)
+{
+	uint32_t i = 0;
 
+	if (stride == 1) {
+		memcpy (dst, src, nframes * sizeof (float));
+		return;
+	}
+
+	if (stride == 2) {
+		// keep the other channel's samples (odd slots)
+		for (; i + 4 <= nframes; i += 4) {
+			__m128 s  = _mm_loadu_ps (src + i);
+			__m128 d0 = _mm_loadu_ps (dst + 2 * i + 0);
+			__m128 d1 = _mm_loadu_ps (dst + 2 * i + 4);
+			__m128 od = _mm_shuffle_ps (d0, d1, _MM_SHUFFLE (3, 1, 3, 1));
+			_mm_storeu_ps (dst + 2 * i + 0, _mm_unpacklo_ps (s, od));
+			_mm_storeu_ps (dst + 2 * i + 4, _mm_unpackhi_ps (s, od));
+		}
+	}
+
+	for (; i < nframes; ++i) {
+		dst[i * stride] = src[i];
+	}
+}
+
+void
+x86_sse_deinterleave (float* dst, const float* src, uint32_t stride, uint32_t nframes)
+{
+	uint32_t i = 0;
+
+	if (stride == 1) {
+		memcpy (dst, src, nframes * sizeof (float));
+		return;
+	}
+
+	if (stride == 2) {
+		for (; i + 4 <= nframes; i += 4) {
+			__m128 s0 = _mm_loadu_ps (src + 2 * i + 0);
+			__m128 s1 = _mm_loadu_ps (src + 2 * i + 4);
+			_mm_storeu_ps (dst + i, _mm_shuffle_ps (s0, s1, _MM_SHUFFLE (2, 0, 2, 0)));
+		}
+	}
+
+	for (; i < nframes; ++i) {
+		dst[i] = src[i * stride];
+	}
+}
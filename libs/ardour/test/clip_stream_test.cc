@@ -0,0 +1,194 @@
+#include <atomic>
+#include <thread>
+
+#include "ardour/audioregion.h"
+#include "ardour/triggerbox.h"
+
+#include "clip_stream_test.h"
+
+CPPUNIT_TEST_SUITE_REGISTRATION (ClipStreamTest);
+
+using namespace std;
+using namespace ARDOUR;
+
+typedef AudioTrigger::ClipStream ClipStream;
+
+/* the source holds a staircase of 4096 samples */
+static samplecnt_t const clip_length = 4096;
+
+void
+ClipStreamTest::setUp ()
+{
+	AudioRegionTest::setUp ();
+	_ar[0]->set_length (timecnt_t (clip_length));
+}
+
+void
+ClipStreamTest::check_staircase (Sample const* b, samplepos_t pos, samplecnt_t cnt)
+{
+	for (samplecnt_t i = 0; i < cnt; ++i) {
+		CPPUNIT_ASSERT_EQUAL (int (pos + i), int (b[i]));
+	}
+}
+
+/** Seeks are only serviced by the butler (refill), reads return nothing until then */
+void
+ClipStreamTest::seekTest ()
+{
+	ClipStream cs (_ar[0], clip_length, 1024, 512);
+	Sample     buf[256];
+	Sample*    dst[1] = { buf };
+
+	/* the initial fill is handled like a seek */
+	CPPUNIT_ASSERT (!cs.ready ());
+	CPPUNIT_ASSERT (cs.need_butler ());
+	CPPUNIT_ASSERT_EQUAL (samplecnt_t (0), cs.read (dst, 1024, 256));
+
+	cs.refill ();
+	CPPUNIT_ASSERT (cs.ready ());
+	CPPUNIT_ASSERT_EQUAL (samplecnt_t (256), cs.read (dst, 1024, 256));
+	check_staircase (buf, 1024, 256);
+
+	/* skipping ahead within the buffered data does not need a seek */
+	CPPUNIT_ASSERT_EQUAL (samplecnt_t (100), cs.read (dst, 1300, 100));
+	check_staircase (buf, 1300, 100);
+	CPPUNIT_ASSERT (cs.ready ());
+
+	/* going back does */
+	CPPUNIT_ASSERT_EQUAL (samplecnt_t (0), cs.read (dst, 1100, 100));
+	CPPUNIT_ASSERT (!cs.ready ());
+	CPPUNIT_ASSERT (cs.need_butler ());
+	cs.refill ();
+	CPPUNIT_ASSERT_EQUAL (samplecnt_t (100), cs.read (dst, 1100, 100));
+	check_staircase (buf, 1100, 100);
+
+	/* seeking to the current position is a no-op */
+	cs.seek (1200);
+	CPPUNIT_ASSERT (cs.ready ());
+
+	/* the most recent seek wins */
+	cs.seek (2000);
+	cs.seek (3000);
+	cs.refill ();
+	CPPUNIT_ASSERT (cs.ready ());
+	CPPUNIT_ASSERT_EQUAL (samplecnt_t (256), cs.read (dst, 3000, 256));
+	check_staircase (buf, 3000, 256);
+
+	/* a seek after a refill is not ready until the next refill */
+	cs.seek (2000);
+	CPPUNIT_ASSERT (!cs.ready ());
+	CPPUNIT_ASSERT_EQUAL (samplecnt_t (0), cs.read (dst, 2000, 256));
+	cs.refill ();
+	CPPUNIT_ASSERT_EQUAL (samplecnt_t (256), cs.read (dst, 2000, 256));
+	check_staircase (buf, 2000, 256);
+}
+
+/** Seek while the butler refills, the data that is read must always be
+ * from the position that was requested.
+ */
+void
+ClipStreamTest::concurrentSeekTest ()
+{
+	ClipStream        cs (_ar[0], clip_length, 0, 512);
+	std::atomic<bool> run (true);
+
+	std::thread butler ([&cs, &run] () {
+		while (run.load ()) {
+			cs.refill ();
+		}
+	});
+
+	Sample  buf[64];
+	Sample* dst[1] = { buf };
+	int     nread  = 0;
+
+	for (int i = 0; i < 20000; ++i) {
+		samplepos_t const pos = (i * 997) % (clip_length - 64);
+		cs.seek (pos);
+		for (int j = 0; j < 50; ++j) {
+			samplecnt_t const n = cs.read (dst, pos, 64);
+			if (n > 0) {
+				check_staircase (buf, pos, n);
+				++nread;
+				break;
+			}
+			std::this_thread::yield ();
+		}
+	}
+
+	run.store (false);
+	butler.join ();
+
+	CPPUNIT_ASSERT (nread > 0);
+}
+
+/** Reading more than the butler has provided returns what is available */
+void
+ClipStreamTest::underrunTest ()
+{
+	ClipStream cs (_ar[0], clip_length, 0, 512);
+	Sample     buf[1024];
+	Sample*    dst[1] = { buf };
+
+	cs.refill ();
+
+	samplecnt_t const avail = cs.rb.front ()->read_space ();
+	CPPUNIT_ASSERT (avail > 0 && avail < 1024);
+
+	CPPUNIT_ASSERT_EQUAL (avail, cs.read (dst, 0, 1024));
+	check_staircase (buf, 0, avail);
+	CPPUNIT_ASSERT (cs.need_butler ());
+
+	/* nothing left, but no seek is required either */
+	CPPUNIT_ASSERT_EQUAL (samplecnt_t (0), cs.read (dst, avail, 256));
+	CPPUNIT_ASSERT (cs.ready ());
+
+	/* continues where the previous read stopped */
+	cs.refill ();
+	CPPUNIT_ASSERT_EQUAL (samplecnt_t (256), cs.read (dst, avail, 256));
+	check_staircase (buf, avail, 256);
+
+	/* end of the clip */
+	cs.seek (clip_length - 100);
+	while (cs.refill () < 0) ;
+	CPPUNIT_ASSERT (cs.eof.load ());
+	CPPUNIT_ASSERT (!cs.need_butler ());
+	CPPUNIT_ASSERT_EQUAL (samplecnt_t (100), cs.read (dst, clip_length - 100, 256));
+	check_staircase (buf, clip_length - 100, 100);
+}
+
+/** Replacing a clip hands the new stream to the trigger, the TriggerBox
+ * keeps the old one alive until the butler drops it.
+ */
+void
+ClipStreamTest::replaceTest ()
+{
+	std::vector<std::shared_ptr<ClipStream>> streams; /* as TriggerBox::_streams */
+
+	AudioTrigger::AudioData data;
+	data.stream.reset (new ClipStream (_ar[0], clip_length, 1000, 512));
+	streams.push_back (data.stream);
+
+	AudioTrigger::AudioData replacement;
+	replacement.stream.reset (new ClipStream (_ar[0], clip_length, 2000, 512));
+	streams.push_back (replacement.stream);
+
+	for (auto const & s : streams) {
+		s->refill ();
+	}
+
+	data = replacement;
+
+	CPPUNIT_ASSERT (!replacement.stream);
+	CPPUNIT_ASSERT (data.stream == streams.back ());
+	CPPUNIT_ASSERT_EQUAL (1L, streams.front ().use_count ());
+
+	/* the old stream can still be refilled */
+	CPPUNIT_ASSERT (streams.front ()->ready ());
+	streams.front ()->refill ();
+
+	Sample  buf[256];
+	Sample* dst[1] = { buf };
+	CPPUNIT_ASSERT_EQUAL (samplecnt_t (256), data.stream->read (dst, 2000, 256));
+	check_staircase (buf, 2000, 256);
+}
@@ -0,0 +1,23 @@
+#include "ardour/types.h"
+#include "audio_region_test.h"
+
+class ClipStreamTest : public AudioRegionTest
+{
+	CPPUNIT_TEST_SUITE (ClipStreamTest);
+	CPPUNIT_TEST (seekTest);
+	CPPUNIT_TEST (concurrentSeekTest);
+	CPPUNIT_TEST (underrunTest);
+	CPPUNIT_TEST (replaceTest);
+	CPPUNIT_TEST_SUITE_END ();
+
+public:
+	void setUp ();
+
+	void seekTest ();
+	void concurrentSeekTest ();
+	void underrunTest ();
+	void replaceTest ();
+
+private:
+	void check_staircase (ARDOUR::Sample const*, ARDOUR::samplepos_t, ARDOUR::samplecnt_t);
+};
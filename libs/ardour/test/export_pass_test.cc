@@ -0,0 +1,86 @@
+#include <algorithm>
+#include <vector>
+
+#include "ardour/export_handler.h"
+
+#include "export_pass_test.h"
+
+CPPUNIT_TEST_SUITE_REGISTRATION (ExportPassTest);
+
+using namespace std;
+using namespace ARDOUR;
+
+typedef ExportHandler::PassCandidate PC;
+
+static bool
+by_start (PC const& a, PC const& b)
+{
+	return a.start < b.start;
+}
+
+void
+ExportPassTest::consecutiveTest ()
+{
+	vector<PC> c;
+	CPPUNIT_ASSERT_EQUAL ((size_t)0, ExportHandler::pass_size (c, 100));
+
+	c.push_back (PC (0, 1000, true));
+	c.push_back (PC (1000, 2000, true));
+	c.push_back (PC (2100, 3000, true));
+	c.push_back (PC (3101, 4000, true));
+
+	/* the last gap is too long */
+	CPPUNIT_ASSERT_EQUAL ((size_t)3, ExportHandler::pass_size (c, 100));
+	CPPUNIT_ASSERT_EQUAL ((size_t)4, ExportHandler::pass_size (c, 101));
+
+	/* a timespan that needs a pass of its own ends the pass */
+	c[2].shareable = false;
+	CPPUNIT_ASSERT_EQUAL ((size_t)2, ExportHandler::pass_size (c, 1000));
+
+	c[0].shareable = false;
+	CPPUNIT_ASSERT_EQUAL ((size_t)1, ExportHandler::pass_size (c, 1000));
+}
+
+void
+ExportPassTest::overlapTest ()
+{
+	vector<PC> c;
+	c.push_back (PC (0, 5000, true));
+	c.push_back (PC (1000, 2000, true));
+	c.push_back (PC (4000, 6000, true));
+	/* overlaps the pass, which by now ends at 6000 */
+	c.push_back (PC (5050, 7000, true));
+	c.push_back (PC (7200, 8000, true));
+
+	CPPUNIT_ASSERT_EQUAL ((size_t)4, ExportHandler::pass_size (c, 100));
+	CPPUNIT_ASSERT_EQUAL ((size_t)5, ExportHandler::pass_size (c, 200));
+
+	/* identical ranges */
+	c.clear ();
+	c.push_back (PC (0, 1000, true));
+	c.push_back (PC (0, 1000, true));
+	CPPUNIT_ASSERT_EQUAL ((size_t)2, ExportHandler::pass_size (c, 0));
+}
+
+void
+ExportPassTest::unsortedTest ()
+{
+	/* timespans as added to the export, i.e. in arbitrary order */
+	vector<PC> c;
+	c.push_back (PC (9000, 10000, true));
+	c.push_back (PC (2000, 3000, true));
+	c.push_back (PC (0, 1000, true));
+	c.push_back (PC (1050, 2500, true));
+
+	/* the pass never goes back to an earlier start */
+	CPPUNIT_ASSERT_EQUAL ((size_t)1, ExportHandler::pass_size (c, 100));
+
+	/* ExportHandler sorts them by start */
+	stable_sort (c.begin (), c.end (), by_start);
+	CPPUNIT_ASSERT_EQUAL ((size_t)3, ExportHandler::pass_size (c, 100));
+	CPPUNIT_ASSERT_EQUAL ((samplepos_t)2000, c[2].start);
+
+	/* the remaining one is exported in the next pass */
+	c.erase (c.begin (), c.begin () + 3);
+	CPPUNIT_ASSERT_EQUAL ((size_t)1, ExportHandler::pass_size (c, 100));
+}
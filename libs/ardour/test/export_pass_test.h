@@ -0,0 +1,16 @@
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+class ExportPassTest : public CppUnit::TestFixture
+{
+	CPPUNIT_TEST_SUITE (ExportPassTest);
+	CPPUNIT_TEST (consecutiveTest);
+	CPPUNIT_TEST (overlapTest);
+	CPPUNIT_TEST (unsortedTest);
+	CPPUNIT_TEST_SUITE_END ();
+
+public:
+	void consecutiveTest ();
+	void overlapTest ();
+	void unsortedTest ();
+};
@@ -1,4 +1,5 @@
 #include <cassert>
+#include <cstring>
 #include "pbd/compose.h"
 #include "pbd/fpu.h"
 #include "pbd/malign.h"
@@ -81,6 +82,32 @@ FPUTest::run (size_t align_max, float const max_diff)
 			find_peaks (&_test1[off], cnt, &pk_test, &pk_test_max);
 			default_find_peaks (&_comp1[off], cnt, &pk_comp, &pk_comp_max);
 			CPPUNIT_ASSERT_MESSAGE (string_compose ("Find peaks not aligned off: %1 cnt: %2", off, cnt), fabsf (pk_test - pk_comp) < 2e-6 && fabsf (pk_test_max - pk_comp_max) < 2e-6);
+
+			/* apply gain vector */
+			apply_gain_vector (&_test1[off], &_test2[off], cnt);
+			default_apply_gain_vector (&_comp1[off], &_comp2[off], cnt);
+			compare (string_compose ("Apply Gain Vector not aligned off: %1 cnt: %2", off, cnt), off + cnt);
+
+			/* mix buffers w/gain vector */
+			mix_buffers_with_gain_vector (&_test1[off], &_test2[off], &_test2[off], cnt);
+			default_mix_buffers_with_gain_vector (&_comp1[off], &_comp2[off], &_comp2[off], cnt);
+			compare (string_compose ("Mix Buffers w/gain vector not aligned off: %1 cnt: %2", off, cnt), off + cnt, max_diff);
+
+			/* fill ramp */
+			fill_ramp (&_test1[off], cnt, 0.5, 0.001);
+			default_fill_ramp (&_comp1[off], cnt, 0.5, 0.001);
+			compare (string_compose ("Fill Ramp not aligned off: %1 cnt: %2", off, cnt), off + cnt, max_diff);
+
+			/* (de)interleave */
+			for (uint32_t stride = 1; stride < 4; ++stride) {
+				interleave (&_test1[off], &_test2[off], stride, cnt);
+				default_interleave (&_comp1[off], &_comp2[off], stride, cnt);
+				compare (string_compose ("Interleave not aligned off: %1 cnt: %2 stride: %3", off, cnt, stride), off + cnt * stride, max_diff);
+
+				deinterleave (&_test2[off], &_test1[off], stride, cnt);
+				default_deinterleave (&_comp2[off], &_comp1[off], stride, cnt);
+				CPPUNIT_ASSERT_MESSAGE (string_compose ("Deinterleave not aligned off: %1 cnt: %2 stride: %3", off, cnt, stride), 0 == memcmp (_test2, _comp2, sizeof (float) * (off + cnt)));
+			}
 		}
 	}
 }
@@ -122,6 +149,11 @@ FPUTest::avxFmaTest ()
 	mix_buffers_with_gain = x86_fma_mix_buffers_with_gain;
 	mix_buffers_no_gain   = x86_sse_avx_mix_buffers_no_gain;
 	copy_vector           = x86_sse_avx_copy_vector;
+	fill_ramp             = x86_sse_avx_fill_ramp;
+	apply_gain_vector     = x86_sse_avx_apply_gain_vector;
+	interleave            = x86_sse_interleave;
+	deinterleave          = x86_sse_deinterleave;
+	mix_buffers_with_gain_vector = x86_fma_mix_buffers_with_gain_vector;
 
 	run (align_max, FLT_EPSILON);
 }
@@ -149,6 +181,11 @@ FPUTest::avxTest ()
 	mix_buffers_with_gain = x86_sse_avx_mix_buffers_with_gain;
 	mix_buffers_no_gain   = x86_sse_avx_mix_buffers_no_gain;
 	copy_vector           = x86_sse_avx_copy_vector;
+	fill_ramp             = x86_sse_avx_fill_ramp;
+	apply_gain_vector     = x86_sse_avx_apply_gain_vector;
+	interleave            = x86_sse_interleave;
+	deinterleave          = x86_sse_deinterleave;
+	mix_buffers_with_gain_vector = x86_sse_avx_mix_buffers_with_gain_vector;
 
 	run (align_max);
 }
@@ -176,6 +213,11 @@ FPUTest::avx512fTest ()
 	mix_buffers_with_gain = x86_avx512f_mix_buffers_with_gain;
 	mix_buffers_no_gain   = x86_avx512f_mix_buffers_no_gain;
 	copy_vector           = x86_avx512f_copy_vector;
+	fill_ramp             = x86_avx512f_fill_ramp;
+	apply_gain_vector     = x86_avx512f_apply_gain_vector;
+	interleave            = x86_sse_interleave;
+	deinterleave          = x86_sse_deinterleave;
+	mix_buffers_with_gain_vector = x86_avx512f_mix_buffers_with_gain_vector;
 
 	run (align_max, FLT_EPSILON);
 }
@@ -203,6 +245,11 @@ FPUTest::sseTest ()
 	mix_buffers_with_gain = x86_sse_mix_buffers_with_gain;
 	mix_buffers_no_gain   = x86_sse_mix_buffers_no_gain;
 	copy_vector           = default_copy_vector;
+	fill_ramp             = x86_sse_fill_ramp;
+	apply_gain_vector     = x86_sse_apply_gain_vector;
+	interleave            = x86_sse_interleave;
+	deinterleave          = x86_sse_deinterleave;
+	mix_buffers_with_gain_vector = x86_sse_mix_buffers_with_gain_vector;
 
 	run (align_max);
 }
@@ -227,6 +274,11 @@ FPUTest::neonTest ()
 	mix_buffers_with_gain = arm_neon_mix_buffers_with_gain;
 	mix_buffers_no_gain   = arm_neon_mix_buffers_no_gain;
 	copy_vector           = arm_neon_copy_vector;
+	fill_ramp             = arm_neon_fill_ramp;
+	apply_gain_vector     = arm_neon_apply_gain_vector;
+	interleave            = arm_neon_interleave;
+	deinterleave          = arm_neon_deinterleave;
+	mix_buffers_with_gain_vector = arm_neon_mix_buffers_with_gain_vector;
 
 	run (128);
 }
@@ -251,6 +303,11 @@ FPUTest::veclibTest ()
 	mix_buffers_with_gain = veclib_mix_buffers_with_gain;
 	mix_buffers_no_gain   = veclib_mix_buffers_no_gain;
 	copy_vector           = default_copy_vector;
+	fill_ramp             = veclib_fill_ramp;
+	apply_gain_vector     = veclib_apply_gain_vector;
+	interleave            = default_interleave;
+	deinterleave          = default_deinterleave;
+	mix_buffers_with_gain_vector = veclib_mix_buffers_with_gain_vector;
 
 #ifdef  __aarch64__
 	run (16, FLT_EPSILON);
@@ -47,6 +47,12 @@ private:
 	ARDOUR::mix_buffers_with_gain_t mix_buffers_with_gain;
 	ARDOUR::mix_buffers_no_gain_t   mix_buffers_no_gain;
 	ARDOUR::copy_vector_t           copy_vector;
+	ARDOUR::fill_ramp_t             fill_ramp;
+	ARDOUR::apply_gain_vector_t     apply_gain_vector;
+	ARDOUR::interleave_t            interleave;
+	ARDOUR::deinterleave_t          deinterleave;
+
+	ARDOUR::mix_buffers_with_gain_vector_t mix_buffers_with_gain_vector;
 
 	size_t _size;
 
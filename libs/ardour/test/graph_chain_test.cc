@@ -0,0 +1,121 @@
+#include <string>
+
+#include "ardour/graph.h"
+#include "ardour/graph_edges.h"
+#include "ardour/graphnode.h"
+
+#include "graph_chain_test.h"
+
+CPPUNIT_TEST_SUITE_REGISTRATION (GraphChainTest);
+
+using namespace std;
+using namespace ARDOUR;
+
+class TestNode : public GraphNode
+{
+public:
+	TestNode (string const& name)
+		: GraphNode (std::shared_ptr<Graph> ())
+		, _name (name)
+	{}
+
+	string graph_node_name () const { return _name; }
+	bool   direct_feeds_according_to_reality (std::shared_ptr<GraphNode>, bool* via_send_only = 0) { return false; }
+
+	void set_cost (float usec)
+	{
+		for (int i = 0; i < 200; ++i) {
+			update_cost_estimate (usec);
+		}
+	}
+
+protected:
+	void process () {}
+
+private:
+	string _name;
+};
+
+void
+GraphChainTest::resortTest ()
+{
+	/*  cheap --------------------> master
+	 *  heavy --------------------> master
+	 *  split --+--> light -------> master
+	 *          +--> fx ----------> master
+	 */
+	std::shared_ptr<TestNode> cheap (new TestNode ("cheap"));
+	std::shared_ptr<TestNode> heavy (new TestNode ("heavy"));
+	std::shared_ptr<TestNode> split (new TestNode ("split"));
+	std::shared_ptr<TestNode> light (new TestNode ("light"));
+	std::shared_ptr<TestNode> fx (new TestNode ("fx"));
+	std::shared_ptr<TestNode> master (new TestNode ("master"));
+
+	GraphNodeList nodes;
+	nodes.push_back (cheap);
+	nodes.push_back (heavy);
+	nodes.push_back (split);
+	nodes.push_back (light);
+	nodes.push_back (fx);
+	nodes.push_back (master);
+
+	GraphEdges edges;
+	edges.add (cheap, master, false);
+	edges.add (heavy, master, false);
+	edges.add (split, light, false);
+	edges.add (split, fx, false);
+	edges.add (light, master, false);
+	edges.add (fx, master, false);
+
+	GraphChain chain (nodes, edges);
+
+	/* Without timing information the longest chain comes first */
+	std::shared_ptr<GraphChain::TriggerOrder const> order (chain._trigger_order.reader ());
+	CPPUNIT_ASSERT_EQUAL ((size_t)3, order->init_trigger_list.size ());
+	CPPUNIT_ASSERT (order->init_trigger_list.front () == split);
+
+	/* what a process cycle would be using while the chain is re-sorted */
+	std::shared_ptr<GraphChain::TriggerOrder const> latched (order);
+
+	/* estimates did not change */
+	CPPUNIT_ASSERT (!chain.resort ());
+
+	cheap->set_cost (10);
+	heavy->set_cost (1000);
+	split->set_cost (10);
+	light->set_cost (10);
+	fx->set_cost (500);
+	master->set_cost (10);
+
+	CPPUNIT_ASSERT (chain.resort ());
+
+	/* heavy: 1010us, split: 10 + 500 + 10us, cheap: 20us */
+	order = chain._trigger_order.reader ();
+	node_list_t::const_iterator i = order->init_trigger_list.begin ();
+	CPPUNIT_ASSERT (*i++ == heavy);
+	CPPUNIT_ASSERT (*i++ == split);
+	CPPUNIT_ASSERT (*i++ == cheap);
+
+	/* the expensive branch is activated first */
+	CPPUNIT_ASSERT (order->activation_set.at (split.get ()).front () == fx);
+	CPPUNIT_ASSERT (order->activation_set.at (split.get ()).back () == light);
+
+	/* the order in use is not modified */
+	CPPUNIT_ASSERT (latched != order);
+	CPPUNIT_ASSERT (latched->init_trigger_list.front () == split);
+
+	/* small changes do not cause a re-sort */
+	light->set_cost (15);
+	CPPUNIT_ASSERT (!chain.resort ());
+
+	/* the cheap branch becoming expensive does */
+	light->set_cost (2000);
+	CPPUNIT_ASSERT (chain.resort ());
+	order = chain._trigger_order.reader ();
+	CPPUNIT_ASSERT (order->activation_set.at (split.get ()).front () == light);
+	CPPUNIT_ASSERT (order->init_trigger_list.front () == split);
+
+	/* the topology is unchanged */
+	CPPUNIT_ASSERT_EQUAL ((size_t)2, split->activation_set (&chain).size ());
+	CPPUNIT_ASSERT (order->activation_set.at (master.get ()).empty ());
+}
@@ -0,0 +1,12 @@
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+class GraphChainTest : public CppUnit::TestFixture
+{
+	CPPUNIT_TEST_SUITE (GraphChainTest);
+	CPPUNIT_TEST (resortTest);
+	CPPUNIT_TEST_SUITE_END ();
+
+public:
+	void resortTest ();
+};
@@ -0,0 +1,199 @@
+#include <cmath>
+#include <limits>
+
+#include "evoral/types.h"
+
+#include "ardour/audio_buffer.h"
+#include "ardour/buffer_set.h"
+#include "ardour/chan_count.h"
+#include "ardour/meter.h"
+#include "ardour/meter_snapshot.h"
+#include "ardour/midi_buffer.h"
+
+#include "meter_snapshot_test.h"
+
+CPPUNIT_TEST_SUITE_REGISTRATION (MeterSnapshotTest);
+
+using namespace std;
+using namespace ARDOUR;
+
+static pframes_t const n_samples = 1024;
+
+/* one MIDI channel with a full-velocity note-on, a half-scale audio
+ * channel and a silent one
+ */
+static void
+run_meter (PeakMeter& meter, BufferSet& bufs)
+{
+	ChanCount const streams (meter.input_streams ());
+
+	bufs.ensure_buffers (streams, n_samples);
+	bufs.set_count (streams);
+
+	Sample half[n_samples];
+	for (pframes_t i = 0; i < n_samples; ++i) {
+		half[i] = 0.5f;
+	}
+	bufs.get_audio (0).read_from (half, n_samples);
+	bufs.get_audio (1).silence (n_samples);
+
+	uint8_t const note_on[3] = { 0x90, 60, 127 };
+	bufs.get_midi (0).clear ();
+	bufs.get_midi (0).push_back (0, Evoral::MIDI_EVENT, 3, note_on);
+
+	/* the first cycle after configuration only resets the meter */
+	meter.run (bufs, 0, n_samples, 1.0, n_samples, true);
+	meter.run (bufs, n_samples, 2 * n_samples, 1.0, n_samples, true);
+}
+
+static void
+setup_meter (PeakMeter& meter, MeterType type)
+{
+	ChanCount streams (DataType::MIDI, 1);
+	streams.set (DataType::AUDIO, 2);
+
+	CPPUNIT_ASSERT (meter.configure_io (streams, streams));
+	meter.set_meter_type (type);
+}
+
+void
+MeterSnapshotTest::addTest ()
+{
+	PeakMeter meter (*_session, "snapshot");
+	BufferSet bufs;
+	setup_meter (meter, MeterPeak);
+	run_meter (meter, bufs);
+
+	MeterSnapshot snapshot (4, 8);
+	snapshot.clear (42);
+
+	PBD::ID const id;
+	CPPUNIT_ASSERT (snapshot.add (id, meter));
+
+	CPPUNIT_ASSERT_EQUAL (samplepos_t (42), snapshot.sample);
+	CPPUNIT_ASSERT_EQUAL (1U, snapshot.n_routes);
+	CPPUNIT_ASSERT_EQUAL (3U, snapshot.channels_used);
+	CPPUNIT_ASSERT_EQUAL (0, snapshot.route_index (id));
+	CPPUNIT_ASSERT_EQUAL (-1, snapshot.route_index (PBD::ID ()));
+
+	CPPUNIT_ASSERT_EQUAL (0U, snapshot.first_channel[0]);
+	CPPUNIT_ASSERT_EQUAL (3U, snapshot.n_channels[0]);
+	CPPUNIT_ASSERT_EQUAL (1U, snapshot.n_midi[0]);
+	CPPUNIT_ASSERT_EQUAL (MeterPeak, snapshot.meter_type[0]);
+
+	/* MIDI peak is note activity, not dB */
+	CPPUNIT_ASSERT_DOUBLES_EQUAL (1.0, snapshot.peak[0], 1e-6);
+	CPPUNIT_ASSERT_DOUBLES_EQUAL (meter.meter_level (0, MeterPeak), snapshot.peak[0], 1e-6);
+
+	/* audio peak in dBFS */
+	CPPUNIT_ASSERT_DOUBLES_EQUAL (20.0 * log10 (0.5), snapshot.peak[1], 1e-3);
+	CPPUNIT_ASSERT (std::isinf (snapshot.peak[2]) && snapshot.peak[2] < 0);
+
+	/* MCP ignores MIDI on mixed routes */
+	CPPUNIT_ASSERT_DOUBLES_EQUAL (meter.meter_level (0, MeterMCP), snapshot.mcp[0], 1e-6);
+	CPPUNIT_ASSERT_DOUBLES_EQUAL (snapshot.peak[1], snapshot.mcp[0], 1e-6);
+
+	for (uint32_t c = 0; c < 3; ++c) {
+		float const expected = meter.meter_level (c, MeterMaxPeak);
+		if (std::isinf (expected)) {
+			CPPUNIT_ASSERT (std::isinf (snapshot.max_peak_db (c)));
+		} else {
+			CPPUNIT_ASSERT_DOUBLES_EQUAL (expected, snapshot.max_peak_db (c), 1e-4);
+		}
+	}
+	CPPUNIT_ASSERT_DOUBLES_EQUAL (20.0 * log10 (0.5), snapshot.max_peak_db (1), 1e-3);
+
+	/* a second route follows the first one's channels */
+	PBD::ID const id2;
+	CPPUNIT_ASSERT (snapshot.add (id2, meter));
+	CPPUNIT_ASSERT_EQUAL (2U, snapshot.n_routes);
+	CPPUNIT_ASSERT_EQUAL (6U, snapshot.channels_used);
+	CPPUNIT_ASSERT_EQUAL (1, snapshot.route_index (id2));
+	CPPUNIT_ASSERT_EQUAL (3U, snapshot.first_channel[1]);
+	CPPUNIT_ASSERT_DOUBLES_EQUAL (snapshot.peak[0], snapshot.peak[3], 1e-6);
+
+	snapshot.clear (0);
+	CPPUNIT_ASSERT_EQUAL (0U, snapshot.n_routes);
+	CPPUNIT_ASSERT_EQUAL (0U, snapshot.channels_used);
+	CPPUNIT_ASSERT_EQUAL (-1, snapshot.route_index (id));
+}
+
+void
+MeterSnapshotTest::levelTest ()
+{
+	PeakMeter meter (*_session, "snapshot");
+	BufferSet bufs;
+	setup_meter (meter, MeterK20);
+	run_meter (meter, bufs);
+
+	MeterSnapshot snapshot (2, 6);
+	snapshot.clear (0);
+
+	/* put a second route first, so that channel indices of the
+	 * tested one do not start at 0 */
+	PBD::ID const other;
+	CPPUNIT_ASSERT (snapshot.add (other, meter));
+
+	PBD::ID const id;
+	CPPUNIT_ASSERT (snapshot.add (id, meter));
+	int const r = snapshot.route_index (id);
+	CPPUNIT_ASSERT_EQUAL (1, r);
+
+	uint32_t const c0 = snapshot.first_channel[r];
+	CPPUNIT_ASSERT_EQUAL (3U, c0);
+	CPPUNIT_ASSERT_EQUAL (MeterK20, snapshot.meter_type[r]);
+
+	/* MIDI channels have no K-meter, their level is the peak */
+	CPPUNIT_ASSERT_DOUBLES_EQUAL (snapshot.peak[c0], snapshot.level_db (r, c0), 1e-6);
+	CPPUNIT_ASSERT_DOUBLES_EQUAL (1.0, snapshot.level_db (r, c0), 1e-6);
+
+	/* audio channels are converted from the meter's coefficient */
+	float const k20 = meter.meter_level (1, MeterK20);
+	CPPUNIT_ASSERT (!std::isinf (k20));
+	CPPUNIT_ASSERT_DOUBLES_EQUAL (k20, snapshot.level_db (r, c0 + 1), 1e-4);
+
+	float const silent = snapshot.level_db (r, c0 + 2);
+	CPPUNIT_ASSERT (silent < -100 || (std::isinf (silent) && silent < 0));
+
+	/* after a type change without a level, fall back to the peak */
+	meter.set_meter_type (MeterPeak0dB);
+	snapshot.clear (0);
+	CPPUNIT_ASSERT (snapshot.add (id, meter));
+	for (uint32_t c = 0; c < 3; ++c) {
+		float const l = snapshot.level_db (0, c);
+		if (std::isinf (snapshot.peak[c])) {
+			CPPUNIT_ASSERT (std::isinf (l));
+		} else {
+			CPPUNIT_ASSERT_DOUBLES_EQUAL (snapshot.peak[c], l, 1e-6);
+		}
+	}
+}
+
+void
+MeterSnapshotTest::capacityTest ()
+{
+	PeakMeter meter (*_session, "snapshot");
+	BufferSet bufs;
+	setup_meter (meter, MeterPeak);
+	run_meter (meter, bufs);
+
+	/* not enough channels, MIDI counts */
+	MeterSnapshot narrow (4, 2);
+	narrow.clear (0);
+	CPPUNIT_ASSERT (!narrow.add (PBD::ID (), meter));
+	CPPUNIT_ASSERT_EQUAL (0U, narrow.n_routes);
+	CPPUNIT_ASSERT_EQUAL (0U, narrow.channels_used);
+
+	/* not enough routes */
+	MeterSnapshot small (1, 8);
+	small.clear (0);
+	CPPUNIT_ASSERT (small.add (PBD::ID (), meter));
+	CPPUNIT_ASSERT (!small.add (PBD::ID (), meter));
+	CPPUNIT_ASSERT_EQUAL (1U, small.n_routes);
+	CPPUNIT_ASSERT_EQUAL (3U, small.channels_used);
+
+	/* an empty snapshot has no room at all */
+	MeterSnapshot empty;
+	CPPUNIT_ASSERT_EQUAL (0U, empty.max_routes ());
+	CPPUNIT_ASSERT (!empty.add (PBD::ID (), meter));
+}
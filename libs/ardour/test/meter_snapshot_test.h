@@ -0,0 +1,15 @@
+#include "test_needing_session.h"
+
+class MeterSnapshotTest : public TestNeedingSession
+{
+	CPPUNIT_TEST_SUITE (MeterSnapshotTest);
+	CPPUNIT_TEST (addTest);
+	CPPUNIT_TEST (levelTest);
+	CPPUNIT_TEST (capacityTest);
+	CPPUNIT_TEST_SUITE_END ();
+
+public:
+	void addTest ();
+	void levelTest ();
+	void capacityTest ();
+};
@@ -0,0 +1,232 @@
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+#include <glibmm/fileutils.h>
+#include <glibmm/miscutils.h>
+
+#include "pbd/gstdio_compat.h"
+
+#include "ardour/audiosource.h"
+#include "ardour/filename_extensions.h"
+#include "ardour/session.h"
+#include "ardour/session_directory.h"
+#include "ardour/source_factory.h"
+
+#include "peak_levels_test.h"
+#include "test_util.h"
+
+CPPUNIT_TEST_SUITE_REGISTRATION (PeakLevelsTest);
+
+using namespace std;
+using namespace ARDOUR;
+
+/* 17600 peaks at 256 samples per peak and a partial one, reduced to
+ * 1101 and 69 coarser peaks.
+ */
+static samplecnt_t const n_full_peaks = 17600;
+static samplecnt_t const source_length = 256 * n_full_peaks + 100;
+
+/* byte offset of PeakPyramidFooter::factor, and size of the footer */
+static size_t const footer_factor_byte = 12;
+static size_t const footer_size = 40;
+
+void
+PeakLevelsTest::setUp ()
+{
+	TestNeedingSession::setUp ();
+
+	std::string const test_wav_path = Glib::build_filename (new_test_output_dir (), "peaks.wav");
+	_source = std::dynamic_pointer_cast<AudioSource> (SourceFactory::createWritable (DataType::AUDIO, *_session, test_wav_path, get_test_sample_rate ()));
+	CPPUNIT_ASSERT (_source);
+
+	AudioSource::set_build_peakfiles (false);
+
+	/* noise with a slowly changing envelope */
+	Sample   buf[65536];
+	uint32_t rnd = 1;
+	for (samplecnt_t written = 0; written < source_length;) {
+		samplecnt_t const n = min<samplecnt_t> (65536, source_length - written);
+		for (samplecnt_t i = 0; i < n; ++i) {
+			rnd = rnd * 1664525 + 1013904223;
+			float const env = 0.1f + 0.8f * ((written + i) % 100003) / 100003.f;
+			buf[i] = env * ((rnd >> 8) / (float) (1 << 24) - 0.5f);
+		}
+		CPPUNIT_ASSERT_EQUAL (n, _source->write (buf, n));
+		written += n;
+	}
+
+	/* build the peakfile and its pyramid */
+	AudioSource::set_build_missing_peakfiles (true);
+	AudioSource::set_build_peakfiles (true);
+	CPPUNIT_ASSERT_EQUAL (0, _source->setup_peakfile ());
+}
+
+void
+PeakLevelsTest::tearDown ()
+{
+	AudioSource::set_build_missing_peakfiles (false);
+	AudioSource::set_build_peakfiles (false);
+	_source.reset ();
+	TestNeedingSession::tearDown ();
+}
+
+std::string
+PeakLevelsTest::levels_path () const
+{
+	std::string const dir = _session->session_directory ().peak_path ();
+	std::string const suffix (peak_levels_suffix);
+
+	Glib::Dir d (dir);
+	for (Glib::DirIterator i = d.begin (); i != d.end (); ++i) {
+		std::string const f = *i;
+		if (f.size () > suffix.size () && f.compare (f.size () - suffix.size (), suffix.size (), suffix) == 0) {
+			return Glib::build_filename (dir, f);
+		}
+	}
+	return "";
+}
+
+std::vector<PeakData>
+PeakLevelsTest::read_peaks (samplecnt_t spp, samplecnt_t npeaks)
+{
+	std::vector<PeakData> p (npeaks);
+	CPPUNIT_ASSERT_EQUAL (0, _source->read_peaks (&p[0], npeaks, 0, npeaks * spp, spp));
+	return p;
+}
+
+static std::vector<PeakData>
+reduce (std::vector<PeakData> const& p, size_t factor, size_t n_out)
+{
+	std::vector<PeakData> r (n_out);
+	for (size_t i = 0; i < n_out; ++i) {
+		r[i] = p[i * factor];
+		for (size_t j = i * factor + 1; j < (i + 1) * factor; ++j) {
+			r[i].min = min (r[i].min, p[j].min);
+			r[i].max = max (r[i].max, p[j].max);
+		}
+	}
+	return r;
+}
+
+static void
+check_peaks (std::vector<PeakData> const& a, std::vector<PeakData> const& b)
+{
+	CPPUNIT_ASSERT_EQUAL (a.size (), b.size ());
+	for (size_t i = 0; i < a.size (); ++i) {
+		CPPUNIT_ASSERT_EQUAL (a[i].min, b[i].min);
+		CPPUNIT_ASSERT_EQUAL (a[i].max, b[i].max);
+	}
+}
+
+static std::vector<char>
+read_file (std::string const& path)
+{
+	std::ifstream f (path.c_str (), std::ios::binary);
+	return std::vector<char> ((std::istreambuf_iterator<char> (f)), std::istreambuf_iterator<char> ());
+}
+
+static void
+write_file (std::string const& path, std::vector<char> const& data)
+{
+	std::ofstream f (path.c_str (), std::ios::binary | std::ios::trunc);
+	f.write (&data[0], data.size ());
+}
+
+/** A pyramid that does not match is ignored, peaks are then read from the peakfile only */
+void
+PeakLevelsTest::reload_and_check_fallback ()
+{
+	std::vector<PeakData> const fine = read_peaks (256, n_full_peaks);
+
+	CPPUNIT_ASSERT_EQUAL (0, _source->setup_peakfile ());
+	CPPUNIT_ASSERT_EQUAL ((size_t) 0, _source->n_peak_levels ());
+
+	check_peaks (fine, read_peaks (256, n_full_peaks));
+	CPPUNIT_ASSERT_EQUAL (n_full_peaks / 16, (samplecnt_t) read_peaks (4096, n_full_peaks / 16).size ());
+}
+
+void
+PeakLevelsTest::roundTripTest ()
+{
+	CPPUNIT_ASSERT_EQUAL ((size_t) 3, _source->n_peak_levels ());
+
+	std::string const levels = levels_path ();
+	CPPUNIT_ASSERT (!levels.empty ());
+
+	/* the peakfile only holds the fine peaks, as read by older versions */
+	std::string const peakfile = levels.substr (0, levels.size () - strlen (peak_levels_suffix));
+	GStatBuf statbuf;
+	CPPUNIT_ASSERT_EQUAL (0, g_stat (peakfile.c_str (), &statbuf));
+	CPPUNIT_ASSERT_EQUAL ((off_t) ((n_full_peaks + 1) * sizeof (PeakData)), (off_t) statbuf.st_size);
+
+	/* levels file: 1101 + 69 peaks and the footer */
+	CPPUNIT_ASSERT_EQUAL (0, g_stat (levels.c_str (), &statbuf));
+	CPPUNIT_ASSERT_EQUAL ((off_t) ((1101 + 69) * sizeof (PeakData) + footer_size), (off_t) statbuf.st_size);
+
+	std::vector<PeakData> const fine    = read_peaks (256, n_full_peaks);
+	std::vector<PeakData> const level_1 = reduce (fine, 16, n_full_peaks / 16);
+	std::vector<PeakData> const level_2 = reduce (level_1, 16, n_full_peaks / 256);
+
+	check_peaks (level_1, read_peaks (4096, n_full_peaks / 16));
+	check_peaks (level_2, read_peaks (65536, n_full_peaks / 256));
+
+	/* and again after loading the pyramid */
+	CPPUNIT_ASSERT_EQUAL (0, _source->setup_peakfile ());
+	CPPUNIT_ASSERT_EQUAL ((size_t) 3, _source->n_peak_levels ());
+
+	check_peaks (fine, read_peaks (256, n_full_peaks));
+	check_peaks (level_1, read_peaks (4096, n_full_peaks / 16));
+	check_peaks (level_2, read_peaks (65536, n_full_peaks / 256));
+}
+
+void
+PeakLevelsTest::truncatedTest ()
+{
+	std::string const levels = levels_path ();
+	std::vector<char> data   = read_file (levels);
+
+	/* drop the last coarse peak, keep the footer */
+	std::vector<char> footer (data.end () - footer_size, data.end ());
+	data.resize (data.size () - footer_size - sizeof (PeakData));
+	data.insert (data.end (), footer.begin (), footer.end ());
+	write_file (levels, data);
+
+	reload_and_check_fallback ();
+
+	/* partially written footer */
+	data.resize (data.size () - footer_size / 2);
+	write_file (levels, data);
+
+	reload_and_check_fallback ();
+}
+
+void
+PeakLevelsTest::corruptFooterTest ()
+{
+	std::string const levels = levels_path ();
+	std::vector<char> data   = read_file (levels);
+
+	data[data.size () - footer_size] ^= 0x20;
+	write_file (levels, data);
+
+	reload_and_check_fallback ();
+}
+
+void
+PeakLevelsTest::factorMismatchTest ()
+{
+	std::string const levels = levels_path ();
+	std::vector<char> data   = read_file (levels);
+
+	uint32_t factor;
+	memcpy (&factor, &data[data.size () - footer_size + footer_factor_byte], sizeof (factor));
+	CPPUNIT_ASSERT_EQUAL ((uint32_t) 16, factor);
+
+	factor = 8;
+	memcpy (&data[data.size () - footer_size + footer_factor_byte], &factor, sizeof (factor));
+	write_file (levels, data);
+
+	reload_and_check_fallback ();
+}
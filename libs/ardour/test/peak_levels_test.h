@@ -0,0 +1,36 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "ardour/types.h"
+#include "test_needing_session.h"
+
+namespace ARDOUR {
+	class AudioSource;
+}
+
+class PeakLevelsTest : public TestNeedingSession
+{
+	CPPUNIT_TEST_SUITE (PeakLevelsTest);
+	CPPUNIT_TEST (roundTripTest);
+	CPPUNIT_TEST (truncatedTest);
+	CPPUNIT_TEST (corruptFooterTest);
+	CPPUNIT_TEST (factorMismatchTest);
+	CPPUNIT_TEST_SUITE_END ();
+
+public:
+	void setUp ();
+	void tearDown ();
+
+	void roundTripTest ();
+	void truncatedTest ();
+	void corruptFooterTest ();
+	void factorMismatchTest ();
+
+private:
+	std::string levels_path () const;
+	void reload_and_check_fallback ();
+	std::vector<ARDOUR::PeakData> read_peaks (ARDOUR::samplecnt_t spp, ARDOUR::samplecnt_t npeaks);
+
+	std::shared_ptr<ARDOUR::AudioSource> _source;
+};
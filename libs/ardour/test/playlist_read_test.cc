@@ -16,10 +16,13 @@
  * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
  */
 
+#include <cstdlib>
+
 #include "ardour/playlist.h"
 #include "ardour/region.h"
 #include "ardour/audioplaylist.h"
 #include "ardour/audioregion.h"
+#include "ardour/region_factory.h"
 #include "ardour/session.h"
 #include "playlist_read_test.h"
 
@@ -288,3 +291,68 @@ PlaylistReadTest::enclosedTransparentReadTest ()
 
 	}
 }
+
+static bool
+same_regions (std::shared_ptr<RegionList> a, std::shared_ptr<RegionList> b)
+{
+	return *a == *b;
+}
+
+void
+PlaylistReadTest::check_indexed_queries ()
+{
+	for (samplepos_t p = 0; p < 110000; p += 997) {
+		timepos_t const pos (p);
+		timepos_t const end (p + 1500);
+
+		Playlist::set_region_index_enabled (false);
+		std::shared_ptr<RegionList> at      = _playlist->regions_at (pos);
+		std::shared_ptr<RegionList> touched = _playlist->regions_touched (pos, end);
+		std::shared_ptr<RegionList> within  = _playlist->regions_with_start_within (Temporal::TimeRange (pos, end));
+		uint32_t const              cnt     = _playlist->count_regions_at (pos);
+		std::shared_ptr<Region>     next    = _playlist->find_next_region (pos, Start, 1);
+		std::shared_ptr<Region>     prev    = _playlist->find_next_region (pos, Start, -1);
+
+		Playlist::set_region_index_enabled (true);
+		CPPUNIT_ASSERT (same_regions (at, _playlist->regions_at (pos)));
+		CPPUNIT_ASSERT (same_regions (touched, _playlist->regions_touched (pos, end)));
+		CPPUNIT_ASSERT (same_regions (within, _playlist->regions_with_start_within (Temporal::TimeRange (pos, end))));
+		CPPUNIT_ASSERT_EQUAL (cnt, _playlist->count_regions_at (pos));
+		CPPUNIT_ASSERT (next == _playlist->find_next_region (pos, Start, 1));
+		CPPUNIT_ASSERT (prev == _playlist->find_next_region (pos, Start, -1));
+	}
+}
+
+void
+PlaylistReadTest::indexedQueryTest ()
+{
+	/* Region queries on a playlist which is large enough to be indexed
+	 * must give the same results as those without the index.
+	 */
+
+	std::vector<std::shared_ptr<Region> > r;
+
+	srand (17);
+
+	for (int i = 0; i < 200; ++i) {
+		PBD::PropertyList plist;
+		plist.add (Properties::start, timepos_t (0));
+		plist.add (Properties::length, 1 + rand () % 4000);
+		r.push_back (RegionFactory::create (_source, plist));
+		_playlist->add_region (r.back (), timepos_t (rand () % 100000));
+	}
+
+	check_indexed_queries ();
+
+	/* moving and removing regions must invalidate the index */
+
+	for (int i = 0; i < 50; ++i) {
+		r[i]->set_position (timepos_t (rand () % 100000));
+	}
+
+	for (int i = 50; i < 100; ++i) {
+		_playlist->remove_region (r[i]);
+	}
+
+	check_indexed_queries ();
+}
@@ -0,0 +1,110 @@
+#include "ardour/audioplaylist.h"
+#include "ardour/audioregion.h"
+
+#include "playlist_render_plan_test.h"
+
+CPPUNIT_TEST_SUITE_REGISTRATION (PlaylistRenderPlanTest);
+
+using namespace std;
+using namespace ARDOUR;
+
+/* reads are 64 samples, the render plan is cached for 8 reads from the
+ * first one, so all reads below are within the cached range.
+ */
+static samplecnt_t const read_cnt = 64;
+
+void
+PlaylistRenderPlanTest::setUp ()
+{
+	AudioRegionTest::setUp ();
+
+	_ar[0]->set_length (timecnt_t (1024));
+	_ar[0]->set_fade_in_active (false);
+	_ar[0]->set_fade_out_active (false);
+	_audio_playlist->add_region (_ar[0], timepos_t (200));
+}
+
+/** Read from the playlist and compare with the staircase of _ar[0] at its current bounds and gain */
+void
+PlaylistRenderPlanTest::check_read (samplepos_t start, samplecnt_t cnt)
+{
+	Sample buf[read_cnt];
+	Sample mbuf[read_cnt];
+	float  gbuf[read_cnt];
+
+	CPPUNIT_ASSERT (cnt <= read_cnt);
+	CPPUNIT_ASSERT_EQUAL (cnt, _audio_playlist->read (buf, mbuf, gbuf, timepos_t (start), timecnt_t (cnt), 0).samples ());
+
+	samplepos_t const pos   = _ar[0]->position ().samples ();
+	samplepos_t const end   = pos + _ar[0]->length ().samples ();
+	samplepos_t const first = _ar[0]->start ().samples ();
+	gain_t const      gain  = _ar[0]->scale_amplitude ();
+
+	for (samplecnt_t i = 0; i < cnt; ++i) {
+		samplepos_t const s = start + i;
+		if (s < pos || s >= end) {
+			CPPUNIT_ASSERT_EQUAL (0.f, buf[i]);
+		} else {
+			CPPUNIT_ASSERT_EQUAL (float (s - pos + first) * gain, buf[i]);
+		}
+	}
+}
+
+/* While the playlist is frozen ContentsChanged is deferred, so the cached
+ * plan must be invalidated by the change of the region alone.
+ */
+
+void
+PlaylistRenderPlanTest::moveTest ()
+{
+	check_read (128, read_cnt);
+	check_read (192, read_cnt);
+
+	_playlist->freeze ();
+	_ar[0]->set_position (timepos_t (240));
+	CPPUNIT_ASSERT_EQUAL ((samplepos_t) 240, _ar[0]->position ().samples ());
+	check_read (192, read_cnt);
+
+	_ar[0]->set_position (timepos_t (160));
+	check_read (128, read_cnt);
+	check_read (192, read_cnt);
+	_playlist->thaw ();
+
+	check_read (256, read_cnt);
+	check_read (128, read_cnt);
+}
+
+void
+PlaylistRenderPlanTest::trimTest ()
+{
+	check_read (192, read_cnt);
+	check_read (256, read_cnt);
+
+	_playlist->freeze ();
+	_ar[0]->trim_front (timepos_t (220));
+	CPPUNIT_ASSERT_EQUAL ((samplepos_t) 220, _ar[0]->position ().samples ());
+	check_read (192, read_cnt);
+
+	_ar[0]->trim_end (timepos_t (300));
+	CPPUNIT_ASSERT (_ar[0]->position ().samples () + _ar[0]->length ().samples () <= 320);
+	check_read (256, read_cnt);
+	_playlist->thaw ();
+
+	check_read (192, read_cnt);
+	check_read (256, read_cnt);
+}
+
+void
+PlaylistRenderPlanTest::gainTest ()
+{
+	check_read (192, read_cnt);
+
+	_playlist->freeze ();
+	_ar[0]->set_scale_amplitude (0.5);
+	check_read (192, read_cnt);
+	check_read (256, read_cnt);
+	_playlist->thaw ();
+
+	_ar[0]->set_scale_amplitude (0.25);
+	check_read (192, read_cnt);
+}
@@ -0,0 +1,21 @@
+#include "ardour/types.h"
+#include "audio_region_test.h"
+
+class PlaylistRenderPlanTest : public AudioRegionTest
+{
+	CPPUNIT_TEST_SUITE (PlaylistRenderPlanTest);
+	CPPUNIT_TEST (moveTest);
+	CPPUNIT_TEST (trimTest);
+	CPPUNIT_TEST (gainTest);
+	CPPUNIT_TEST_SUITE_END ();
+
+public:
+	void setUp ();
+
+	void moveTest ();
+	void trimTest ();
+	void gainTest ();
+
+private:
+	void check_read (ARDOUR::samplepos_t start, ARDOUR::samplecnt_t cnt);
+};
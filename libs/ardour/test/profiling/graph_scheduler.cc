@@ -0,0 +1,163 @@
+#include <iostream>
+#include <cstdlib>
+#include <getopt.h>
+
+#include <glibmm.h>
+
+#include "pbd/compose.h"
+#include "pbd/strsplit.h"
+#include "pbd/textreceiver.h"
+
+#include "ardour/ardour.h"
+#include "ardour/audio_track.h"
+#include "ardour/audioengine.h"
+#include "ardour/rc_configuration.h"
+#include "ardour/session.h"
+
+#include "test_ui.h"
+#include "test_util.h"
+
+using namespace std;
+using namespace PBD;
+using namespace ARDOUR;
+
+static const char* localedir = LOCALEDIR;
+
+static void
+usage ()
+{
+	cerr << "graph_scheduler - compare DSP load of process-graph schedulers\n\n"
+	     << "Usage: graph_scheduler [ OPTIONS ]\n\n"
+	     << "Options:\n"
+	     << "  -c, --cycles <num>     number of process cycles to run (default 4096)\n"
+	     << "  -r, --routes <list>    comma separated list of track counts (default 32,64,128,256)\n"
+	     << "  -t, --threads <list>   comma separated list of DSP thread counts (default 2,4,8)\n"
+	     << "  -h, --help             display this help and exit\n\n";
+	::exit (EXIT_SUCCESS);
+}
+
+static vector<int>
+parse_list (char const* arg)
+{
+	vector<int> rv;
+	vector<string> tokens;
+	split (string (arg), tokens, ',');
+	for (auto const& t : tokens) {
+		int v = atoi (t.c_str ());
+		if (v > 0) {
+			rv.push_back (v);
+		}
+	}
+	return rv;
+}
+
+/** run @param n_cycles process cycles, return average and max DSP load in percent */
+static void
+run_cycles (Session* session, int n_cycles, double& avg_load, double& max_load)
+{
+	pframes_t const nframes    = session->engine ().samples_per_cycle ();
+	double const    cycle_usec = 1e6 * nframes / session->engine ().sample_rate ();
+	int64_t         total      = 0;
+
+	max_load = 0;
+
+	PBD::Mutex::Lock lm (AudioEngine::instance ()->process_lock ());
+
+	/* warm up */
+	for (int i = 0; i < 64; ++i) {
+		session->process (nframes);
+	}
+
+	for (int i = 0; i < n_cycles; ++i) {
+		int64_t t0 = g_get_monotonic_time ();
+		session->process (nframes);
+		int64_t dt = g_get_monotonic_time () - t0;
+		total += dt;
+		max_load = max (max_load, 100.0 * dt / cycle_usec);
+	}
+
+	avg_load = 100.0 * total / (n_cycles * cycle_usec);
+}
+
+int
+main (int argc, char* argv[])
+{
+	int         n_cycles = 4096;
+	vector<int> routes;
+	vector<int> threads;
+
+	routes.push_back (32);
+	routes.push_back (64);
+	routes.push_back (128);
+	routes.push_back (256);
+
+	threads.push_back (2);
+	threads.push_back (4);
+	threads.push_back (8);
+
+	const char* optstring = "c:hr:t:";
+
+	const struct option longopts[] = {
+		{ "cycles",  required_argument, 0, 'c' },
+		{ "help",    no_argument,       0, 'h' },
+		{ "routes",  required_argument, 0, 'r' },
+		{ "threads", required_argument, 0, 't' },
+		{ 0, 0, 0, 0 }
+	};
+
+	int c = 0;
+	while (EOF != (c = getopt_long (argc, argv, optstring, longopts, (int*)0))) {
+		switch (c) {
+			case 'c':
+				n_cycles = max (1, atoi (optarg));
+				break;
+			case 'r':
+				routes = parse_list (optarg);
+				break;
+			case 't':
+				threads = parse_list (optarg);
+				break;
+			case 'h':
+				usage ();
+				break;
+			default:
+				usage ();
+				break;
+		}
+	}
+
+	ARDOUR::init (true, localedir);
+	TestUI* test_ui = new TestUI ();
+
+	cout << "threads\troutes\tscheduler\tavg-load[%]\tmax-load[%]\n";
+
+	for (auto const& t : threads) {
+		Config->set_processor_usage (t);
+		create_and_start_dummy_backend ();
+
+		for (auto const& r : routes) {
+			string dir = new_test_output_dir (string_compose ("graph_scheduler_%1_%2", t, r));
+			Session* session = new Session (*AudioEngine::instance (), dir, "graph_scheduler");
+			AudioEngine::instance ()->set_session (session);
+
+			session->new_audio_track (1, 2, std::shared_ptr<RouteGroup> (), r, "Audio", PresentationInfo::max_order);
+
+			for (int ws = 0; ws < 2; ++ws) {
+				double avg_load, max_load;
+				Config->set_graph_work_stealing (ws != 0);
+				run_cycles (session, n_cycles, avg_load, max_load);
+				cout << t << "\t" << r << "\t" << (ws ? "work-stealing" : "mpmc-queue   ")
+				     << "\t" << avg_load << "\t" << max_load << "\n";
+			}
+
+			AudioEngine::instance ()->remove_session ();
+			delete session;
+		}
+
+		stop_and_destroy_backend ();
+	}
+
+	delete test_ui;
+	ARDOUR::cleanup ();
+	return 0;
+}
@@ -0,0 +1,153 @@
+#include <cmath>
+#include <cstring>
+#include <cstdlib>
+#include <iostream>
+
+#include "pbd/malign.h"
+#include "pbd/microseconds.h"
+
+#include "ardour/ardour.h"
+#include "ardour/mix.h"
+#include "ardour/runtime_functions.h"
+
+using namespace std;
+using namespace ARDOUR;
+
+/* Compare the throughput of the runtime-selected (optimized) mix routines
+ * with the generic C implementation.
+ *
+ * usage: mix_functions [block-size (default 1024)]
+ */
+
+static const char* localedir = LOCALEDIR;
+
+static const int iterations = 100000;
+
+static float* src;
+static float* dst;
+static float* gain;
+static float* ilv;
+
+static void
+report (const char* name, PBD::microseconds_t t_opt, PBD::microseconds_t t_def, float max_diff)
+{
+	cout << name
+	     << "\t" << (1000.0 * t_opt / iterations)
+	     << "\t" << (1000.0 * t_def / iterations)
+	     << "\t" << (t_def / (double) std::max<PBD::microseconds_t> (1, t_opt))
+	     << "\t" << max_diff << "\n";
+}
+
+static float
+diff (float const* a, float const* b, pframes_t n)
+{
+	float d = 0;
+	for (pframes_t i = 0; i < n; ++i) {
+		d = std::max (d, fabsf (a[i] - b[i]));
+	}
+	return d;
+}
+
+int
+main (int argc, char* argv[])
+{
+	pframes_t const n_samples = argc > 1 ? std::max (1, atoi (argv[1])) : 1024;
+
+	ARDOUR::init (true, localedir);
+
+	cache_aligned_malloc ((void**) &src, n_samples * sizeof (float));
+	cache_aligned_malloc ((void**) &dst, n_samples * sizeof (float));
+	cache_aligned_malloc ((void**) &gain, n_samples * sizeof (float));
+	cache_aligned_malloc ((void**) &ilv, 2 * n_samples * sizeof (float));
+
+	float* ref = new float[n_samples];
+
+	for (pframes_t i = 0; i < n_samples; ++i) {
+		src[i]  = rand () / (float) RAND_MAX - .5f;
+		gain[i] = rand () / (float) RAND_MAX;
+	}
+
+	PBD::microseconds_t t0, t1, t2;
+
+	cout << "block size " << n_samples << " [ns/block]\n";
+	cout << "function\toptimized\tdefault\t\tspeedup\tmax-diff\n";
+
+	/* fill ramp */
+	t0 = PBD::get_microseconds ();
+	for (int i = 0; i < iterations; ++i) {
+		fill_ramp (dst, n_samples, 0.1f, 1e-5f);
+	}
+	t1 = PBD::get_microseconds ();
+	for (int i = 0; i < iterations; ++i) {
+		default_fill_ramp (ref, n_samples, 0.1f, 1e-5f);
+	}
+	t2 = PBD::get_microseconds ();
+	report ("fill_ramp\t", t1 - t0, t2 - t1, diff (dst, ref, n_samples));
+
+	/* apply gain vector; gain is close to unity to not run into denormals */
+	for (pframes_t i = 0; i < n_samples; ++i) {
+		gain[i] = 1.f - 1e-7f * i;
+	}
+	copy_vector (dst, src, n_samples);
+	copy_vector (ref, src, n_samples);
+
+	t0 = PBD::get_microseconds ();
+	for (int i = 0; i < iterations; ++i) {
+		apply_gain_vector (dst, gain, n_samples);
+	}
+	t1 = PBD::get_microseconds ();
+	for (int i = 0; i < iterations; ++i) {
+		default_apply_gain_vector (ref, gain, n_samples);
+	}
+	t2 = PBD::get_microseconds ();
+	report ("apply_gain_vector", t1 - t0, t2 - t1, diff (dst, ref, n_samples));
+
+	/* mix buffers with gain vector */
+	memset (dst, 0, n_samples * sizeof (float));
+	memset (ref, 0, n_samples * sizeof (float));
+
+	t0 = PBD::get_microseconds ();
+	for (int i = 0; i < iterations; ++i) {
+		mix_buffers_with_gain_vector (dst, src, gain, n_samples);
+	}
+	t1 = PBD::get_microseconds ();
+	for (int i = 0; i < iterations; ++i) {
+		default_mix_buffers_with_gain_vector (ref, src, gain, n_samples);
+	}
+	t2 = PBD::get_microseconds ();
+	report ("mix_with_gain_vector", t1 - t0, t2 - t1, diff (dst, ref, n_samples) / iterations);
+
+	/* stereo (de)interleave */
+	t0 = PBD::get_microseconds ();
+	for (int i = 0; i < iterations; ++i) {
+		interleave (ilv, src, 2, n_samples);
+		interleave (ilv + 1, src, 2, n_samples);
+	}
+	t1 = PBD::get_microseconds ();
+	for (int i = 0; i < iterations; ++i) {
+		default_interleave (ilv, src, 2, n_samples);
+		default_interleave (ilv + 1, src, 2, n_samples);
+	}
+	t2 = PBD::get_microseconds ();
+	report ("interleave (2ch)", t1 - t0, t2 - t1, 0);
+
+	t0 = PBD::get_microseconds ();
+	for (int i = 0; i < iterations; ++i) {
+		deinterleave (dst, ilv + 1, 2, n_samples);
+	}
+	t1 = PBD::get_microseconds ();
+	for (int i = 0; i < iterations; ++i) {
+		default_deinterleave (ref, ilv + 1, 2, n_samples);
+	}
+	t2 = PBD::get_microseconds ();
+	report ("deinterleave (2ch)", t1 - t0, t2 - t1, diff (dst, ref, n_samples));
+
+	delete [] ref;
+	cache_aligned_free (src);
+	cache_aligned_free (dst);
+	cache_aligned_free (gain);
+	cache_aligned_free (ilv);
+
+	ARDOUR::cleanup ();
+	return 0;
+}
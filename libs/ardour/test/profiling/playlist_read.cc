@@ -0,0 +1,121 @@
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+#include <glibmm/miscutils.h>
+
+#include "pbd/microseconds.h"
+
+#include "ardour/audioengine.h"
+#include "ardour/audioplaylist.h"
+#include "ardour/audioregion.h"
+#include "ardour/playlist_factory.h"
+#include "ardour/region_factory.h"
+#include "ardour/session.h"
+#include "ardour/sndfilesource.h"
+#include "ardour/source_factory.h"
+
+#include "test_ui.h"
+#include "test_util.h"
+
+using namespace std;
+using namespace ARDOUR;
+
+/* Measure AudioPlaylist::read and region lookups on a playlist with many
+ * (short, partially overlapping) regions, with and without the playlist's
+ * region index.
+ *
+ * usage: playlist_read [number of regions (default 10000)]
+ */
+
+static const char* localedir = LOCALEDIR;
+
+static const samplecnt_t chunk         = 4096;
+static const samplecnt_t region_length = 48000;
+
+static void
+run (std::shared_ptr<AudioPlaylist> pl, samplecnt_t n_samples, bool indexed)
+{
+	std::vector<Sample> buf (chunk);
+	std::vector<Sample> mixdown (chunk);
+	std::vector<float>  gain (chunk);
+
+	Playlist::set_region_index_enabled (indexed);
+
+	PBD::microseconds_t t0 = PBD::get_microseconds ();
+
+	int n_reads = 0;
+	for (samplepos_t pos = 0; pos < n_samples; pos += chunk, ++n_reads) {
+		pl->read (&buf[0], &mixdown[0], &gain[0], timepos_t (pos), timecnt_t (chunk), 0);
+	}
+
+	PBD::microseconds_t t1 = PBD::get_microseconds ();
+
+	uint64_t n = 0;
+	int n_lookups = 0;
+	for (samplepos_t pos = 0; pos < n_samples; pos += n_samples / 1000, ++n_lookups) {
+		n += pl->regions_at (timepos_t (pos))->size ();
+		n += pl->top_region_at (timepos_t (pos)) ? 1 : 0;
+	}
+
+	PBD::microseconds_t t2 = PBD::get_microseconds ();
+
+	cout << (indexed ? "indexed" : "linear ")
+	     << "\t" << (t1 - t0) / (double) n_reads
+	     << "\t\t" << (t2 - t1) / (double) n_lookups
+	     << "\t\t(" << n << ")\n";
+}
+
+int
+main (int argc, char* argv[])
+{
+	int const n_regions = argc > 1 ? std::max (1, atoi (argv[1])) : 10000;
+
+	ARDOUR::init (true, localedir);
+	TestUI* test_ui = new TestUI();
+	create_and_start_dummy_backend ();
+
+	std::string dir = Glib::build_filename (new_test_output_dir ("playlist_read"), "bench");
+	Session* session = new Session (*AudioEngine::instance (), dir, "bench");
+
+	{
+		std::string path = Glib::build_filename (dir, "src.wav");
+		std::shared_ptr<Source> src = SourceFactory::createWritable (DataType::AUDIO, *session, path, session->sample_rate ());
+		std::shared_ptr<SndFileSource> sfs = std::dynamic_pointer_cast<SndFileSource> (src);
+
+		std::vector<Sample> data (region_length);
+		for (auto& s : data) {
+			s = rand () / (float) RAND_MAX - .5f;
+		}
+		sfs->write (&data[0], region_length);
+
+		std::shared_ptr<AudioPlaylist> pl = std::dynamic_pointer_cast<AudioPlaylist> (PlaylistFactory::create (DataType::AUDIO, *session, "bench"));
+
+		/* regions overlap by ~25% on average */
+		samplepos_t pos = 0;
+
+		pl->freeze ();
+		for (int i = 0; i < n_regions; ++i) {
+			PBD::PropertyList plist;
+			plist.add (Properties::start, timepos_t (0));
+			plist.add (Properties::length, region_length / 2 + rand () % (region_length / 2));
+			pl->add_region (RegionFactory::create (src, plist), timepos_t (pos));
+			pos += region_length / 2;
+		}
+		pl->thaw ();
+
+		samplecnt_t const n_samples = pos + region_length;
+
+		cout << n_regions << " regions, " << chunk << " samples per read\n";
+		cout << "\t\tread [us]\tlookup [us]\n";
+
+		run (pl, n_samples, false);
+		run (pl, n_samples, true);
+	}
+
+	delete session;
+	stop_and_destroy_backend ();
+	delete test_ui;
+	ARDOUR::cleanup ();
+	return 0;
+}
@@ -0,0 +1,128 @@
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+#include <glibmm/miscutils.h>
+#include <sndfile.h>
+
+#include "pbd/compose.h"
+#include "pbd/microseconds.h"
+
+#include "ardour/audioengine.h"
+#include "ardour/session.h"
+#include "ardour/sndfilesource.h"
+
+#include "test_ui.h"
+#include "test_util.h"
+
+using namespace std;
+using namespace ARDOUR;
+
+/* Measure the rate at which all channels of a multichannel file can be
+ * read, in chunks the size of a butler refill, with and without the
+ * read-cache that is shared by the SndFileSources of a file.
+ *
+ * usage: sndfile_read [seconds of audio (default 10)]
+ */
+
+static const char* localedir = LOCALEDIR;
+
+static const samplecnt_t chunk = 65536;
+
+static std::string
+write_file (std::string const& dir, int n_channels, samplecnt_t n_samples, int rate)
+{
+	std::string path = Glib::build_filename (dir, string_compose ("%1ch.wav", n_channels));
+
+	SF_INFO info;
+	info.channels   = n_channels;
+	info.samplerate = rate;
+	info.format     = SF_FORMAT_WAV | SF_FORMAT_PCM_24;
+
+	SNDFILE* sf = sf_open (path.c_str (), SFM_WRITE, &info);
+	if (!sf) {
+		cerr << "cannot create " << path << "\n";
+		exit (EXIT_FAILURE);
+	}
+
+	std::vector<float> buf (chunk * n_channels);
+	for (samplecnt_t written = 0; written < n_samples; written += chunk) {
+		samplecnt_t n = std::min (chunk, n_samples - written);
+		for (size_t i = 0; i < n * n_channels; ++i) {
+			buf[i] = rand () / (float) RAND_MAX - .5f;
+		}
+		sf_writef_float (sf, &buf[0], n);
+	}
+
+	sf_close (sf);
+	return path;
+}
+
+static double
+run (std::vector<std::shared_ptr<SndFileSource> > const& srcs, samplecnt_t n_samples)
+{
+	std::vector<Sample> buf (chunk);
+
+	PBD::microseconds_t t0 = PBD::get_microseconds ();
+
+	for (samplepos_t pos = 0; pos < n_samples; pos += chunk) {
+		/* like a butler refill, read the same range of each channel */
+		for (auto const& s : srcs) {
+			s->read (&buf[0], pos, chunk);
+		}
+	}
+
+	PBD::microseconds_t t1 = PBD::get_microseconds ();
+
+	/* million samples per second */
+	return srcs.size () * n_samples / (double) std::max<PBD::microseconds_t> (1, t1 - t0);
+}
+
+int
+main (int argc, char* argv[])
+{
+	int const seconds = argc > 1 ? std::max (1, atoi (argv[1])) : 10;
+
+	ARDOUR::init (true, localedir);
+	TestUI* test_ui = new TestUI();
+	create_and_start_dummy_backend ();
+
+	std::string dir = Glib::build_filename (new_test_output_dir ("sndfile_read"), "bench");
+	Session* session = new Session (*AudioEngine::instance (), dir, "bench");
+
+	int const         rate      = session->sample_rate ();
+	samplecnt_t const n_samples = seconds * rate;
+
+	cout << "channels\tuncached\tcached\t[Msamples/sec]\thits\tmisses\n";
+
+	for (int n_channels : { 2, 8, 16, 64 }) {
+
+		std::string path = write_file (dir, n_channels, n_samples, rate);
+
+		std::vector<std::shared_ptr<SndFileSource> > srcs;
+		for (int c = 0; c < n_channels; ++c) {
+			srcs.push_back (std::shared_ptr<SndFileSource> (new SndFileSource (*session, path, c, Source::Flag (0))));
+		}
+
+		/* once to warm up the OS' disk cache */
+		run (srcs, n_samples);
+
+		SndFileSource::set_read_cache_enabled (false);
+		double uncached = run (srcs, n_samples);
+
+		SndFileSource::set_read_cache_enabled (true);
+		SndFileSource::reset_read_cache_stats ();
+		double cached = run (srcs, n_samples);
+
+		uint64_t hits, misses;
+		SndFileSource::read_cache_stats (hits, misses);
+
+		cout << n_channels << "\t\t" << uncached << "\t\t" << cached << "\t\t\t" << hits << "\t" << misses << "\n";
+	}
+
+	delete session;
+	stop_and_destroy_backend ();
+	delete test_ui;
+	ARDOUR::cleanup ();
+	return 0;
+}
@@ -0,0 +1,192 @@
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <glibmm/miscutils.h>
+#include <sndfile.h>
+
+#include "ardour/sndfilesource.h"
+
+#include "sndfile_read_cache_test.h"
+#include "test_util.h"
+
+CPPUNIT_TEST_SUITE_REGISTRATION (SndFileReadCacheTest);
+
+using namespace std;
+using namespace ARDOUR;
+
+static int const         n_channels  = 4;
+/* more than the cache holds (4M interleaved samples) */
+static samplecnt_t const file_length = 1200000;
+
+/* value of a sample, exact as float */
+static float
+sample_value (int chn, samplepos_t pos)
+{
+	return (float) (chn * file_length + pos);
+}
+
+void
+SndFileReadCacheTest::setUp ()
+{
+	TestNeedingSession::setUp ();
+
+	std::string const path = Glib::build_filename (new_test_output_dir (), "4ch.wav");
+
+	SF_INFO info;
+	info.channels   = n_channels;
+	info.samplerate = 48000;
+	info.format     = SF_FORMAT_WAV | SF_FORMAT_FLOAT;
+
+	SNDFILE* sf = sf_open (path.c_str (), SFM_WRITE, &info);
+	CPPUNIT_ASSERT (sf);
+
+	std::vector<float> buf (65536 * n_channels);
+	for (samplepos_t pos = 0; pos < file_length; pos += 65536) {
+		samplecnt_t const n = min<samplecnt_t> (65536, file_length - pos);
+		for (samplecnt_t i = 0; i < n; ++i) {
+			for (int c = 0; c < n_channels; ++c) {
+				buf[i * n_channels + c] = sample_value (c, pos + i);
+			}
+		}
+		CPPUNIT_ASSERT_EQUAL ((sf_count_t) (n * n_channels), sf_write_float (sf, &buf[0], n * n_channels));
+	}
+	sf_close (sf);
+
+	for (int c = 0; c < n_channels; ++c) {
+		_sources[c].reset (new SndFileSource (*_session, path, c, Source::Flag (0)));
+	}
+
+	SndFileSource::set_read_cache_enabled (true);
+	SndFileSource::reset_read_cache_stats ();
+}
+
+void
+SndFileReadCacheTest::tearDown ()
+{
+	for (int c = 0; c < n_channels; ++c) {
+		_sources[c].reset ();
+	}
+	TestNeedingSession::tearDown ();
+}
+
+void
+SndFileReadCacheTest::check_read (int chn, samplepos_t start, samplecnt_t cnt)
+{
+	std::vector<Sample> buf (cnt);
+	CPPUNIT_ASSERT_EQUAL (cnt, _sources[chn]->read (&buf[0], start, cnt));
+	for (samplecnt_t i = 0; i < cnt; ++i) {
+		CPPUNIT_ASSERT_EQUAL (sample_value (chn, start + i), buf[i]);
+	}
+}
+
+/** Reading a range on all channels only reads the file once */
+void
+SndFileReadCacheTest::sharedReadTest ()
+{
+	uint64_t hits;
+	uint64_t misses;
+
+	for (int c = 0; c < n_channels; ++c) {
+		check_read (c, 1000, 8192);
+	}
+
+	SndFileSource::read_cache_stats (hits, misses);
+	CPPUNIT_ASSERT_EQUAL ((uint64_t) 1, misses);
+	CPPUNIT_ASSERT_EQUAL ((uint64_t) n_channels - 1, hits);
+
+	/* part of the cached range */
+	check_read (2, 2000, 100);
+
+	SndFileSource::read_cache_stats (hits, misses);
+	CPPUNIT_ASSERT_EQUAL ((uint64_t) 1, misses);
+	CPPUNIT_ASSERT_EQUAL ((uint64_t) n_channels, hits);
+}
+
+/** A few recently read blocks are kept, older ones are evicted */
+void
+SndFileReadCacheTest::recentBlocksTest ()
+{
+	uint64_t hits;
+	uint64_t misses;
+
+	check_read (0, 0, 4096);
+	check_read (0, 65536, 4096);
+
+	check_read (1, 0, 4096);
+	check_read (1, 65536, 4096);
+
+	SndFileSource::read_cache_stats (hits, misses);
+	CPPUNIT_ASSERT_EQUAL ((uint64_t) 2, misses);
+	CPPUNIT_ASSERT_EQUAL ((uint64_t) 2, hits);
+
+	for (int i = 2; i < 10; ++i) {
+		check_read (0, i * 65536, 4096);
+	}
+
+	SndFileSource::reset_read_cache_stats ();
+
+	check_read (1, 0, 4096);
+	check_read (1, 9 * 65536, 4096);
+
+	SndFileSource::read_cache_stats (hits, misses);
+	CPPUNIT_ASSERT_EQUAL ((uint64_t) 1, misses);
+	CPPUNIT_ASSERT_EQUAL ((uint64_t) 1, hits);
+}
+
+/** Reads larger than the cache bypass it */
+void
+SndFileReadCacheTest::largeReadTest ()
+{
+	uint64_t hits;
+	uint64_t misses;
+
+	check_read (3, 0, file_length);
+	check_read (0, 0, file_length);
+
+	SndFileSource::read_cache_stats (hits, misses);
+	CPPUNIT_ASSERT_EQUAL ((uint64_t) 0, misses);
+	CPPUNIT_ASSERT_EQUAL ((uint64_t) 0, hits);
+
+	/* reads beyond the end are zero-filled */
+	std::vector<Sample> buf (8192);
+	CPPUNIT_ASSERT_EQUAL ((samplecnt_t) 4096, _sources[1]->read (&buf[0], file_length - 4096, 8192));
+	for (samplecnt_t i = 0; i < 8192; ++i) {
+		CPPUNIT_ASSERT_EQUAL (i < 4096 ? sample_value (1, file_length - 4096 + i) : 0.f, buf[i]);
+	}
+}
+
+/** All channels read the file in parallel, in the same and in different places */
+void
+SndFileReadCacheTest::concurrentReadTest ()
+{
+	std::vector<std::thread> threads;
+	std::atomic<int>         errors (0);
+
+	for (int c = 0; c < n_channels; ++c) {
+		threads.push_back (std::thread ([this, c, &errors] () {
+			std::vector<Sample> buf (16384);
+			for (int n = 0; n < 200; ++n) {
+				/* odd channels read backwards */
+				samplepos_t const start = ((c & 1) ? 199 - n : n) * 5000;
+				if (_sources[c]->read (&buf[0], start, buf.size ()) != (samplecnt_t) buf.size ()) {
+					++errors;
+					continue;
+				}
+				for (size_t i = 0; i < buf.size (); ++i) {
+					if (buf[i] != sample_value (c, start + i)) {
+						++errors;
+						break;
+					}
+				}
+			}
+		}));
+	}
+
+	for (auto& t : threads) {
+		t.join ();
+	}
+
+	CPPUNIT_ASSERT_EQUAL (0, errors.load ());
+}
@@ -0,0 +1,33 @@
+#include <memory>
+#include <string>
+
+#include "ardour/types.h"
+#include "test_needing_session.h"
+
+namespace ARDOUR {
+	class SndFileSource;
+}
+
+class SndFileReadCacheTest : public TestNeedingSession
+{
+	CPPUNIT_TEST_SUITE (SndFileReadCacheTest);
+	CPPUNIT_TEST (sharedReadTest);
+	CPPUNIT_TEST (recentBlocksTest);
+	CPPUNIT_TEST (largeReadTest);
+	CPPUNIT_TEST (concurrentReadTest);
+	CPPUNIT_TEST_SUITE_END ();
+
+public:
+	void setUp ();
+	void tearDown ();
+
+	void sharedReadTest ();
+	void recentBlocksTest ();
+	void largeReadTest ();
+	void concurrentReadTest ();
+
+private:
+	void check_read (int chn, ARDOUR::samplepos_t start, ARDOUR::samplecnt_t cnt);
+
+	std::shared_ptr<ARDOUR::SndFileSource> _sources[4];
+};
@@ -0,0 +1,143 @@
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include "ardour/rc_configuration.h"
+#include "ardour/worker.h"
+
+#include "worker_pool_test.h"
+
+CPPUNIT_TEST_SUITE_REGISTRATION (WorkerPoolTest);
+
+using namespace std;
+using namespace ARDOUR;
+
+class TestWorkee : public Workee
+{
+public:
+	TestWorkee (int delay_us = 0)
+		: n_work (0)
+		, n_response (0)
+		, last (-1)
+		, in_order (true)
+		, delay (delay_us)
+	{}
+
+	int work (Worker& worker, uint32_t size, const void* data)
+	{
+		int32_t const seq = *static_cast<int32_t const*> (data);
+		if (seq != last + 1) {
+			in_order = false;
+		}
+		last = seq;
+		if (delay > 0) {
+			std::this_thread::sleep_for (std::chrono::microseconds (delay));
+		}
+		worker.respond (size, data);
+		n_work.fetch_add (1);
+		return 0;
+	}
+
+	int work_response (uint32_t, const void*)
+	{
+		++n_response;
+		return 0;
+	}
+
+	std::atomic<int> n_work;
+	int              n_response;
+	int32_t          last;
+	bool             in_order;
+	int              delay;
+};
+
+void
+WorkerPoolTest::setUp ()
+{
+	WorkerPool::terminate ();
+	Config->set_lv2_worker_pool_threads (2);
+}
+
+void
+WorkerPoolTest::tearDown ()
+{
+	WorkerPool::terminate ();
+	Config->set_lv2_worker_pool_threads (0);
+}
+
+/** Work of many workers is executed by the pool, in order for each worker */
+void
+WorkerPoolTest::dispatchTest ()
+{
+	int const n_workers  = 16;
+	int const n_requests = 100;
+
+	TestWorkee* workee[n_workers];
+	Worker*     worker[n_workers];
+
+	for (int i = 0; i < n_workers; ++i) {
+		workee[i] = new TestWorkee;
+		worker[i] = new Worker (workee[i], 4096);
+	}
+
+	WorkerPool* pool = WorkerPool::instance ();
+	CPPUNIT_ASSERT (pool);
+	CPPUNIT_ASSERT_EQUAL ((uint32_t) n_workers, pool->stats ().n_workers);
+
+	for (int32_t n = 0; n < n_requests; ++n) {
+		for (int i = 0; i < n_workers; ++i) {
+			CPPUNIT_ASSERT (worker[i]->schedule (sizeof (n), &n));
+		}
+	}
+
+	for (int i = 0; i < n_workers; ++i) {
+		for (int t = 0; t < 1000 && workee[i]->n_work.load () < n_requests; ++t) {
+			std::this_thread::sleep_for (std::chrono::milliseconds (10));
+		}
+		CPPUNIT_ASSERT_EQUAL (n_requests, workee[i]->n_work.load ());
+		CPPUNIT_ASSERT (workee[i]->in_order);
+
+		worker[i]->emit_responses ();
+		CPPUNIT_ASSERT_EQUAL (n_requests, workee[i]->n_response);
+	}
+
+	WorkerPool::Stats s = pool->stats ();
+	CPPUNIT_ASSERT_EQUAL ((uint32_t) 2, s.n_threads);
+	CPPUNIT_ASSERT_EQUAL ((uint32_t) 0, s.queue_depth);
+	CPPUNIT_ASSERT (s.n_dispatched > 0);
+
+	for (int i = 0; i < n_workers; ++i) {
+		delete worker[i];
+		delete workee[i];
+	}
+
+	CPPUNIT_ASSERT_EQUAL ((uint32_t) 0, pool->stats ().n_workers);
+}
+
+/** Workers can be destroyed while their work is queued or executing */
+void
+WorkerPoolTest::removeTest ()
+{
+	for (int i = 0; i < 50; ++i) {
+		TestWorkee* busy   = new TestWorkee (500);
+		Worker*     worker = new Worker (busy, 4096);
+
+		CPPUNIT_ASSERT (WorkerPool::instance ());
+
+		for (int32_t n = 0; n < 10; ++n) {
+			CPPUNIT_ASSERT (worker->schedule (sizeof (n), &n));
+		}
+
+		/* returns once the pool no longer references the worker */
+		delete worker;
+
+		int const n_work = busy->n_work.load ();
+		std::this_thread::sleep_for (std::chrono::milliseconds (2));
+		CPPUNIT_ASSERT_EQUAL (n_work, busy->n_work.load ());
+		CPPUNIT_ASSERT (busy->in_order);
+
+		delete busy;
+	}
+
+	CPPUNIT_ASSERT_EQUAL ((uint32_t) 0, WorkerPool::instance ()->stats ().n_workers);
+}
@@ -0,0 +1,17 @@
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+class WorkerPoolTest : public CppUnit::TestFixture
+{
+	CPPUNIT_TEST_SUITE (WorkerPoolTest);
+	CPPUNIT_TEST (dispatchTest);
+	CPPUNIT_TEST (removeTest);
+	CPPUNIT_TEST_SUITE_END ();
+
+public:
+	void setUp ();
+	void tearDown ();
+
+	void dispatchTest ();
+	void removeTest ();
+};
@@ -617,7 +617,16 @@ Track::capture_buffer_load () const
 int
 Track::do_refill ()
 {
-	return _disk_reader->do_refill ();
+	int ret = _disk_reader->do_refill ();
+
+	if (_triggerbox && ret <= 0) {
+		/* streamed clips */
+		if (_triggerbox->do_refill () < 0) {
+			ret = -1;
+		}
+	}
+
+	return ret;
 }
 
 int
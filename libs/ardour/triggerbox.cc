@@ -1424,6 +1424,7 @@ AudioTrigger::AudioData::drop ()
 	}
 
 	clear ();
+	stream.reset ();
 }
 
 AudioTrigger::AudioData&
@@ -1439,10 +1440,14 @@ AudioTrigger::AudioData::operator= (AudioTrigger::AudioData& other)
 	}
 	length = other.length;
 	capacity = other.capacity;
+	resident = other.resident;
+	stream = other.stream;
 
 	other.clear (); /* Not drop, because we've stolen the data buffers */
 	other.length = 0;
 	other.capacity = 0;
+	other.resident = 0;
+	other.stream.reset ();
 
 	return *this;
 }
@@ -1463,8 +1468,8 @@ AudioTrigger::AudioData::alloc (samplecnt_t cnt, uint32_t nchans)
 		push_back (new Sample[cnt]);
 	}
 	length = 0;
+	resident = 0;
 	capacity = cnt;
-
 }
 
 samplecnt_t
@@ -1479,9 +1484,152 @@ AudioTrigger::AudioData::append (Sample const * src, samplecnt_t cnt, uint32_t c
 	samplecnt_t to_copy = std::min (cnt, (capacity - length));
 	memcpy (at(chan) + length, src, cnt * sizeof (Sample));
 	length += cnt;
+	resident = length;
 	return to_copy;
 }
 
+/* size of the buffers used to hand streamed data to the stretcher or output */
+static const samplecnt_t stream_chunk = 8192;
+
+AudioTrigger::ClipStream::ClipStream (std::shared_ptr<AudioRegion> r, samplecnt_t len, samplepos_t start, samplecnt_t bufsize)
+	: region (r)
+	, length (len)
+	, read_buf (stream_chunk * 4)
+	, silence (stream_chunk, 0)
+	, fill_pos (start)
+	, read_pos (start)
+	, seek_pos (start)
+	, seek_gen (1) /* the initial fill is handled like a seek */
+	, ready_gen (0)
+	, eof (false)
+	, underruns (0)
+{
+	for (uint32_t n = 0; n < r->n_channels (); ++n) {
+		rb.push_back (new PBD::PlaybackBuffer<Sample> (bufsize, 0));
+		rt_buf.push_back (new Sample[stream_chunk]);
+	}
+}
+
+AudioTrigger::ClipStream::~ClipStream ()
+{
+	for (auto & b : rb) {
+		delete b;
+	}
+	for (auto & b : rt_buf) {
+		delete [] b;
+	}
+}
+
+int
+AudioTrigger::ClipStream::refill ()
+{
+	/* seek () stores the position before bumping the generation, so
+	 * pos is at least as recent as gen. If another seek arrives while
+	 * we fill, gen is outdated and ready () remains false until the
+	 * next refill handles that seek.
+	 */
+	uint32_t const gen    = seek_gen.load ();
+	bool     const seeked = gen != ready_gen.load ();
+
+	if (seeked) {
+		/* the process thread does not read until ready () */
+		samplepos_t const pos = seek_pos.load ();
+		for (auto & b : rb) {
+			b->reset ();
+		}
+		fill_pos = pos;
+		read_pos.store (pos);
+		eof.store (false);
+	}
+
+	samplecnt_t to_read = std::min<samplecnt_t> (rb.front ()->write_space (), length - fill_pos);
+	to_read = std::min<samplecnt_t> (to_read, read_buf.size ());
+
+	if (to_read > 0) {
+		for (uint32_t n = 0; n < rb.size (); ++n) {
+			samplecnt_t const nread = region->read (&read_buf[0], fill_pos, to_read, n);
+			if (nread < to_read) {
+				memset (&read_buf[std::max<samplecnt_t> (0, nread)], 0, (to_read - std::max<samplecnt_t> (0, nread)) * sizeof (Sample));
+			}
+			rb[n]->write (&read_buf[0], to_read);
+		}
+		fill_pos += to_read;
+	}
+
+	if (fill_pos >= length) {
+		eof.store (true);
+	}
+
+	if (seeked) {
+		/* only the butler writes ready_gen */
+		ready_gen.store (gen);
+	}
+
+	if (seek_gen.load () != gen) {
+		return -1;
+	}
+
+	return (fill_pos < length && rb.front ()->write_space () > 0) ? -1 : 0;
+}
+
+void
+AudioTrigger::ClipStream::seek (samplepos_t pos)
+{
+	if (ready () && read_pos.load () == pos) {
+		return;
+	}
+	seek_pos.store (pos);
+	seek_gen.fetch_add (1);
+}
+
+samplecnt_t
+AudioTrigger::ClipStream::read (Sample** dst, samplepos_t pos, samplecnt_t cnt)
+{
+	if (!ready ()) {
+		return 0;
+	}
+
+	samplepos_t const rpos = read_pos.load ();
+
+	if (pos != rpos) {
+		if (pos > rpos && rb.front ()->can_seek (pos - rpos)) {
+			for (auto & b : rb) {
+				b->increment_read_ptr (pos - rpos);
+			}
+		} else {
+			seek (pos);
+			return 0;
+		}
+	}
+
+	/* the butler refills channels one after another */
+	for (auto const & b : rb) {
+		cnt = std::min<samplecnt_t> (cnt, b->read_space ());
+	}
+
+	for (uint32_t n = 0; n < rb.size (); ++n) {
+		cnt = rb[n]->read (dst[n], cnt);
+	}
+
+	read_pos.store (pos + cnt);
+	return cnt;
+}
+
+bool
+AudioTrigger::ClipStream::need_butler () const
+{
+	if (!ready ()) {
+		return true;
+	}
+	return !eof.load () && rb.front ()->write_space () >= rb.front ()->bufsize () / 4;
+}
+
+size_t
+AudioTrigger::ClipStream::memory_footprint () const
+{
+	return rb.size () * (rb.front ()->bufsize () + stream_chunk) * sizeof (Sample);
+}
+
 AudioTrigger::AudioTrigger (uint32_t n, TriggerBox& b)
 	: Trigger (n, b)
 	, _stretcher (nullptr)
@@ -1501,6 +1649,61 @@ AudioTrigger::~AudioTrigger ()
 	delete _stretcher;
 }
 
+size_t
+AudioTrigger::memory_footprint () const
+{
+	size_t rv = data.size () * data.capacity * sizeof (Sample);
+	if (data.stream) {
+		rv += data.stream->memory_footprint ();
+	}
+	return rv;
+}
+
+samplecnt_t
+AudioTrigger::fetch (Sample const** dst, samplepos_t pos, samplecnt_t cnt, bool in_process_context)
+{
+	if (pos < data.resident) {
+		/* data in memory; stop at its end, the rest follows with the next call */
+		for (uint32_t n = 0; n < data.size (); ++n) {
+			dst[n] = data[n] + pos;
+		}
+		return std::min (cnt, data.resident - pos);
+	}
+
+	ClipStream* s = data.stream.get ();
+	assert (s);
+
+	cnt = std::min (cnt, stream_chunk);
+
+	if (!in_process_context) {
+		/* fast-forward, the output is not used, leave the ringbuffers alone */
+		for (uint32_t n = 0; n < data.size (); ++n) {
+			dst[n] = &s->silence[0];
+		}
+		return cnt;
+	}
+
+	samplecnt_t const nread = s->read (&s->rt_buf[0], pos, cnt);
+
+	if (nread < cnt) {
+		++s->underruns;
+		DEBUG_TRACE (DEBUG::Triggers, string_compose ("%1/%2 clip stream underrun at %3 (%4 of %5)\n", _box.order(), index(), pos, nread, cnt));
+	}
+
+	for (uint32_t n = 0; n < data.size (); ++n) {
+		if (nread < cnt) {
+			memset (s->rt_buf[n] + nread, 0, sizeof (Sample) * (cnt - nread));
+		}
+		dst[n] = s->rt_buf[n];
+	}
+
+	if (s->need_butler ()) {
+		_box.request_refill ();
+	}
+
+	return cnt;
+}
+
 Sample const *
 AudioTrigger::audio_data (size_t n) const
 {
@@ -1834,7 +2037,16 @@ AudioTrigger::set_region_in_worker_thread_internal (std::shared_ptr<Region> r, b
 void
 AudioTrigger::estimate_tempo ()
 {
-	ARDOUR::estimate_audio_tempo_region (_region, data[0], data.length, _box.session().sample_rate(), _estimated_tempo, _meter, _beatcnt);
+	/* for streamed clips, this only looks at the data that is held in memory */
+	ARDOUR::estimate_audio_tempo_region (_region, data[0], data.resident, _box.session().sample_rate(), _estimated_tempo, _meter, _beatcnt);
+
+	if (data.resident < data.length && _estimated_tempo != 0.) {
+		/* scale the beat count to the whole clip */
+		const double minutes = data.length / (60. * _box.session().sample_rate());
+		_beatcnt = std::max (1., round (_estimated_tempo * minutes));
+		_estimated_tempo = _beatcnt / minutes;
+	}
+
 	/* initialize our follow_length to match the beatcnt ... user can later change this value to have the clip end sooner or later than its data length */
 	set_follow_length (Temporal::BBT_Offset ( 0, floor (_beatcnt), 0));
 }
@@ -1914,8 +2126,10 @@ AudioTrigger::captured (SlotArmInfo& ai)
 	}
 
 	data.clear ();
+	data.stream.reset ();
 
 	data.length = ai.audio_buf.length;
+	data.resident = ai.audio_buf.length;
 	data.capacity = ai.audio_buf.capacity;
 
 	DEBUG_TRACE (DEBUG::Triggers, string_compose ("%1/%2 captured a total of %3\n", _box.order(), _index, data.length));
@@ -1963,14 +2177,36 @@ AudioTrigger::load_data (std::shared_ptr<AudioRegion> ar, AudioData& audio_data)
 
 	try {
 		samplecnt_t len = ar->length_samples();
+		samplecnt_t resident = len;
+		samplecnt_t preload = 0;
+
+		/* Optionally, only keep the start of long clips in memory,
+		 * the butler streams the rest from disk during playback.
+		 */
+		if (Config->get_stream_audio_clips ()) {
+			preload = Config->get_audio_clip_preload () * _box.session().sample_rate();
+			if (preload > 0 && len > 2 * preload) {
+				resident = preload;
+			}
+		}
 
-		audio_data.alloc (len, nchans);
+		audio_data.alloc (resident, nchans);
 
 		for (uint32_t n = 0; n < nchans; ++n) {
-			ar->read (audio_data[n], 0, len, n);
+			ar->read (audio_data[n], 0, resident, n);
 		}
 
 		audio_data.length = len;
+		audio_data.resident = resident;
+
+		if (resident < len) {
+			audio_data.stream.reset (new ClipStream (ar, len, resident, preload));
+			/* pre-fill the ringbuffers */
+			while (audio_data.stream->refill () < 0) ;
+			_box.add_clip_stream (audio_data.stream);
+
+			DEBUG_TRACE (DEBUG::Triggers, string_compose ("%1/%2 streams %3, %4 of %5 samples in memory\n", _box.order(), index(), ar->name(), resident, len));
+		}
 
 	} catch (...) {
 		audio_data.drop ();
@@ -1992,6 +2228,14 @@ AudioTrigger::retrigger ()
 	retrieved = 0;
 	_legato_offset = 0; /* used one time only */
 
+	if (data.stream) {
+		/* the ringbuffers need to continue where the data in memory ends */
+		data.stream->seek (std::max<samplepos_t> (read_index, data.resident));
+		if (data.stream->need_butler ()) {
+			_box.request_refill ();
+		}
+	}
+
 	DEBUG_TRACE (DEBUG::Triggers, string_compose ("%1 retriggered to %2\n", _index, read_index));
 }
 
@@ -2010,6 +2254,7 @@ AudioTrigger::audio_run (BufferSet& bufs, samplepos_t start_sample, samplepos_t
 	BufferSet* scratch;
 	std::unique_ptr<BufferSet> scratchp;
 	std::vector<Sample*> bufp(nchans);
+	Sample const** direct = (Sample const**)alloca(std::max<size_t> (1, data.size()) * sizeof (Sample*));
 	const bool do_stretch = stretching() && _segment_tempo > 1;
 
 	quantize_offset = 0;
@@ -2136,7 +2381,6 @@ AudioTrigger::audio_run (BufferSet& bufs, samplepos_t start_sample, samplepos_t
 				while ((pframes_t) avail < nframes && (read_index < last_readable_sample)) {
 
 					to_stretcher = (pframes_t) std::min (samplecnt_t (rb_blocksize), (last_readable_sample - read_index));
-					bool at_end = (to_stretcher < rb_blocksize);
 
 					/* keep feeding the stretcher in chunks of "to_stretcher",
 					 * until there's nframes of data available, or we reach
@@ -2145,8 +2389,11 @@ AudioTrigger::audio_run (BufferSet& bufs, samplepos_t start_sample, samplepos_t
 
 					float** in = (float**)alloca(nchans * sizeof (float*));
 
+					to_stretcher = fetch (direct, read_index, to_stretcher, in_process_context);
+					bool at_end = (to_stretcher < rb_blocksize) && (read_index + to_stretcher >= last_readable_sample);
+
 					for (uint32_t chn = 0; chn < nchans; ++chn) {
-						in[chn] = data[chn % data.size ()] + read_index;
+						in[chn] = const_cast<float*> (direct[chn % data.size ()]);
 					}
 
 #ifndef NDEBUG
@@ -2230,7 +2477,9 @@ AudioTrigger::audio_run (BufferSet& bufs, samplepos_t start_sample, samplepos_t
 			/* no stretch */
 			assert (last_readable_sample >= read_index);
 			from_stretcher = std::min<samplecnt_t> (nframes, last_readable_sample - read_index);
-
+			if (from_stretcher > 0) {
+				from_stretcher = fetch (direct, read_index, from_stretcher, in_process_context);
+			}
 		}
 
 		DEBUG_TRACE (DEBUG::Triggers, string_compose ("%1 ready with %2 ri %3 ls %4, will write %5\n", name(), avail, read_index, last_readable_sample, from_stretcher));
@@ -2243,7 +2492,7 @@ AudioTrigger::audio_run (BufferSet& bufs, samplepos_t start_sample, samplepos_t
 
 				uint32_t channel = chn %  data.size();
 				AudioBuffer& buf (bufs.get_audio (chn));
-				Sample* src = do_stretch ? bufp[channel] : (data[channel] + read_index);
+				Sample const* src = do_stretch ? bufp[channel] : direct[channel];
 
 				gain_t gain;
 
@@ -3710,6 +3959,7 @@ TriggerBox::TriggerBox (Session& s, DataType dt)
 	, requests (1024)
 	, _arm_info (nullptr)
 	, _gui_feed_fifo (std::min<size_t> (64000, std::max<size_t> (s.sample_rate() / 10, 2 * AudioEngine::instance()->raw_buffer_size (DataType::MIDI))))
+	, _need_refill (false)
 {
 	set_display_to_user (false);
 
@@ -5812,10 +6062,57 @@ TriggerBox::tempo_map_changed ()
 void
 TriggerBox::dump (std::ostream & ostr) const
 {
-	ostr << "TriggerBox " << order() << std::endl;
+	ostr << "TriggerBox " << order() << " memory " << memory_footprint() << " bytes" << std::endl;
+	for (auto const & t : all_triggers) {
+		ostr << "\tTrigger " << t->index() << " state " << enum_2_string (t->state()) << " memory " << t->memory_footprint() << std::endl;
+	}
+}
+
+void
+TriggerBox::add_clip_stream (std::shared_ptr<AudioTrigger::ClipStream> cs)
+{
+	PBD::Mutex::Lock lm (_streams_lock);
+	_streams.push_back (cs);
+}
+
+/** Called from the butler thread (via Track::do_refill) to top up the
+ * ringbuffers of all streamed clips.
+ *
+ * @return 0 when all streams are filled, -1 if more work remains
+ */
+int
+TriggerBox::do_refill ()
+{
+	_need_refill.store (false);
+
+	PBD::Mutex::Lock lm (_streams_lock);
+
+	int ret = 0;
+
+	for (auto i = _streams.begin(); i != _streams.end(); ) {
+		if ((*i).use_count() == 1) {
+			/* the clip was replaced or removed */
+			i = _streams.erase (i);
+			continue;
+		}
+		if ((*i)->refill () < 0) {
+			ret = -1;
+		}
+		++i;
+	}
+
+	return ret;
+}
+
+size_t
+TriggerBox::memory_footprint () const
+{
+	PBD::RWLock::ReaderLock lm (trigger_lock);
+	size_t rv = 0;
 	for (auto const & t : all_triggers) {
-		ostr << "\tTrigger " << t->index() << " state " << enum_2_string (t->state()) << std::endl;
+		rv += t->memory_footprint ();
 	}
+	return rv;
 }
 
 /* Thread */
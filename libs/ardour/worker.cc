@@ -19,12 +19,13 @@
 
 #include <stdlib.h>
 
-#include <glibmm/timer.h>
-
 #include "pbd/error.h"
 #include "pbd/compose.h"
+#include "pbd/microseconds.h"
 #include "pbd/pthread_utils.h"
 
+#include "ardour/debug.h"
+#include "ardour/rc_configuration.h"
 #include "ardour/worker.h"
 
 namespace ARDOUR {
@@ -38,22 +39,37 @@ Worker::Worker(Workee* workee, uint32_t ring_size, bool threaded)
 	, _thread(NULL)
 	, _exit(false)
 	, _synchronous(!threaded)
+	, _work_buf(NULL)
+	, _work_buf_size(0)
+	, _pool(NULL)
+	, _queued(false)
+	, _queued_at(0)
 {
 	if (threaded) {
-		_thread = PBD::Thread::create (std::bind (&Worker::run, this), "LV2Worker");
+		WorkerPool* pool = WorkerPool::instance();
+		if (pool && pool->add(this)) {
+			_pool = pool;
+		} else {
+			_thread = PBD::Thread::create (std::bind (&Worker::run, this), "LV2Worker");
+		}
 	}
 }
 
 Worker::~Worker()
 {
 	_exit = true;
-	_sem.signal();
-	if (_thread) {
-		_thread->join();
+	if (_pool) {
+		_pool->remove(this);
+	} else {
+		_sem.signal();
+		if (_thread) {
+			_thread->join();
+		}
 	}
 	delete _responses;
 	delete _requests;
 	free (_response);
+	free (_work_buf);
 }
 
 bool
@@ -73,7 +89,11 @@ Worker::schedule(uint32_t size, const void* data)
 	if (_requests->write((const uint8_t*)data, size) != size) {
 		return false;
 	}
-	_sem.signal();
+	if (_pool) {
+		_pool->schedule(this);
+	} else {
+		_sem.signal();
+	}
 	return true;
 }
 
@@ -136,52 +156,237 @@ Worker::emit_responses()
 void
 Worker::run()
 {
-	void*  buf      = NULL;
-	size_t buf_size = 0;
 	while (true) {
 		_sem.wait();
 		if (_exit) {
-			free(buf);
 			return;
 		}
+		/* a request is complete before the semaphore is signalled, but
+		 * an earlier wakeup may already have handled it.
+		 */
+		process_requests();
+	}
+}
 
-		uint32_t size = _requests->read_space();
-		if (size < sizeof(size)) {
-			PBD::error << "Worker: no work-data on ring buffer" << endmsg;
-			continue;
-		}
-		while (!verify_message_completeness(_requests)) {
-			Glib::usleep(2000);
-			if (_exit) {
-				if (buf) free(buf);
-				return;
-			}
-		}
+void
+Worker::process_requests()
+{
+	uint32_t size;
+	while (_requests->read_space() >= sizeof(size) && verify_message_completeness(_requests)) {
 		if (_requests->read((uint8_t*)&size, sizeof(size)) < sizeof(size)) {
 			PBD::error << "Worker: Error reading size from request ring"
 			           << endmsg;
-			continue;
+			return;
 		}
 
-		if (size > buf_size) {
-			buf = realloc(buf, size);
-			if (buf) {
-				buf_size = size;
+		if (size > _work_buf_size) {
+			_work_buf = realloc(_work_buf, size);
+			if (_work_buf) {
+				_work_buf_size = size;
 			} else {
 				PBD::fatal << "Worker: Error allocating memory" << endmsg;
 				abort(); /*NOTREACHED*/
 			}
 		}
-		assert (buf);
 
-		if (_requests->read((uint8_t*)buf, size) < size) {
+		if (_requests->read((uint8_t*)_work_buf, size) < size) {
 			PBD::error << "Worker: Error reading body from request ring"
 			           << endmsg;
-			continue;  // TODO: This is probably fatal
+			return;
+		}
+
+		_workee->work(*this, size, _work_buf);
+	}
+}
+
+/* ****************************************************************************/
+
+/* a worker is queued at most once, the queue needs to hold all of them */
+static const size_t max_pool_workers = 8192;
+
+WorkerPool* WorkerPool::_instance = NULL;
+PBD::Mutex  WorkerPool::_instance_lock;
+
+WorkerPool*
+WorkerPool::instance ()
+{
+	PBD::Mutex::Lock lm (_instance_lock);
+	if (!_instance && Config && Config->get_lv2_worker_pool_threads () > 0) {
+		_instance = new WorkerPool (Config->get_lv2_worker_pool_threads ());
+	}
+	return _instance;
+}
+
+void
+WorkerPool::terminate ()
+{
+	PBD::Mutex::Lock lm (_instance_lock);
+	if (!_instance) {
+		return;
+	}
+
+#ifndef NDEBUG
+	Stats s = _instance->stats ();
+	DEBUG_TRACE (DEBUG::LV2, string_compose ("WorkerPool: %1 threads, dispatched %2, max queue depth %3, latency avg %4 max %5 [us]\n",
+	                                         s.n_threads, s.n_dispatched, s.max_queue_depth, s.avg_latency, s.max_latency));
+#endif
+
+	delete _instance;
+	_instance = NULL;
+}
+
+WorkerPool::WorkerPool (uint32_t n_threads)
+	: _queue (max_pool_workers)
+	, _sem ("worker_pool", 0)
+	, _exit (false)
+	, _n_workers (0)
+	, _queue_depth (0)
+	, _max_queue_depth (0)
+	, _n_dispatched (0)
+	, _total_latency (0)
+	, _max_latency (0)
+{
+	for (uint32_t i = 0; i < n_threads; ++i) {
+		PBD::Thread* t = PBD::Thread::create (std::bind (&WorkerPool::run, this), string_compose ("LV2Worker %1", i));
+		if (t) {
+			_threads.push_back (t);
+		}
+	}
+}
+
+WorkerPool::~WorkerPool ()
+{
+	assert (_n_workers.load () == 0);
+
+	_exit = true;
+	for (size_t i = 0; i < _threads.size (); ++i) {
+		_sem.signal ();
+	}
+	for (auto const& t : _threads) {
+		t->join ();
+		delete t;
+	}
+}
+
+bool
+WorkerPool::add (Worker*)
+{
+	if (_threads.empty ()) {
+		return false;
+	}
+	if (_n_workers.fetch_add (1) >= _queue.capacity ()) {
+		_n_workers.fetch_sub (1);
+		return false;
+	}
+	return true;
+}
+
+void
+WorkerPool::remove (Worker* w)
+{
+	/* wait until the worker is neither queued nor being processed.
+	 * A queued worker is skipped by the pool thread, since w->_exit is set.
+	 */
+	{
+		PBD::Mutex::Lock lm (w->_pool_lock);
+		while (w->_queued.load ()) {
+			w->_released.wait (w->_pool_lock);
 		}
+	}
+	_n_workers.fetch_sub (1);
+}
 
-		_workee->work(*this, size, buf);
+void
+WorkerPool::schedule (Worker* w)
+{
+	/* called from the process thread, when work was scheduled */
+
+	if (w->_queued.exchange (true)) {
+		/* already queued, or being processed (in which case the request
+		 * is handled before the worker is released, see run())
+		 */
+		return;
 	}
+
+	w->_queued_at = PBD::get_microseconds ();
+
+	uint32_t depth = _queue_depth.fetch_add (1) + 1;
+	uint32_t max   = _max_queue_depth.load ();
+	while (depth > max && !_max_queue_depth.compare_exchange_weak (max, depth)) ;
+
+	/* this cannot fail, a worker is queued at most once */
+	_queue.push_back (w);
+	_sem.signal ();
+}
+
+void
+WorkerPool::run ()
+{
+	while (true) {
+		_sem.wait ();
+
+		if (_exit) {
+			return;
+		}
+
+		Worker* w;
+		if (!_queue.pop_front (w)) {
+			continue;
+		}
+
+		_queue_depth.fetch_sub (1);
+
+		int64_t latency = PBD::get_microseconds () - w->_queued_at.load ();
+		int64_t max     = _max_latency.load ();
+		while (latency > max && !_max_latency.compare_exchange_weak (max, latency)) ;
+		_total_latency.fetch_add (latency);
+		_n_dispatched.fetch_add (1);
+
+		PBD::Mutex::Lock lm (w->_pool_lock);
+
+		if (w->_exit) {
+			/* the worker is being destroyed, see remove() */
+			w->_queued = false;
+			w->_released.signal ();
+			continue;
+		}
+
+		w->process_requests ();
+
+		w->_queued = false;
+
+		/* work that was scheduled after the last request was read,
+		 * but before the worker was released, needs to be re-queued.
+		 */
+		if (w->verify_message_completeness (w->_requests)) {
+			schedule (w);
+		} else {
+			w->_released.signal ();
+		}
+	}
+}
+
+WorkerPool::Stats
+WorkerPool::stats () const
+{
+	Stats s;
+	s.n_threads       = _threads.size ();
+	s.n_workers       = _n_workers.load ();
+	s.queue_depth     = _queue_depth.load ();
+	s.max_queue_depth = _max_queue_depth.load ();
+	s.n_dispatched    = _n_dispatched.load ();
+	s.avg_latency     = s.n_dispatched > 0 ? _total_latency.load () / (int64_t) s.n_dispatched : 0;
+	s.max_latency     = _max_latency.load ();
+	return s;
+}
+
+void
+WorkerPool::reset_stats ()
+{
+	_max_queue_depth = _queue_depth.load ();
+	_n_dispatched    = 0;
+	_total_latency   = 0;
+	_max_latency     = 0;
 }
 
 } // namespace ARDOUR
@@ -0,0 +1,146 @@
+/*
+ * Copyright (C) 2026 Ardour Developers
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#include "ardour/mix.h"
+
+#include <immintrin.h>
+#include <xmmintrin.h>
+
+#ifndef __AVX__
+#error "__AVX__ must be enabled for this module to work"
+#endif
+
+/**
+ * @brief x86-64 AVX optimized routine to apply a per-sample gain
+ *
+ * dst[i] = dst[i] * gain[i]
+ *
+ * @param[in,out] dst Pointer to the destination buffer, which gets updated
+ * @param[in] gain Pointer to the gain coefficients
+ * @param nframes Number of frames (or samples) to process
+ */
+void
+x86_sse_avx_apply_gain_vector(float *dst, const float *gain, uint32_t nframes)
+{
+	uint32_t i = 0;
+
+	// Process the samples 16 at a time
+	for (; i + 16 <= nframes; i += 16) {
+		__m256 d0 = _mm256_loadu_ps(dst + i + 0);
+		__m256 d1 = _mm256_loadu_ps(dst + i + 8);
+		__m256 g0 = _mm256_loadu_ps(gain + i + 0);
+		__m256 g1 = _mm256_loadu_ps(gain + i + 8);
+		_mm256_storeu_ps(dst + i + 0, _mm256_mul_ps(d0, g0));
+		_mm256_storeu_ps(dst + i + 8, _mm256_mul_ps(d1, g1));
+	}
+
+	// Process the remaining samples 8 at a time
+	if (i + 8 <= nframes) {
+		_mm256_storeu_ps(dst + i, _mm256_mul_ps(_mm256_loadu_ps(dst + i), _mm256_loadu_ps(gain + i)));
+		i += 8;
+	}
+
+	// Process the remaining samples
+	for (; i < nframes; ++i) {
+		dst[i] *= gain[i];
+	}
+
+	// zero upper 128 bit of 256 bit ymm register to avoid penalties using non-AVX instructions
+	_mm256_zeroupper();
+}
+
+/**
+ * @brief x86-64 AVX optimized routine to mix a buffer with per-sample gain
+ *
+ * dst[i] = dst[i] + src[i] * gain[i]
+ *
+ * @param[in,out] dst Pointer to destination buffer, which gets updated
+ * @param[in] src Pointer to source buffer (not updated)
+ * @param[in] gain Pointer to the gain coefficients
+ * @param nframes Number of samples to process
+ */
+void
+x86_sse_avx_mix_buffers_with_gain_vector(float *dst, const float *src, const float *gain, uint32_t nframes)
+{
+	uint32_t i = 0;
+
+	// Process the samples 16 at a time
+	for (; i + 16 <= nframes; i += 16) {
+		__m256 s0 = _mm256_mul_ps(_mm256_loadu_ps(src + i + 0), _mm256_loadu_ps(gain + i + 0));
+		__m256 s1 = _mm256_mul_ps(_mm256_loadu_ps(src + i + 8), _mm256_loadu_ps(gain + i + 8));
+		_mm256_storeu_ps(dst + i + 0, _mm256_add_ps(_mm256_loadu_ps(dst + i + 0), s0));
+		_mm256_storeu_ps(dst + i + 8, _mm256_add_ps(_mm256_loadu_ps(dst + i + 8), s1));
+	}
+
+	// Process the remaining samples 8 at a time
+	if (i + 8 <= nframes) {
+		__m256 s0 = _mm256_mul_ps(_mm256_loadu_ps(src + i), _mm256_loadu_ps(gain + i));
+		_mm256_storeu_ps(dst + i, _mm256_add_ps(_mm256_loadu_ps(dst + i), s0));
+		i += 8;
+	}
+
+	// Process the remaining samples
+	for (; i < nframes; ++i) {
+		dst[i] += src[i] * gain[i];
+	}
+
+	_mm256_zeroupper();
+}
+
+/**
+ * @brief x86-64 AVX optimized routine to render a linear ramp
+ *
+ * dst[i] = start + i * step
+ *
+ * @param[out] dst Pointer to destination buffer
+ * @param nframes Number of samples to process
+ * @param start Value of the first sample
+ * @param step Increment per sample
+ */
+void
+x86_sse_avx_fill_ramp(float *dst, uint32_t nframes, float start, float step)
+{
+	__m256 vstart = _mm256_set1_ps(start);
+	__m256 vstep  = _mm256_set1_ps(step);
+	__m256 vidx0  = _mm256_set_ps(7.f, 6.f, 5.f, 4.f, 3.f, 2.f, 1.f, 0.f);
+	__m256 vidx1  = _mm256_add_ps(vidx0, _mm256_set1_ps(8.f));
+	__m256 vinc   = _mm256_set1_ps(16.f);
+
+	uint32_t i = 0;
+
+	// Process the samples 16 at a time
+	for (; i + 16 <= nframes; i += 16) {
+		_mm256_storeu_ps(dst + i + 0, _mm256_add_ps(vstart, _mm256_mul_ps(vidx0, vstep)));
+		_mm256_storeu_ps(dst + i + 8, _mm256_add_ps(vstart, _mm256_mul_ps(vidx1, vstep)));
+		vidx0 = _mm256_add_ps(vidx0, vinc);
+		vidx1 = _mm256_add_ps(vidx1, vinc);
+	}
+
+	// Process the remaining samples 8 at a time
+	if (i + 8 <= nframes) {
+		_mm256_storeu_ps(dst + i, _mm256_add_ps(vstart, _mm256_mul_ps(vidx0, vstep)));
+		i += 8;
+	}
+
+	// Process the remaining samples
+	for (; i < nframes; ++i) {
+		dst[i] = start + i * step;
+	}
+
+	_mm256_zeroupper();
+}
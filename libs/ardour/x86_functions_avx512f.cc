@@ -1146,4 +1146,130 @@ x86_avx512f_copy_vector(float *dst, const float *src, uint32_t nframes)
 	_mm256_zeroupper(); // zeros the upper portion of YMM register
 }
 
+
+/**
+ * @brief x86-64 AVX-512F optimized routine to apply a per-sample gain
+ *
+ * dst[i] = dst[i] * gain[i]
+ *
+ * @param[in,out] dst Pointer to the destination buffer, which gets updated
+ * @param[in] gain Pointer to the gain coefficients
+ * @param nframes Number of frames (or samples) to process
+ */
+void
+x86_avx512f_apply_gain_vector(float *dst, const float *gain, uint32_t nframes)
+{
+	uint32_t i = 0;
+
+	// Process the samples 32 at a time
+	for (; i + 32 <= nframes; i += 32) {
+		__m512 d0 = _mm512_loadu_ps(dst + i + 0);
+		__m512 d1 = _mm512_loadu_ps(dst + i + 16);
+		__m512 g0 = _mm512_loadu_ps(gain + i + 0);
+		__m512 g1 = _mm512_loadu_ps(gain + i + 16);
+		_mm512_storeu_ps(dst + i + 0, _mm512_mul_ps(d0, g0));
+		_mm512_storeu_ps(dst + i + 16, _mm512_mul_ps(d1, g1));
+	}
+
+	// Process the remaining samples 16 at a time, the rest using a mask
+	while (i < nframes) {
+		const uint32_t   n    = nframes - i < 16 ? nframes - i : 16;
+		const __mmask16 mask = (__mmask16)((1u << n) - 1);
+		__m512 d0 = _mm512_maskz_loadu_ps(mask, dst + i);
+		__m512 g0 = _mm512_maskz_loadu_ps(mask, gain + i);
+		_mm512_mask_storeu_ps(dst + i, mask, _mm512_mul_ps(d0, g0));
+		i += n;
+	}
+
+	_mm256_zeroupper(); // zeros the upper portion of YMM register
+}
+
+/**
+ * @brief x86-64 AVX-512F optimized routine to mix a buffer with per-sample gain
+ *
+ * dst[i] = dst[i] + src[i] * gain[i]
+ *
+ * @param[in,out] dst Pointer to destination buffer, which gets updated
+ * @param[in] src Pointer to source buffer (not updated)
+ * @param[in] gain Pointer to the gain coefficients
+ * @param nframes Number of samples to process
+ */
+void
+x86_avx512f_mix_buffers_with_gain_vector(float *dst, const float *src, const float *gain, uint32_t nframes)
+{
+	uint32_t i = 0;
+
+	// Process the samples 32 at a time
+	for (; i + 32 <= nframes; i += 32) {
+		__m512 x0 = _mm512_loadu_ps(src + i + 0);
+		__m512 x1 = _mm512_loadu_ps(src + i + 16);
+		__m512 g0 = _mm512_loadu_ps(gain + i + 0);
+		__m512 g1 = _mm512_loadu_ps(gain + i + 16);
+		__m512 y0 = _mm512_loadu_ps(dst + i + 0);
+		__m512 y1 = _mm512_loadu_ps(dst + i + 16);
+		_mm512_storeu_ps(dst + i + 0, _mm512_fmadd_ps(x0, g0, y0));
+		_mm512_storeu_ps(dst + i + 16, _mm512_fmadd_ps(x1, g1, y1));
+	}
+
+	// Process the remaining samples 16 at a time, the rest using a mask
+	while (i < nframes) {
+		const uint32_t   n    = nframes - i < 16 ? nframes - i : 16;
+		const __mmask16 mask = (__mmask16)((1u << n) - 1);
+		__m512 x0 = _mm512_maskz_loadu_ps(mask, src + i);
+		__m512 g0 = _mm512_maskz_loadu_ps(mask, gain + i);
+		__m512 y0 = _mm512_maskz_loadu_ps(mask, dst + i);
+		_mm512_mask_storeu_ps(dst + i, mask, _mm512_fmadd_ps(x0, g0, y0));
+		i += n;
+	}
+
+	_mm256_zeroupper(); // zeros the upper portion of YMM register
+}
+
+/**
+ * @brief x86-64 AVX-512F optimized routine to render a linear ramp
+ *
+ * dst[i] = start + i * step
+ *
+ * @param[out] dst Pointer to destination buffer
+ * @param nframes Number of frames (or samples) to process
+ * @param start Value of the first sample
+ * @param step Increment per sample
+ */
+void
+x86_avx512f_fill_ramp(float *dst, uint32_t nframes, float start, float step)
+{
+	const __m512 zstart = _mm512_set1_ps(start);
+	const __m512 zstep  = _mm512_set1_ps(step);
+	const __m512 zinc   = _mm512_set1_ps(32.f);
+
+	__m512 zidx0 = _mm512_set_ps(15.f, 14.f, 13.f, 12.f, 11.f, 10.f, 9.f, 8.f,
+	                             7.f, 6.f, 5.f, 4.f, 3.f, 2.f, 1.f, 0.f);
+	__m512 zidx1 = _mm512_add_ps(zidx0, _mm512_set1_ps(16.f));
+
+	uint32_t i = 0;
+
+	// Process the samples 32 at a time
+	for (; i + 32 <= nframes; i += 32) {
+		_mm512_storeu_ps(dst + i + 0, _mm512_add_ps(zstart, _mm512_mul_ps(zidx0, zstep)));
+		_mm512_storeu_ps(dst + i + 16, _mm512_add_ps(zstart, _mm512_mul_ps(zidx1, zstep)));
+		zidx0 = _mm512_add_ps(zidx0, zinc);
+		zidx1 = _mm512_add_ps(zidx1, zinc);
+	}
+
+	// Process the remaining samples 16 at a time
+	if (i + 16 <= nframes) {
+		_mm512_storeu_ps(dst + i, _mm512_add_ps(zstart, _mm512_mul_ps(zidx0, zstep)));
+		zidx0 = zidx1;
+		i += 16;
+	}
+
+	// Process the remaining samples using a mask
+	if (i < nframes) {
+		const __mmask16 mask = (__mmask16)((1u << (nframes - i)) - 1);
+		_mm512_mask_storeu_ps(dst + i, mask, _mm512_add_ps(zstart, _mm512_mul_ps(zidx0, zstep)));
+	}
+
+	_mm256_zeroupper(); // zeros the upper portion of YMM register
+}
+
 #endif // FPU_AVX512F_SUPPORT
@@ -138,4 +138,54 @@ x86_fma_mix_buffers_with_gain(
 	} while (0);
 }
 
+/**
+ * @brief x86-64 AVX/FMA optimized routine to mix a buffer with per-sample gain
+ *
+ * @param[in,out] dst Pointer to destination buffer, which gets updated
+ * @param[in] src Pointer to source buffer (not updated)
+ * @param[in] gain Pointer to the gain coefficients
+ * @param nframes Number of samples to process
+ */
+void
+x86_fma_mix_buffers_with_gain_vector(
+    float       *dst,
+    const float *src,
+    const float *gain,
+    uint32_t     nframes)
+{
+	uint32_t i = 0;
+
+	// Process the samples 16 at a time
+	for (; i + 16 <= nframes; i += 16) {
+		__m256 x0 = _mm256_loadu_ps(src + i + 0);
+		__m256 x1 = _mm256_loadu_ps(src + i + 8);
+		__m256 g0 = _mm256_loadu_ps(gain + i + 0);
+		__m256 g1 = _mm256_loadu_ps(gain + i + 8);
+		__m256 y0 = _mm256_loadu_ps(dst + i + 0);
+		__m256 y1 = _mm256_loadu_ps(dst + i + 8);
+
+		_mm256_storeu_ps(dst + i + 0, _mm256_fmadd_ps(x0, g0, y0));
+		_mm256_storeu_ps(dst + i + 8, _mm256_fmadd_ps(x1, g1, y1));
+	}
+
+	// Process the remaining samples 8 at a time
+	if (i + 8 <= nframes) {
+		__m256 x0 = _mm256_loadu_ps(src + i);
+		__m256 g0 = _mm256_loadu_ps(gain + i);
+		__m256 y0 = _mm256_loadu_ps(dst + i);
+		_mm256_storeu_ps(dst + i, _mm256_fmadd_ps(x0, g0, y0));
+		i += 8;
+	}
+
+	// Process the remaining samples
+	for (; i < nframes; ++i) {
+		__m128 x0 = _mm_load_ss(src + i);
+		__m128 g0 = _mm_load_ss(gain + i);
+		__m128 y0 = _mm_load_ss(dst + i);
+		_mm_store_ss(dst + i, _mm_fmadd_ss(x0, g0, y0));
+	}
+
+	_mm256_zeroupper();
+}
+
 #endif // FPU_AVX_FMA_SUPPORT
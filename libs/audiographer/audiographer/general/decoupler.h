@@ -0,0 +1,203 @@
+#ifndef AUDIOGRAPHER_DECOUPLER_H
+#define AUDIOGRAPHER_DECOUPLER_H
+
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "pbd/mutex.h"
+#include "pbd/pthread_utils.h"
+
+#include "audiographer/visibility.h"
+#include "audiographer/exception.h"
+#include "audiographer/sink.h"
+#include "audiographer/types.h"
+#include "audiographer/utils/listed_source.h"
+#include "audiographer/general/threader.h"
+
+namespace AudioGrapher
+{
+
+/** Bounded queue that moves everything downstream to a worker thread.
+  *
+  * Contexts are copied into one of a fixed number of blocks, and are
+  * passed on to the outputs from a dedicated thread. The caller only
+  * blocks when all blocks are in use, so slow sinks (e.g. encoders)
+  * overlap with producing the next data.
+  *
+  * A context with the EndOfInput flag is not returned from until
+  * all queued data has been processed by the outputs.
+  * Exceptions thrown by outputs are re-thrown (as ThreaderException)
+  * from the next call to process().
+  */
+template <typename T = DefaultSampleType>
+class /*LIBAUDIOGRAPHER_API*/ Decoupler
+  : public ListedSource<T>
+  , public Sink<T>
+{
+  public:
+	/** Constructor
+	  * \n Not RT safe
+	  * \param max_samples maximum number of samples (all channels) in a context
+	  * \param n_blocks number of contexts that can be queued
+	  */
+	Decoupler (samplecnt_t max_samples, unsigned int n_blocks = 8)
+		: max_samples (max_samples)
+		, blocks (std::max (2u, n_blocks))
+		, head (0)
+		, tail (0)
+		, queued (0)
+		, quit (false)
+		, thread (0)
+		, thread_failed (false)
+	{
+		for (typename std::vector<Block>::iterator i = blocks.begin (); i != blocks.end (); ++i) {
+			i->data.resize (max_samples);
+		}
+	}
+
+	~Decoupler () { stop (); }
+
+	/** Pass on all queued data and terminate the worker thread.
+	  * Outputs must not be removed while the worker is active.
+	  */
+	void stop ()
+	{
+		if (!thread) {
+			return;
+		}
+		PBD::Mutex::Lock lm (mutex);
+		quit = true;
+		data_cond.signal ();
+		lm.release ();
+
+		thread->join ();
+		delete thread;
+		thread = 0;
+
+		quit = false;
+	}
+
+	void process (ProcessContext<T> const & c)
+	{
+		check_exception ();
+
+		if (!thread && !thread_failed) {
+			thread = PBD::Thread::create (std::bind (&Decoupler::run, this), "AG Decoupler");
+			thread_failed = (thread == 0);
+		}
+
+		if (!thread) {
+			/* no worker, process in the caller's thread */
+			ListedSource<T>::output (c);
+			return;
+		}
+
+		if (c.samples () > max_samples) {
+			throw Exception (*this, "Too many samples given to process()");
+		}
+
+		PBD::Mutex::Lock lm (mutex);
+		while (queued == blocks.size ()) {
+			space_cond.wait (mutex);
+		}
+
+		Block& b (blocks[head]);
+		std::memcpy (&b.data[0], c.data (), sizeof (T) * c.samples ());
+		b.samples  = c.samples ();
+		b.channels = c.channels ();
+		b.end      = c.has_flag (ProcessContext<T>::EndOfInput);
+
+		head = (head + 1) % blocks.size ();
+		++queued;
+		data_cond.signal ();
+
+		if (b.end) {
+			while (queued > 0) {
+				space_cond.wait (mutex);
+			}
+			lm.release ();
+			check_exception ();
+		}
+	}
+
+	using Sink<T>::process;
+
+  private:
+	struct Block {
+		std::vector<T> data;
+		samplecnt_t    samples;
+		ChannelCount   channels;
+		bool           end;
+	};
+
+	void check_exception ()
+	{
+		PBD::Mutex::Lock lm (mutex);
+		if (exception) {
+			std::shared_ptr<ThreaderException> e (exception);
+			exception.reset ();
+			throw *e;
+		}
+	}
+
+	void run ()
+	{
+		PBD::Mutex::Lock lm (mutex);
+		while (true) {
+			while (queued == 0 && !quit) {
+				data_cond.wait (mutex);
+			}
+			if (queued == 0) {
+				/* quit, after the queue has been drained */
+				break;
+			}
+
+			Block& b (blocks[tail]);
+			bool failed = (bool) exception;
+			lm.release ();
+
+			/* once an output failed, only drain the queue */
+			if (!failed) {
+				try {
+					ProcessContext<T> c (&b.data[0], b.samples, b.channels);
+					if (b.end) {
+						c.set_flag (ProcessContext<T>::EndOfInput);
+					}
+					ListedSource<T>::output (c);
+				} catch (std::exception const & e) {
+					lm.acquire ();
+					exception.reset (new ThreaderException (*this, e));
+					lm.release ();
+				}
+			}
+
+			lm.acquire ();
+			tail = (tail + 1) % blocks.size ();
+			--queued;
+			space_cond.signal ();
+		}
+	}
+
+	samplecnt_t        max_samples;
+	std::vector<Block> blocks;
+	size_t             head;
+	size_t             tail;
+	size_t             queued;
+	bool               quit;
+
+	PBD::Thread* thread;
+	bool         thread_failed;
+
+	PBD::Mutex mutex;
+	PBD::Cond  data_cond;
+	PBD::Cond  space_cond;
+
+	std::shared_ptr<ThreaderException> exception;
+};
+
+} // namespace
+
+#endif // AUDIOGRAPHER_DECOUPLER_H
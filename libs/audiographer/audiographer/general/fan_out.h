@@ -0,0 +1,319 @@
+#ifndef AUDIOGRAPHER_FAN_OUT_H
+#define AUDIOGRAPHER_FAN_OUT_H
+
+#include <algorithm>
+#include <cassert>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "pbd/mutex.h"
+#include "pbd/pthread_utils.h"
+#include "pbd/semutils.h"
+
+#include "audiographer/visibility.h"
+#include "audiographer/source.h"
+#include "audiographer/sink.h"
+#include "audiographer/exception.h"
+#include "audiographer/general/threader.h"
+
+namespace AudioGrapher
+{
+
+/** A set of persistent worker threads for FanOut.
+  *
+  * Workers are started on demand and spin briefly before sleeping,
+  * waiting for the next job. Several FanOut instances can share one
+  * set of workers, as long as they do not process concurrently
+  * (e.g. export post-processing, which runs one node after the other).
+  */
+class /*LIBAUDIOGRAPHER_API*/ FanOutWorkers
+{
+  public:
+
+	/** A job that is split among the calling thread and the workers */
+	class Job {
+	  public:
+		virtual ~Job () {}
+		/// process share \a id of \a n
+		virtual void run_share (unsigned int id, unsigned int n) = 0;
+	};
+
+	/** Constructor
+	  * \n NOT RT safe
+	  * \param max_threads maximum number of threads (including the caller) used to run a job
+	  * \param spin number of iterations to spin before blocking
+	  */
+	FanOutWorkers (unsigned int max_threads, unsigned int spin = 20000)
+		: max_threads (std::max (1u, max_threads))
+		, spin (spin)
+		, job (0)
+		, done ("fan_out_done", 0)
+	{
+		participants.store (1);
+		generation.store (0);
+		remaining.store (0);
+		waiting.store (false);
+		quit.store (false);
+	}
+
+	~FanOutWorkers ()
+	{
+		if (workers.empty ()) {
+			return;
+		}
+		quit.store (true);
+		generation.fetch_add (1);
+		wake_workers (workers.size ());
+		for (std::vector<Worker*>::iterator i = workers.begin (); i != workers.end (); ++i) {
+			(*i)->thread->join ();
+			delete (*i)->thread;
+			delete *i;
+		}
+	}
+
+	/// Number of worker threads, not including the caller
+	size_t n_workers () const { return workers.size (); }
+
+	/** Run \a j on the calling thread and up to \a n_threads - 1 workers,
+	  * return when all shares are done.
+	  */
+	void run (Job& j, unsigned int n_threads)
+	{
+		PBD::Mutex::Lock lm (run_lock);
+
+		n_threads = std::min (max_threads, std::max (1u, n_threads));
+
+		if (workers.size () + 1 < n_threads) {
+			start_workers (n_threads - 1);
+		}
+
+		unsigned int const n = std::min<unsigned int> (workers.size () + 1, n_threads);
+
+		if (n == 1) {
+			j.run_share (0, 1);
+			return;
+		}
+
+		/* publish the job; workers pick it up with the generation.
+		 * Workers with an id >= n skip it.
+		 */
+		job = &j;
+		participants.store (n);
+		remaining.store (n - 1);
+		generation.fetch_add (1);
+		wake_workers (n - 1);
+
+		j.run_share (0, n);
+		wait ();
+
+		job = 0;
+	}
+
+  private:
+
+	struct Worker {
+		Worker () : thread (0), wake ("fan_out_wake", 0) { sleeping.store (false); }
+
+		PBD::Thread*      thread;
+		PBD::Semaphore    wake;
+		std::atomic<bool> sleeping;
+	};
+
+	void start_workers (unsigned int n)
+	{
+		while (workers.size () < n) {
+			Worker* w = new Worker;
+			unsigned int id = workers.size () + 1;
+			w->thread = PBD::Thread::create (std::bind (&FanOutWorkers::worker, this, w, id, generation.load ()), "AG FanOut");
+			if (!w->thread) {
+				delete w;
+				break;
+			}
+			workers.push_back (w);
+		}
+	}
+
+	/** Only signal the first \a n workers, if they went to sleep.
+	  * Each worker has its own semaphore, so that a worker cannot
+	  * consume another one's wakeup.
+	  */
+	void wake_workers (size_t n)
+	{
+		for (size_t i = 0; i < n && i < workers.size (); ++i) {
+			if (workers[i]->sleeping.exchange (false)) {
+				workers[i]->wake.signal ();
+			}
+		}
+	}
+
+	void wait ()
+	{
+		for (unsigned int i = 0; i < spin && remaining.load () != 0; ++i) { }
+
+		waiting.store (true);
+		if (remaining.load () != 0) {
+			done.wait ();
+		} else if (!waiting.exchange (false)) {
+			/* the last worker saw us waiting and already signaled */
+			done.wait ();
+		}
+	}
+
+	void worker (Worker* w, unsigned int id, uint32_t seen)
+	{
+		while (true) {
+			uint32_t g = generation.load ();
+			for (unsigned int i = 0; i < spin && g == seen; ++i) {
+				g = generation.load ();
+			}
+
+			if (g == seen) {
+				w->sleeping.store (true);
+				if (generation.load () == seen) {
+					w->wake.wait ();
+				} else if (!w->sleeping.exchange (false)) {
+					/* woken up concurrently, consume the signal */
+					w->wake.wait ();
+				}
+				continue;
+			}
+
+			seen = g;
+
+			if (quit.load ()) {
+				return;
+			}
+
+			unsigned int const n = participants.load ();
+			if (id >= n) {
+				/* not needed for this job */
+				continue;
+			}
+
+			job->run_share (id, n);
+
+			if (remaining.fetch_sub (1) == 1 && waiting.exchange (false)) {
+				done.signal ();
+			}
+		}
+	}
+
+	unsigned int const max_threads;
+	unsigned int const spin;
+
+	std::vector<Worker*> workers;
+
+	Job* job;
+
+	std::atomic<unsigned int> participants;
+	std::atomic<uint32_t>     generation;
+	std::atomic<int>          remaining;
+	std::atomic<bool>         waiting;
+	std::atomic<bool>         quit;
+
+	PBD::Semaphore done;
+	PBD::Mutex     run_lock;
+};
+
+/** Class for distributing processing across several persistent threads.
+  *
+  * Unlike Threader, no tasks are allocated or queued per process() call:
+  * outputs are statically assigned to the threads of a FanOutWorkers set.
+  * The calling thread processes its own share of the outputs, and spins
+  * before blocking until the workers are done. No more threads than
+  * outputs are used.
+  *
+  * Outputs must only be added or removed between calls to process().
+  */
+template <typename T = DefaultSampleType>
+class /*LIBAUDIOGRAPHER_API*/ FanOut : public Source<T>, public Sink<T>, private FanOutWorkers::Job
+{
+  private:
+	typedef std::vector<typename Source<T>::SinkPtr> OutputVec;
+
+  public:
+
+	/** Constructor, using a private set of workers
+	  * \n NOT RT safe
+	  * \param max_threads maximum number of threads (including the caller) used to process outputs
+	  * \param spin number of iterations to spin before blocking
+	  */
+	FanOut (unsigned int max_threads, unsigned int spin = 20000)
+		: workers (new FanOutWorkers (max_threads, spin))
+		, context (0)
+	{}
+
+	/** Constructor, using a shared set of workers
+	  * \n NOT RT safe
+	  * \param workers worker threads, shared with other FanOut instances
+	  */
+	FanOut (std::shared_ptr<FanOutWorkers> workers)
+		: workers (workers)
+		, context (0)
+	{
+		assert (workers);
+	}
+
+	/// Adds output \n RT safe
+	void add_output (typename Source<T>::SinkPtr output) { outputs.push_back (output); }
+
+	/// Clears outputs \n RT safe
+	void clear_outputs () { outputs.clear (); }
+
+	/// Removes a specific output \n RT safe
+	void remove_output (typename Source<T>::SinkPtr output) {
+		typename OutputVec::iterator new_end = std::remove(outputs.begin(), outputs.end(), output);
+		outputs.erase (new_end, outputs.end());
+	}
+
+	/// Number of worker threads, not including the caller
+	size_t n_workers () const { return workers->n_workers (); }
+
+	/// Processes context concurrently, each output being processed by exactly one thread
+	void process (ProcessContext<T> const & c)
+	{
+		exception.reset ();
+
+		context = &c;
+		workers->run (*this, outputs.size ());
+		context = 0;
+
+		if (exception) {
+			throw *exception;
+		}
+	}
+
+	using Sink<T>::process;
+
+  private:
+
+	/// Each participant processes every nth output, starting at its id
+	void run_share (unsigned int id, unsigned int n)
+	{
+		for (unsigned int i = id; i < outputs.size (); i += n) {
+			try {
+				outputs[i]->process (*context);
+			} catch (std::exception const & e) {
+				// Only first exception will be passed on
+				exception_mutex.lock();
+				if(!exception) { exception.reset (new ThreaderException (*this, e)); }
+				exception_mutex.unlock();
+			}
+		}
+	}
+
+	OutputVec outputs;
+
+	std::shared_ptr<FanOutWorkers> workers;
+
+	ProcessContext<T> const* context;
+
+	PBD::Mutex exception_mutex;
+	std::shared_ptr<ThreaderException> exception;
+};
+
+} // namespace
+
+#endif //AUDIOGRAPHER_FAN_OUT_H
@@ -0,0 +1,98 @@
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+#include "pbd/cpus.h"
+#include "pbd/microseconds.h"
+#include "pbd/thread_pool.h"
+
+#include "audiographer/general/fan_out.h"
+#include "audiographer/general/threader.h"
+
+using namespace AudioGrapher;
+
+/* Compare the per-chunk overhead of Threader and FanOut, for different
+ * chunk sizes and numbers of outputs. The sinks do a little work on
+ * the data, so that the distribution overhead dominates.
+ *
+ * usage: fan-out-benchmark [seconds of audio (default 60)]
+ */
+
+class SumSink : public Sink<float>
+{
+  public:
+	SumSink () : sum (0) {}
+
+	void process (ProcessContext<float> const & c)
+	{
+		float const* d = c.data ();
+		for (samplecnt_t i = 0; i < c.samples (); ++i) {
+			sum += d[i];
+		}
+	}
+	using Sink<float>::process;
+
+	double sum;
+};
+
+static double
+run (Sink<float>& node, std::vector<float>& data, samplecnt_t chunk, samplecnt_t total)
+{
+	PBD::microseconds_t t0 = PBD::get_microseconds ();
+
+	for (samplecnt_t pos = 0; pos < total; pos += chunk) {
+		ProcessContext<float> c (&data[0], chunk, 1);
+		node.process (c);
+	}
+
+	PBD::microseconds_t t1 = PBD::get_microseconds ();
+
+	/* microseconds per chunk */
+	return (t1 - t0) / (double) (total / chunk);
+}
+
+int
+main (int argc, char* argv[])
+{
+	int const         seconds = argc > 1 ? std::max (1, atoi (argv[1])) : 60;
+	samplecnt_t const total   = seconds * 48000;
+	uint32_t const    n_cpus  = PBD::hardware_concurrency ();
+
+	std::vector<float> data (8192);
+	for (size_t i = 0; i < data.size (); ++i) {
+		data[i] = rand () / (float) RAND_MAX - .5f;
+	}
+
+	PBD::ThreadPool thread_pool (n_cpus);
+
+	std::cout << n_cpus << " CPUs, " << seconds << " sec of audio [usec/chunk]\n";
+	std::cout << "outputs\tchunk\tThreader\tFanOut\t\tspeedup\n";
+
+	for (int n_outputs : { 2, 4, 8, 16, 32 }) {
+		for (samplecnt_t chunk : { 64, 256, 1024, 8192 }) {
+
+			Threader<float> threader (thread_pool);
+			FanOut<float>   fan_out (n_cpus);
+
+			for (int i = 0; i < n_outputs; ++i) {
+				threader.add_output (std::shared_ptr<SumSink> (new SumSink));
+				fan_out.add_output (std::shared_ptr<SumSink> (new SumSink));
+			}
+
+			/* warm up, start FanOut's workers */
+			run (threader, data, chunk, chunk * 100);
+			run (fan_out, data, chunk, chunk * 100);
+
+			double t_threader = run (threader, data, chunk, total);
+			double t_fan_out  = run (fan_out, data, chunk, total);
+
+			std::cout << n_outputs << "\t" << chunk
+			          << "\t" << t_threader
+			          << "\t\t" << t_fan_out
+			          << "\t\t" << t_threader / std::max (1e-3, t_fan_out) << "\n";
+		}
+	}
+
+	thread_pool.shutdown ();
+	return 0;
+}
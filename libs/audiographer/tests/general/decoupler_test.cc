@@ -0,0 +1,106 @@
+#include "tests/utils.h"
+
+#include "audiographer/general/decoupler.h"
+
+using namespace AudioGrapher;
+
+class DecouplerTest : public CppUnit::TestFixture
+{
+  CPPUNIT_TEST_SUITE (DecouplerTest);
+  CPPUNIT_TEST (testProcess);
+  CPPUNIT_TEST (testEndOfInput);
+  CPPUNIT_TEST (testExceptions);
+  CPPUNIT_TEST (testStop);
+  CPPUNIT_TEST_SUITE_END ();
+
+  public:
+	void setUp()
+	{
+		samples = 128;
+		chunks = 64;
+		random_data = TestUtils::init_random_data (samples * chunks, 1.0);
+
+		decoupler.reset (new Decoupler<float> (samples, 4));
+		sink.reset (new AppendingVectorSink<float>());
+		grabber.reset (new ProcessContextGrabber<float>());
+		throwing_sink.reset (new ThrowingSink<float>());
+	}
+
+	void tearDown()
+	{
+		decoupler.reset ();
+		delete [] random_data;
+	}
+
+	void testProcess()
+	{
+		decoupler->add_output (sink);
+
+		for (samplecnt_t i = 0; i < chunks; ++i) {
+			ProcessContext<float> c (&random_data[i * samples], samples, 1);
+			if (i == chunks - 1) { c.set_flag (ProcessContext<float>::EndOfInput); }
+			decoupler->process (c);
+		}
+
+		/* EndOfInput returns only after all data has been written */
+		CPPUNIT_ASSERT_EQUAL ((size_t) (samples * chunks), sink->get_data().size());
+		CPPUNIT_ASSERT (TestUtils::array_equals (random_data, sink->get_array(), samples * chunks));
+	}
+
+	void testEndOfInput()
+	{
+		decoupler->add_output (grabber);
+
+		ProcessContext<float> c (random_data, samples, 2);
+		decoupler->process (c);
+		c.set_flag (ProcessContext<float>::EndOfInput);
+		decoupler->process (c);
+
+		CPPUNIT_ASSERT_EQUAL ((size_t) 2, grabber->contexts.size());
+		ProcessContextGrabber<float>::ContextList::iterator it = grabber->contexts.begin();
+		CPPUNIT_ASSERT (!it->has_flag (ProcessContext<float>::EndOfInput));
+		CPPUNIT_ASSERT_EQUAL ((ChannelCount) 2, it->channels());
+		++it;
+		CPPUNIT_ASSERT (it->has_flag (ProcessContext<float>::EndOfInput));
+		CPPUNIT_ASSERT_EQUAL (samples, it->samples());
+	}
+
+	void testExceptions()
+	{
+		decoupler->add_output (throwing_sink);
+
+		ProcessContext<float> c (random_data, samples, 1);
+		c.set_flag (ProcessContext<float>::EndOfInput);
+		CPPUNIT_ASSERT_THROW (decoupler->process (c), Exception);
+
+		ProcessContext<float> too_long (random_data, samples * 2, 1);
+		CPPUNIT_ASSERT_THROW (decoupler->process (too_long), Exception);
+	}
+
+	void testStop()
+	{
+		decoupler->add_output (sink);
+
+		ProcessContext<float> c (random_data, samples, 1);
+		c.set_flag (ProcessContext<float>::EndOfInput);
+		decoupler->process (c);
+		decoupler->stop ();
+
+		/* the worker is restarted on demand */
+		sink->reset ();
+		decoupler->process (c);
+		CPPUNIT_ASSERT (TestUtils::array_equals (random_data, sink->get_array(), samples));
+	}
+
+  private:
+	std::shared_ptr<Decoupler<float> > decoupler;
+	std::shared_ptr<AppendingVectorSink<float> > sink;
+	std::shared_ptr<ProcessContextGrabber<float> > grabber;
+	std::shared_ptr<ThrowingSink<float> > throwing_sink;
+
+	float * random_data;
+	samplecnt_t samples;
+	samplecnt_t chunks;
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION (DecouplerTest);
@@ -0,0 +1,203 @@
+#include "tests/utils.h"
+
+#include "audiographer/general/fan_out.h"
+
+using namespace AudioGrapher;
+
+class FanOutTest : public CppUnit::TestFixture
+{
+  CPPUNIT_TEST_SUITE (FanOutTest);
+  CPPUNIT_TEST (testProcess);
+  CPPUNIT_TEST (testRemoveOutput);
+  CPPUNIT_TEST (testClearOutputs);
+  CPPUNIT_TEST (testExceptions);
+  CPPUNIT_TEST (testManyCycles);
+  CPPUNIT_TEST (testSharedWorkers);
+  CPPUNIT_TEST_SUITE_END ();
+
+  public:
+	void setUp()
+	{
+		samples = 128;
+		random_data = TestUtils::init_random_data (samples, 1.0);
+
+		zero_data = new float[samples];
+		memset (zero_data, 0, samples * sizeof(float));
+
+		fan_out.reset (new FanOut<float> (3));
+
+		sink_a.reset (new VectorSink<float>());
+		sink_b.reset (new VectorSink<float>());
+		sink_c.reset (new VectorSink<float>());
+		sink_d.reset (new VectorSink<float>());
+		sink_e.reset (new VectorSink<float>());
+		sink_f.reset (new VectorSink<float>());
+
+		throwing_sink.reset (new ThrowingSink<float>());
+	}
+
+	void tearDown()
+	{
+		delete [] random_data;
+		delete [] zero_data;
+		fan_out.reset ();
+	}
+
+	void testProcess()
+	{
+		fan_out->add_output (sink_a);
+		fan_out->add_output (sink_b);
+		fan_out->add_output (sink_c);
+		fan_out->add_output (sink_d);
+		fan_out->add_output (sink_e);
+		fan_out->add_output (sink_f);
+
+		ProcessContext<float> c (random_data, samples, 1);
+		fan_out->process (c);
+
+		CPPUNIT_ASSERT (TestUtils::array_equals(random_data, sink_a->get_array(), samples));
+		CPPUNIT_ASSERT (TestUtils::array_equals(random_data, sink_b->get_array(), samples));
+		CPPUNIT_ASSERT (TestUtils::array_equals(random_data, sink_c->get_array(), samples));
+		CPPUNIT_ASSERT (TestUtils::array_equals(random_data, sink_d->get_array(), samples));
+		CPPUNIT_ASSERT (TestUtils::array_equals(random_data, sink_e->get_array(), samples));
+		CPPUNIT_ASSERT (TestUtils::array_equals(random_data, sink_f->get_array(), samples));
+	}
+
+	void testRemoveOutput()
+	{
+		fan_out->add_output (sink_a);
+		fan_out->add_output (sink_b);
+		fan_out->add_output (sink_c);
+		fan_out->add_output (sink_d);
+		fan_out->add_output (sink_e);
+		fan_out->add_output (sink_f);
+
+		ProcessContext<float> c (random_data, samples, 1);
+		fan_out->process (c);
+
+		// Remove a, b and f
+		fan_out->remove_output (sink_a);
+		fan_out->remove_output (sink_b);
+		fan_out->remove_output (sink_f);
+
+		ProcessContext<float> zc (zero_data, samples, 1);
+		fan_out->process (zc);
+
+		CPPUNIT_ASSERT (TestUtils::array_equals(random_data, sink_a->get_array(), samples));
+		CPPUNIT_ASSERT (TestUtils::array_equals(random_data, sink_b->get_array(), samples));
+		CPPUNIT_ASSERT (TestUtils::array_equals(zero_data, sink_c->get_array(), samples));
+		CPPUNIT_ASSERT (TestUtils::array_equals(zero_data, sink_d->get_array(), samples));
+		CPPUNIT_ASSERT (TestUtils::array_equals(zero_data, sink_e->get_array(), samples));
+		CPPUNIT_ASSERT (TestUtils::array_equals(random_data, sink_f->get_array(), samples));
+	}
+
+	void testClearOutputs()
+	{
+		fan_out->add_output (sink_a);
+		fan_out->add_output (sink_b);
+		fan_out->add_output (sink_c);
+		fan_out->add_output (sink_d);
+		fan_out->add_output (sink_e);
+		fan_out->add_output (sink_f);
+
+		ProcessContext<float> c (random_data, samples, 1);
+		fan_out->process (c);
+
+		fan_out->clear_outputs();
+		ProcessContext<float> zc (zero_data, samples, 1);
+		fan_out->process (zc);
+
+		CPPUNIT_ASSERT (TestUtils::array_equals(random_data, sink_a->get_array(), samples));
+		CPPUNIT_ASSERT (TestUtils::array_equals(random_data, sink_b->get_array(), samples));
+		CPPUNIT_ASSERT (TestUtils::array_equals(random_data, sink_c->get_array(), samples));
+		CPPUNIT_ASSERT (TestUtils::array_equals(random_data, sink_d->get_array(), samples));
+		CPPUNIT_ASSERT (TestUtils::array_equals(random_data, sink_e->get_array(), samples));
+		CPPUNIT_ASSERT (TestUtils::array_equals(random_data, sink_f->get_array(), samples));
+	}
+
+	void testExceptions()
+	{
+		fan_out->add_output (sink_a);
+		fan_out->add_output (sink_b);
+		fan_out->add_output (sink_c);
+		fan_out->add_output (throwing_sink);
+		fan_out->add_output (sink_e);
+		fan_out->add_output (throwing_sink);
+
+		ProcessContext<float> c (random_data, samples, 1);
+		CPPUNIT_ASSERT_THROW (fan_out->process (c), Exception);
+
+		CPPUNIT_ASSERT (TestUtils::array_equals(random_data, sink_a->get_array(), samples));
+		CPPUNIT_ASSERT (TestUtils::array_equals(random_data, sink_b->get_array(), samples));
+		CPPUNIT_ASSERT (TestUtils::array_equals(random_data, sink_c->get_array(), samples));
+		CPPUNIT_ASSERT (TestUtils::array_equals(random_data, sink_e->get_array(), samples));
+	}
+
+	void testManyCycles()
+	{
+		std::shared_ptr<AppendingVectorSink<float> > sinks[5];
+		for (int i = 0; i < 5; ++i) {
+			sinks[i].reset (new AppendingVectorSink<float>());
+			fan_out->add_output (sinks[i]);
+		}
+
+		ProcessContext<float> c (random_data, samples, 1);
+		for (int n = 0; n < 1000; ++n) {
+			fan_out->process (c);
+		}
+
+		for (int i = 0; i < 5; ++i) {
+			CPPUNIT_ASSERT_EQUAL ((size_t) (1000 * samples), sinks[i]->get_data().size());
+			CPPUNIT_ASSERT (TestUtils::array_equals(random_data, &sinks[i]->get_data()[999 * samples], samples));
+		}
+	}
+
+	void testSharedWorkers()
+	{
+		std::shared_ptr<FanOutWorkers> workers (new FanOutWorkers (3));
+		FanOut<float> fan_out_a (workers);
+		FanOut<float> fan_out_b (workers);
+
+		fan_out_a.add_output (sink_a);
+		fan_out_a.add_output (sink_b);
+		fan_out_a.add_output (sink_c);
+		fan_out_a.add_output (sink_d);
+		fan_out_b.add_output (sink_e);
+		fan_out_b.add_output (sink_f);
+
+		ProcessContext<float> c (random_data, samples, 1);
+		for (int n = 0; n < 100; ++n) {
+			fan_out_a.process (c);
+			fan_out_b.process (c);
+		}
+
+		// Both nodes use the same two workers, not one set each
+		CPPUNIT_ASSERT_EQUAL ((size_t) 2, workers->n_workers ());
+		CPPUNIT_ASSERT_EQUAL ((size_t) 2, fan_out_b.n_workers ());
+
+		CPPUNIT_ASSERT (TestUtils::array_equals(random_data, sink_a->get_array(), samples));
+		CPPUNIT_ASSERT (TestUtils::array_equals(random_data, sink_b->get_array(), samples));
+		CPPUNIT_ASSERT (TestUtils::array_equals(random_data, sink_c->get_array(), samples));
+		CPPUNIT_ASSERT (TestUtils::array_equals(random_data, sink_d->get_array(), samples));
+		CPPUNIT_ASSERT (TestUtils::array_equals(random_data, sink_e->get_array(), samples));
+		CPPUNIT_ASSERT (TestUtils::array_equals(random_data, sink_f->get_array(), samples));
+	}
+
+  private:
+	std::shared_ptr<FanOut<float> > fan_out;
+	std::shared_ptr<VectorSink<float> > sink_a;
+	std::shared_ptr<VectorSink<float> > sink_b;
+	std::shared_ptr<VectorSink<float> > sink_c;
+	std::shared_ptr<VectorSink<float> > sink_d;
+	std::shared_ptr<VectorSink<float> > sink_e;
+	std::shared_ptr<VectorSink<float> > sink_f;
+
+	std::shared_ptr<ThrowingSink<float> > throwing_sink;
+
+	float * random_data;
+	float * zero_data;
+	samplecnt_t samples;
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION (FanOutTest);
+
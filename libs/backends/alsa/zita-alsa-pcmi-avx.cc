@@ -0,0 +1,57 @@
+/*
+ * Copyright (C) 2026 Ardour Developers
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <immintrin.h>
+
+#include "zita-alsa-pcmi-conv.h"
+
+#ifndef __AVX__
+#error "This source file must be compiled with -mavx"
+#endif
+
+/* Only used if the CPU supports AVX, see Alsa_pcmi_conv::init() */
+
+void
+Alsa_pcmi_conv::scale_clip_avx (const float* src, int32_t* dst, int n, float scl)
+{
+	__m256 const pos = _mm256_set1_ps (1.f);
+	__m256 const neg = _mm256_set1_ps (-1.f);
+	__m256 const s   = _mm256_set1_ps (scl);
+
+	int i = 0;
+	for (; i + 8 <= n; i += 8) {
+		__m256 x = _mm256_loadu_ps (src + i);
+		x        = _mm256_min_ps (_mm256_max_ps (x, neg), pos);
+		_mm256_storeu_si256 ((__m256i*)(dst + i), _mm256_cvttps_epi32 (_mm256_mul_ps (x, s)));
+	}
+	_mm256_zeroupper ();
+	scale_clip_scalar (src + i, dst + i, n - i, scl);
+}
+
+void
+Alsa_pcmi_conv::scale_avx (const int32_t* src, float* dst, int n, float scl)
+{
+	__m256 const s = _mm256_set1_ps (scl);
+
+	int i = 0;
+	for (; i + 8 <= n; i += 8) {
+		__m256i x = _mm256_loadu_si256 ((__m256i const*)(src + i));
+		_mm256_storeu_ps (dst + i, _mm256_div_ps (_mm256_cvtepi32_ps (x), s));
+	}
+	_mm256_zeroupper ();
+	scale_scalar (src + i, dst + i, n - i, scl);
+}
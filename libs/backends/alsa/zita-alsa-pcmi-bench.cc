@@ -0,0 +1,129 @@
+/*
+ * Copyright (C) 2026 Ardour Developers
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* Measure the cost of sample format conversion per channel and period,
+ * for an interleaved multi-channel device, the way the ALSA backend
+ * calls Alsa_pcmi::play_chan() and ::capt_chan() for each channel.
+ *
+ * usage: zita-alsa-pcmi-bench [channels (default 64)] [iterations (default 2000)]
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "pbd/microseconds.h"
+
+#include "zita-alsa-pcmi-conv.h"
+
+using namespace Alsa_pcmi_conv;
+
+struct Format {
+	snd_pcm_format_t format;
+	const char*      name;
+	int              size;
+};
+
+static const Format formats[] = {
+	{ SND_PCM_FORMAT_S16_LE,   "S16_LE",   2 },
+	{ SND_PCM_FORMAT_S24_3LE,  "S24_3LE",  3 },
+	{ SND_PCM_FORMAT_S32_LE,   "S32_LE",   4 },
+	{ SND_PCM_FORMAT_FLOAT_LE, "FLOAT_LE", 4 },
+};
+
+struct Result {
+	double play; // nsec per channel-period
+	double capt;
+};
+
+static Result
+run (Format const& f, int nchan, int nfrm, int iter, std::vector<float>& src, std::vector<float>& dst, std::vector<char>& dev)
+{
+	play_function play = play_func (f.format);
+	capt_function capt = capt_func (f.format);
+	int const     step = nchan * f.size;
+
+	PBD::microseconds_t t0 = PBD::get_microseconds ();
+	for (int i = 0; i < iter; ++i) {
+		for (int c = 0; c < nchan; ++c) {
+			play (&src[c * nfrm], &dev[c * f.size], nfrm, 1, step);
+		}
+	}
+	PBD::microseconds_t t1 = PBD::get_microseconds ();
+	for (int i = 0; i < iter; ++i) {
+		for (int c = 0; c < nchan; ++c) {
+			capt (&dev[c * f.size], &dst[c * nfrm], nfrm, 1, step);
+		}
+	}
+	PBD::microseconds_t t2 = PBD::get_microseconds ();
+
+	Result r;
+	r.play = 1e3 * (t1 - t0) / ((double)iter * nchan);
+	r.capt = 1e3 * (t2 - t1) / ((double)iter * nchan);
+	return r;
+}
+
+int
+main (int argc, char** argv)
+{
+	int const nchan = argc > 1 ? std::max (1, atoi (argv[1])) : 64;
+	int const iter  = argc > 2 ? std::max (1, atoi (argv[2])) : 2000;
+
+	static const int periods[] = { 32, 64, 256, 1024 };
+	int const        max_nfrm  = 1024;
+
+	std::vector<float> src (nchan * max_nfrm);
+	std::vector<float> dst (nchan * max_nfrm);
+	std::vector<float> ref (nchan * max_nfrm);
+	std::vector<char>  dev (nchan * max_nfrm * 4);
+
+	/* include some out-of-range samples to exercise clipping */
+	for (size_t i = 0; i < src.size (); ++i) {
+		src[i] = 1.2f * sinf (i * .01f);
+	}
+
+	const char* opt = init (true);
+	printf ("%d channels, interleaved [nsec per channel-period]\n", nchan);
+	printf ("format\t\tperiod\tscalar play/capt\t%s play/capt\tspeedup\n", opt);
+
+	for (size_t f = 0; f < sizeof (formats) / sizeof (Format); ++f) {
+		for (size_t p = 0; p < sizeof (periods) / sizeof (int); ++p) {
+			int const nfrm = periods[p];
+
+			init (false);
+			Result rs = run (formats[f], nchan, nfrm, iter, src, ref, dev);
+
+			init (true);
+			Result ro = run (formats[f], nchan, nfrm, iter, src, dst, dev);
+
+			/* optimized and scalar conversion must be identical */
+			if (memcmp (&ref[0], &dst[0], nchan * nfrm * sizeof (float))) {
+				fprintf (stderr, "%s: optimized conversion differs from scalar\n", formats[f].name);
+				return 1;
+			}
+
+			printf ("%-8s\t%d\t%8.1f / %8.1f\t%8.1f / %8.1f\t%.2f\n",
+			        formats[f].name, nfrm, rs.play, rs.capt, ro.play, ro.capt,
+			        (rs.play + rs.capt) / std::max (1e-3, ro.play + ro.capt));
+		}
+	}
+
+	return 0;
+}
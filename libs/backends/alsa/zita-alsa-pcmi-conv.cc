@@ -0,0 +1,576 @@
+/*
+ * Copyright (C) 2026 Ardour Developers
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if defined(__NetBSD__)
+#include <sys/endian.h>
+#else
+#include <endian.h>
+#endif
+#include <byteswap.h>
+
+#if defined(ARCH_X86) && defined(BUILD_SSE_OPTIMIZATIONS) && defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#if defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
+#include "pbd/fpu.h"
+
+#include "zita-alsa-pcmi-conv.h"
+
+using namespace Alsa_pcmi_conv;
+
+/* number of samples converted at a time, on the stack */
+#define BLKSIZE 64
+
+static scale_clip_function scale_clip = scale_clip_scalar;
+static scale_function      scale      = scale_scalar;
+
+/* Kernels ********************************************************************/
+
+void
+Alsa_pcmi_conv::scale_clip_scalar (const float* src, int32_t* dst, int n, float scl)
+{
+	for (int i = 0; i < n; ++i) {
+		float const s = src[i];
+		if (s > 1) {
+			dst[i] = scl;
+		} else if (s < -1) {
+			dst[i] = -scl;
+		} else {
+			dst[i] = (int32_t)(scl * s);
+		}
+	}
+}
+
+void
+Alsa_pcmi_conv::scale_scalar (const int32_t* src, float* dst, int n, float scl)
+{
+	for (int i = 0; i < n; ++i) {
+		dst[i] = (float)src[i] / scl;
+	}
+}
+
+#if defined(ARCH_X86) && defined(BUILD_SSE_OPTIMIZATIONS) && defined(__SSE2__)
+
+void
+Alsa_pcmi_conv::scale_clip_sse2 (const float* src, int32_t* dst, int n, float scl)
+{
+	__m128 const pos = _mm_set1_ps (1.f);
+	__m128 const neg = _mm_set1_ps (-1.f);
+	__m128 const s   = _mm_set1_ps (scl);
+
+	int i = 0;
+	for (; i + 4 <= n; i += 4) {
+		__m128 x = _mm_loadu_ps (src + i);
+		x        = _mm_min_ps (_mm_max_ps (x, neg), pos);
+		_mm_storeu_si128 ((__m128i*)(dst + i), _mm_cvttps_epi32 (_mm_mul_ps (x, s)));
+	}
+	scale_clip_scalar (src + i, dst + i, n - i, scl);
+}
+
+void
+Alsa_pcmi_conv::scale_sse2 (const int32_t* src, float* dst, int n, float scl)
+{
+	__m128 const s = _mm_set1_ps (scl);
+
+	int i = 0;
+	for (; i + 4 <= n; i += 4) {
+		__m128i x = _mm_loadu_si128 ((__m128i const*)(src + i));
+		_mm_storeu_ps (dst + i, _mm_div_ps (_mm_cvtepi32_ps (x), s));
+	}
+	scale_scalar (src + i, dst + i, n - i, scl);
+}
+
+#endif
+
+#if defined(__aarch64__)
+
+void
+Alsa_pcmi_conv::scale_clip_neon (const float* src, int32_t* dst, int n, float scl)
+{
+	float32x4_t const pos = vdupq_n_f32 (1.f);
+	float32x4_t const neg = vdupq_n_f32 (-1.f);
+
+	int i = 0;
+	for (; i + 4 <= n; i += 4) {
+		float32x4_t x = vld1q_f32 (src + i);
+		x             = vminq_f32 (vmaxq_f32 (x, neg), pos);
+		vst1q_s32 (dst + i, vcvtq_s32_f32 (vmulq_n_f32 (x, scl)));
+	}
+	scale_clip_scalar (src + i, dst + i, n - i, scl);
+}
+
+void
+Alsa_pcmi_conv::scale_neon (const int32_t* src, float* dst, int n, float scl)
+{
+	float32x4_t const s = vdupq_n_f32 (scl);
+
+	int i = 0;
+	for (; i + 4 <= n; i += 4) {
+		vst1q_f32 (dst + i, vdivq_f32 (vcvtq_f32_s32 (vld1q_s32 (src + i)), s));
+	}
+	scale_scalar (src + i, dst + i, n - i, scl);
+}
+
+#endif
+
+const char*
+Alsa_pcmi_conv::init (bool try_optimization)
+{
+	scale_clip = scale_clip_scalar;
+	scale      = scale_scalar;
+
+	if (!try_optimization) {
+		return "scalar";
+	}
+
+	PBD::FPU* fpu = PBD::FPU::instance ();
+
+#if defined(ARCH_X86) && defined(BUILD_SSE_OPTIMIZATIONS)
+	if (fpu->has_avx ()) {
+		scale_clip = scale_clip_avx;
+		scale      = scale_avx;
+		return "AVX";
+	}
+#ifdef __SSE2__
+	if (fpu->has_sse2 ()) {
+		scale_clip = scale_clip_sse2;
+		scale      = scale_sse2;
+		return "SSE2";
+	}
+#endif
+#elif defined(__aarch64__)
+	if (fpu->has_neon ()) {
+		scale_clip = scale_clip_neon;
+		scale      = scale_neon;
+		return "NEON";
+	}
+#endif
+
+	(void) fpu;
+	return "scalar";
+}
+
+/* Device formats *************************************************************/
+
+static inline void
+store_16le (char* dst, int32_t d)
+{
+	dst[0] = d;
+	dst[1] = d >> 8;
+}
+
+static inline void
+store_16be (char* dst, int32_t d)
+{
+	dst[0] = d >> 8;
+	dst[1] = d;
+}
+
+static inline void
+store_24le (char* dst, int32_t d)
+{
+	dst[0] = d;
+	dst[1] = d >> 8;
+	dst[2] = d >> 16;
+}
+
+static inline void
+store_24be (char* dst, int32_t d)
+{
+	dst[0] = d >> 16;
+	dst[1] = d >> 8;
+	dst[2] = d;
+}
+
+static inline void
+store_32le (char* dst, int32_t d)
+{
+	dst[0] = 0;
+	dst[1] = d;
+	dst[2] = d >> 8;
+	dst[3] = d >> 16;
+}
+
+static inline void
+store_32be (char* dst, int32_t d)
+{
+	dst[0] = d >> 16;
+	dst[1] = d >> 8;
+	dst[2] = d;
+	dst[3] = 0;
+}
+
+static inline int32_t
+load_16le (const char* src)
+{
+	short int s = (src[0] & 0xFF);
+	s          += (src[1] & 0xFF) << 8;
+	return s;
+}
+
+static inline int32_t
+load_16be (const char* src)
+{
+	short int s = (src[0] & 0xFF) << 8;
+	s          += (src[1] & 0xFF);
+	return s;
+}
+
+static inline int32_t
+load_24le (const char* src)
+{
+	int32_t s = (src[0] & 0xFF);
+	s        += (src[1] & 0xFF) << 8;
+	s        += (src[2] & 0xFF) << 16;
+	if (s & 0x00800000) {
+		s -= 0x01000000;
+	}
+	return s;
+}
+
+static inline int32_t
+load_24be (const char* src)
+{
+	int32_t s = (src[0] & 0xFF) << 16;
+	s        += (src[1] & 0xFF) << 8;
+	s        += (src[2] & 0xFF);
+	if (s & 0x00800000) {
+		s -= 0x01000000;
+	}
+	return s;
+}
+
+static inline int32_t
+load_32le (const char* src)
+{
+	int32_t s = (src[1] & 0xFF) << 8;
+	s        += (src[2] & 0xFF) << 16;
+	s        += (src[3] & 0xFF) << 24;
+	return s;
+}
+
+static inline int32_t
+load_32be (const char* src)
+{
+	int32_t s = (src[0] & 0xFF) << 24;
+	s        += (src[1] & 0xFF) << 16;
+	s        += (src[2] & 0xFF) << 8;
+	return s;
+}
+
+/* Integer formats: 16bit and 24bit use the full range, 32bit
+ * devices get 24bit data, see also store_32le, load_32le.
+ */
+template <void (*store) (char*, int32_t)>
+static char*
+play_int (const float* src, char* dst, int nfrm, int step, int dev_step, float scl)
+{
+	float   f[BLKSIZE];
+	int32_t d[BLKSIZE];
+
+	while (nfrm > 0) {
+		int const n = nfrm < BLKSIZE ? nfrm : BLKSIZE;
+
+		if (step == 1) {
+			scale_clip (src, d, n, scl);
+			src += n;
+		} else {
+			for (int i = 0; i < n; ++i, src += step) {
+				f[i] = *src;
+			}
+			scale_clip (f, d, n, scl);
+		}
+
+		for (int i = 0; i < n; ++i) {
+			store (dst, d[i]);
+			dst += dev_step;
+		}
+		nfrm -= n;
+	}
+	return dst;
+}
+
+template <int32_t (*load) (const char*)>
+static const char*
+capt_int (const char* src, float* dst, int nfrm, int step, int dev_step, float scl)
+{
+	float   f[BLKSIZE];
+	int32_t d[BLKSIZE];
+
+	while (nfrm > 0) {
+		int const n = nfrm < BLKSIZE ? nfrm : BLKSIZE;
+
+		for (int i = 0; i < n; ++i) {
+			d[i] = load (src);
+			src += dev_step;
+		}
+
+		if (step == 1) {
+			scale (d, dst, n, scl);
+			dst += n;
+		} else {
+			scale (d, f, n, scl);
+			for (int i = 0; i < n; ++i, dst += step) {
+				*dst = f[i];
+			}
+		}
+		nfrm -= n;
+	}
+	return src;
+}
+
+static char*
+play_16le (const float* src, char* dst, int nfrm, int step, int dev_step)
+{
+	return play_int<store_16le> (src, dst, nfrm, step, dev_step, (float)0x7fff);
+}
+
+static char*
+play_16be (const float* src, char* dst, int nfrm, int step, int dev_step)
+{
+	return play_int<store_16be> (src, dst, nfrm, step, dev_step, (float)0x7fff);
+}
+
+static char*
+play_24le (const float* src, char* dst, int nfrm, int step, int dev_step)
+{
+	return play_int<store_24le> (src, dst, nfrm, step, dev_step, (float)0x007fffff);
+}
+
+static char*
+play_24be (const float* src, char* dst, int nfrm, int step, int dev_step)
+{
+	return play_int<store_24be> (src, dst, nfrm, step, dev_step, (float)0x007fffff);
+}
+
+static char*
+play_32le (const float* src, char* dst, int nfrm, int step, int dev_step)
+{
+	return play_int<store_32le> (src, dst, nfrm, step, dev_step, (float)0x007fffff);
+}
+
+static char*
+play_32be (const float* src, char* dst, int nfrm, int step, int dev_step)
+{
+	return play_int<store_32be> (src, dst, nfrm, step, dev_step, (float)0x007fffff);
+}
+
+static char*
+play_floatne (const float* src, char* dst, int nfrm, int step, int dev_step)
+{
+	while (nfrm--) {
+		*((float*)dst) = *src;
+		dst += dev_step;
+		src += step;
+	}
+	return dst;
+}
+
+static char*
+play_floatre (const float* src, char* dst, int nfrm, int step, int dev_step)
+{
+	uint32_t const* s = (uint32_t const*)src;
+
+	while (nfrm--) {
+		*((uint32_t*)dst) = bswap_32 (*s);
+		dst += dev_step;
+		s += step;
+	}
+	return dst;
+}
+
+static const char*
+capt_16le (const char* src, float* dst, int nfrm, int step, int dev_step)
+{
+	return capt_int<load_16le> (src, dst, nfrm, step, dev_step, (float)0x7fff);
+}
+
+static const char*
+capt_16be (const char* src, float* dst, int nfrm, int step, int dev_step)
+{
+	return capt_int<load_16be> (src, dst, nfrm, step, dev_step, (float)0x7fff);
+}
+
+static const char*
+capt_24le (const char* src, float* dst, int nfrm, int step, int dev_step)
+{
+	return capt_int<load_24le> (src, dst, nfrm, step, dev_step, (float)0x007fffff);
+}
+
+static const char*
+capt_24be (const char* src, float* dst, int nfrm, int step, int dev_step)
+{
+	return capt_int<load_24be> (src, dst, nfrm, step, dev_step, (float)0x007fffff);
+}
+
+static const char*
+capt_32le (const char* src, float* dst, int nfrm, int step, int dev_step)
+{
+	return capt_int<load_32le> (src, dst, nfrm, step, dev_step, (float)0x7fffff00);
+}
+
+static const char*
+capt_32be (const char* src, float* dst, int nfrm, int step, int dev_step)
+{
+	return capt_int<load_32be> (src, dst, nfrm, step, dev_step, (float)0x7fffff00);
+}
+
+static const char*
+capt_floatne (const char* src, float* dst, int nfrm, int step, int dev_step)
+{
+	while (nfrm--) {
+		*dst = *((float const*)src);
+		dst += step;
+		src += dev_step;
+	}
+	return src;
+}
+
+static const char*
+capt_floatre (const char* src, float* dst, int nfrm, int step, int dev_step)
+{
+	uint32_t* d = (uint32_t*)dst;
+
+	while (nfrm--) {
+		*d = bswap_32 (*((uint32_t const*)src));
+		d += step;
+		src += dev_step;
+	}
+	return src;
+}
+
+static char*
+clear_16 (char* dst, int nfrm, int dev_step)
+{
+	while (nfrm--) {
+		*((short int*)dst) = 0;
+		dst += dev_step;
+	}
+	return dst;
+}
+
+static char*
+clear_24 (char* dst, int nfrm, int dev_step)
+{
+	while (nfrm--) {
+		dst[0] = 0;
+		dst[1] = 0;
+		dst[2] = 0;
+		dst += dev_step;
+	}
+	return dst;
+}
+
+static char*
+clear_32 (char* dst, int nfrm, int dev_step)
+{
+	while (nfrm--) {
+		*((int*)dst) = 0;
+		dst += dev_step;
+	}
+	return dst;
+}
+
+clear_function
+Alsa_pcmi_conv::clear_func (snd_pcm_format_t format)
+{
+	switch (format) {
+		case SND_PCM_FORMAT_FLOAT_LE:
+		case SND_PCM_FORMAT_FLOAT_BE:
+		case SND_PCM_FORMAT_S32_LE:
+		case SND_PCM_FORMAT_S32_BE:
+			return clear_32;
+		case SND_PCM_FORMAT_S24_3LE:
+		case SND_PCM_FORMAT_S24_3BE:
+			return clear_24;
+		case SND_PCM_FORMAT_S16_LE:
+		case SND_PCM_FORMAT_S16_BE:
+			return clear_16;
+		default:
+			return 0;
+	}
+}
+
+play_function
+Alsa_pcmi_conv::play_func (snd_pcm_format_t format)
+{
+	switch (format) {
+		case SND_PCM_FORMAT_FLOAT_LE:
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+			return play_floatne;
+#else
+			return play_floatre;
+#endif
+		case SND_PCM_FORMAT_FLOAT_BE:
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+			return play_floatre;
+#else
+			return play_floatne;
+#endif
+		case SND_PCM_FORMAT_S32_LE:
+			return play_32le;
+		case SND_PCM_FORMAT_S32_BE:
+			return play_32be;
+		case SND_PCM_FORMAT_S24_3LE:
+			return play_24le;
+		case SND_PCM_FORMAT_S24_3BE:
+			return play_24be;
+		case SND_PCM_FORMAT_S16_LE:
+			return play_16le;
+		case SND_PCM_FORMAT_S16_BE:
+			return play_16be;
+		default:
+			return 0;
+	}
+}
+
+capt_function
+Alsa_pcmi_conv::capt_func (snd_pcm_format_t format)
+{
+	switch (format) {
+		case SND_PCM_FORMAT_FLOAT_LE:
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+			return capt_floatne;
+#else
+			return capt_floatre;
+#endif
+		case SND_PCM_FORMAT_FLOAT_BE:
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+			return capt_floatre;
+#else
+			return capt_floatne;
+#endif
+		case SND_PCM_FORMAT_S32_LE:
+			return capt_32le;
+		case SND_PCM_FORMAT_S32_BE:
+			return capt_32be;
+		case SND_PCM_FORMAT_S24_3LE:
+			return capt_24le;
+		case SND_PCM_FORMAT_S24_3BE:
+			return capt_24be;
+		case SND_PCM_FORMAT_S16_LE:
+			return capt_16le;
+		case SND_PCM_FORMAT_S16_BE:
+			return capt_16be;
+		default:
+			return 0;
+	}
+}
@@ -0,0 +1,79 @@
+/*
+ * Copyright (C) 2026 Ardour Developers
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _ZITA_ALSA_PCMI_CONV_H_
+#define _ZITA_ALSA_PCMI_CONV_H_
+
+#include <alsa/asoundlib.h>
+#include <stdint.h>
+
+/* Sample format conversion between float and the device's
+ * (usually interleaved) sample formats.
+ *
+ * Conversion is done in blocks: the float <> int arithmetic, including
+ * clipping, uses vector instructions where available, the remaining
+ * per-sample work is reduced to loads/stores at the device's stride.
+ */
+namespace Alsa_pcmi_conv {
+
+/* `step` is the distance between samples in the float buffer,
+ * `dev_step` the distance between samples of a channel in the
+ * device buffer, in bytes.
+ */
+typedef char* (*clear_function) (char* dst, int nfrm, int dev_step);
+typedef char* (*play_function) (const float* src, char* dst, int nfrm, int step, int dev_step);
+typedef const char* (*capt_function) (const char* src, float* dst, int nfrm, int step, int dev_step);
+
+/* Kernels, for contiguous buffers */
+
+/* dst[i] = (int32_t) (scale * clip (src[i], -1, 1)) */
+typedef void (*scale_clip_function) (const float* src, int32_t* dst, int n, float scale);
+/* dst[i] = src[i] / scale */
+typedef void (*scale_function) (const int32_t* src, float* dst, int n, float scale);
+
+/** Select the kernels to use, depending on the CPU. Called by Alsa_pcmi,
+ * not realtime safe.
+ * @param try_optimization use vector instructions if available
+ * @return name of the kernels in use
+ */
+const char* init (bool try_optimization = true);
+
+clear_function clear_func (snd_pcm_format_t);
+play_function  play_func (snd_pcm_format_t);
+capt_function  capt_func (snd_pcm_format_t);
+
+void scale_clip_scalar (const float*, int32_t*, int, float);
+void scale_scalar (const int32_t*, float*, int, float);
+
+#if defined(ARCH_X86) && defined(BUILD_SSE_OPTIMIZATIONS)
+#ifdef __SSE2__
+void scale_clip_sse2 (const float*, int32_t*, int, float);
+void scale_sse2 (const int32_t*, float*, int, float);
+#endif
+/* zita-alsa-pcmi-avx.cc, compiled with -mavx */
+void scale_clip_avx (const float*, int32_t*, int, float);
+void scale_avx (const int32_t*, float*, int, float);
+#endif
+
+#if defined(__aarch64__)
+void scale_clip_neon (const float*, int32_t*, int, float);
+void scale_neon (const int32_t*, float*, int, float);
+#endif
+
+} // namespace Alsa_pcmi_conv
+
+#endif
@@ -17,13 +17,7 @@
  *
  */
 
-#if defined(__NetBSD__)
-#include <sys/endian.h>
-#else
-#include <endian.h>
-#endif
 #include "zita-alsa-pcmi.h"
-#include <byteswap.h>
 #include <sys/time.h>
 
 /* Public members *************************************************************/
@@ -65,6 +59,12 @@ Alsa_pcmi::Alsa_pcmi (
 	if (p && *p) {
 		_debug = atoi (p);
 	}
+
+	p = Alsa_pcmi_conv::init ();
+	if (_debug & DEBUG_INIT) {
+		fprintf (stderr, "Alsa_pcmi: using %s sample format conversion.\n", p);
+	}
+
 	initialise (play_name, capt_name, ctrl_name);
 }
 
@@ -319,19 +319,19 @@ Alsa_pcmi::capt_init (snd_pcm_uframes_t len)
 void
 Alsa_pcmi::clear_chan (int chan, int len)
 {
-	_play_ptr[chan] = (this->*Alsa_pcmi::_clear_func) (_play_ptr[chan], len);
+	_play_ptr[chan] = _clear_func (_play_ptr[chan], len, _play_step);
 }
 
 void
 Alsa_pcmi::play_chan (int chan, const float* src, int len, int step)
 {
-	_play_ptr[chan] = (this->*Alsa_pcmi::_play_func) (src, _play_ptr[chan], len, step);
+	_play_ptr[chan] = _play_func (src, _play_ptr[chan], len, step, _play_step);
 }
 
 void
 Alsa_pcmi::capt_chan (int chan, float* dst, int len, int step)
 {
-	_capt_ptr[chan] = (this->*Alsa_pcmi::_capt_func) (_capt_ptr[chan], dst, len, step);
+	_capt_ptr[chan] = _capt_func (_capt_ptr[chan], dst, len, step, _capt_step);
 }
 
 int
@@ -527,61 +527,15 @@ Alsa_pcmi::initialise (const char* play_name, const char* capt_name, const char*
 		snd_pcm_hw_params_get_format (_play_hwpar, &_play_format);
 		snd_pcm_hw_params_get_access (_play_hwpar, &_play_access);
 
-		switch (_play_format) {
-			case SND_PCM_FORMAT_FLOAT_LE:
-				_clear_func = &Alsa_pcmi::clear_32;
-#if __BYTE_ORDER == __LITTLE_ENDIAN
-				_play_func = &Alsa_pcmi::play_floatne;
-#else
-				_play_func = &Alsa_pcmi::play_floatre;
-#endif
-				break;
+		_clear_func = Alsa_pcmi_conv::clear_func (_play_format);
+		_play_func  = Alsa_pcmi_conv::play_func (_play_format);
 
-			case SND_PCM_FORMAT_FLOAT_BE:
-				_clear_func = &Alsa_pcmi::clear_32;
-#if __BYTE_ORDER == __LITTLE_ENDIAN
-				_play_func = &Alsa_pcmi::play_floatre;
-#else
-				_play_func = &Alsa_pcmi::play_floatne;
-#endif
-				break;
-
-			case SND_PCM_FORMAT_S32_LE:
-				_clear_func = &Alsa_pcmi::clear_32;
-				_play_func  = &Alsa_pcmi::play_32le;
-				break;
-
-			case SND_PCM_FORMAT_S32_BE:
-				_clear_func = &Alsa_pcmi::clear_32;
-				_play_func  = &Alsa_pcmi::play_32be;
-				break;
-
-			case SND_PCM_FORMAT_S24_3LE:
-				_clear_func = &Alsa_pcmi::clear_24;
-				_play_func  = &Alsa_pcmi::play_24le;
-				break;
-
-			case SND_PCM_FORMAT_S24_3BE:
-				_clear_func = &Alsa_pcmi::clear_24;
-				_play_func  = &Alsa_pcmi::play_24be;
-				break;
-
-			case SND_PCM_FORMAT_S16_LE:
-				_clear_func = &Alsa_pcmi::clear_16;
-				_play_func  = &Alsa_pcmi::play_16le;
-				break;
-
-			case SND_PCM_FORMAT_S16_BE:
-				_clear_func = &Alsa_pcmi::clear_16;
-				_play_func  = &Alsa_pcmi::play_16be;
-				break;
-
-			default:
-				if (_debug & DEBUG_INIT) {
-					fprintf (stderr, "Alsa_pcmi: can't handle playback sample format.\n");
-				}
-				_state = -6;
-				return;
+		if (!_play_func) {
+			if (_debug & DEBUG_INIT) {
+				fprintf (stderr, "Alsa_pcmi: can't handle playback sample format.\n");
+			}
+			_state = -6;
+			return;
 		}
 
 		_play_npfd = snd_pcm_poll_descriptors_count (_play_handle);
@@ -615,53 +569,14 @@ Alsa_pcmi::initialise (const char* play_name, const char* capt_name, const char*
 		snd_pcm_hw_params_get_format (_capt_hwpar, &_capt_format);
 		snd_pcm_hw_params_get_access (_capt_hwpar, &_capt_access);
 
-		switch (_capt_format) {
-			case SND_PCM_FORMAT_FLOAT_LE:
-#if __BYTE_ORDER == __LITTLE_ENDIAN
-				_capt_func = &Alsa_pcmi::capt_floatne;
-#else
-				_capt_func = &Alsa_pcmi::capt_floatre;
-#endif
-				break;
-
-			case SND_PCM_FORMAT_FLOAT_BE:
-#if __BYTE_ORDER == __LITTLE_ENDIAN
-				_capt_func = &Alsa_pcmi::capt_floatre;
-#else
-				_capt_func = &Alsa_pcmi::capt_floatne;
-#endif
-				break;
-
-			case SND_PCM_FORMAT_S32_LE:
-				_capt_func = &Alsa_pcmi::capt_32le;
-				break;
-
-			case SND_PCM_FORMAT_S32_BE:
-				_capt_func = &Alsa_pcmi::capt_32be;
-				break;
-
-			case SND_PCM_FORMAT_S24_3LE:
-				_capt_func = &Alsa_pcmi::capt_24le;
-				break;
+		_capt_func = Alsa_pcmi_conv::capt_func (_capt_format);
 
-			case SND_PCM_FORMAT_S24_3BE:
-				_capt_func = &Alsa_pcmi::capt_24be;
-				break;
-
-			case SND_PCM_FORMAT_S16_LE:
-				_capt_func = &Alsa_pcmi::capt_16le;
-				break;
-
-			case SND_PCM_FORMAT_S16_BE:
-				_capt_func = &Alsa_pcmi::capt_16be;
-				break;
-
-			default:
-				if (_debug & DEBUG_INIT) {
-					fprintf (stderr, "Alsa_pcmi: can't handle capture sample format.\n");
-				}
-				_state = -6;
-				return;
+		if (!_capt_func) {
+			if (_debug & DEBUG_INIT) {
+				fprintf (stderr, "Alsa_pcmi: can't handle capture sample format.\n");
+			}
+			_state = -6;
+			return;
 		}
 
 		_capt_npfd = snd_pcm_poll_descriptors_count (_capt_handle);
@@ -899,321 +814,3 @@ Alsa_pcmi::xruncheck (snd_pcm_status_t* stat)
 	}
 	return 0.0f;
 }
-
-char*
-Alsa_pcmi::clear_16 (char* dst, int nfrm)
-{
-	while (nfrm--) {
-		*((short int*)dst) = 0;
-		dst += _play_step;
-	}
-	return dst;
-}
-
-char*
-Alsa_pcmi::clear_24 (char* dst, int nfrm)
-{
-	while (nfrm--) {
-		dst[0] = 0;
-		dst[1] = 0;
-		dst[2] = 0;
-		dst += _play_step;
-	}
-	return dst;
-}
-
-char*
-Alsa_pcmi::clear_32 (char* dst, int nfrm)
-{
-	while (nfrm--) {
-		*((int*)dst) = 0;
-		dst += _play_step;
-	}
-	return dst;
-}
-
-char*
-Alsa_pcmi::play_16le (const float* src, char* dst, int nfrm, int step)
-{
-	while (nfrm--) {
-		float const s = *src;
-
-		short int d;
-		if (s > 1) {
-			d = 0x7fff;
-		} else if (s < -1) {
-			d = 0x8001;
-		} else {
-			d = (short int)((float)0x7fff * s);
-		}
-		dst[0] = d;
-		dst[1] = d >> 8;
-		dst += _play_step;
-		src += step;
-	}
-	return dst;
-}
-
-char*
-Alsa_pcmi::play_16be (const float* src, char* dst, int nfrm, int step)
-{
-
-	while (nfrm--) {
-		float const s = *src;
-
-		short int d;
-		if (s > 1) {
-			d = 0x7fff;
-		} else if (s < -1) {
-			d = 0x8001;
-		} else {
-			d = (short int)((float)0x7fff * s);
-		}
-		dst[0] = d >> 8;
-		dst[1] = d;
-		dst += _play_step;
-		src += step;
-	}
-	return dst;
-}
-
-char*
-Alsa_pcmi::play_24le (const float* src, char* dst, int nfrm, int step)
-{
-	while (nfrm--) {
-		float const s = *src;
-
-		int d;
-		if (s > 1) {
-			d = 0x007fffff;
-		} else if (s < -1) {
-			d = 0x00800001;
-		} else {
-			d = (int)((float)0x007fffff * s);
-		}
-		dst[0] = d;
-		dst[1] = d >> 8;
-		dst[2] = d >> 16;
-		dst += _play_step;
-		src += step;
-	}
-	return dst;
-}
-
-char*
-Alsa_pcmi::play_24be (const float* src, char* dst, int nfrm, int step)
-{
-	while (nfrm--) {
-		float const s = *src;
-
-		int d;
-		if (s > 1) {
-			d = 0x007fffff;
-		} else if (s < -1) {
-			d = 0x00800001;
-		} else {
-			d = (int)((float)0x007fffff * s);
-		}
-		dst[0] = d >> 16;
-		dst[1] = d >> 8;
-		dst[2] = d;
-		dst += _play_step;
-		src += step;
-	}
-	return dst;
-}
-
-char*
-Alsa_pcmi::play_32le (const float* src, char* dst, int nfrm, int step)
-{
-	while (nfrm--) {
-		float const s = *src;
-
-		int d;
-		if (s > 1) {
-			d = 0x007fffff;
-		} else if (s < -1) {
-			d = 0x00800001;
-		} else {
-			d = (int)((float)0x007fffff * s);
-		}
-		dst[0] = 0;
-		dst[1] = d;
-		dst[2] = d >> 8;
-		dst[3] = d >> 16;
-		dst += _play_step;
-		src += step;
-	}
-	return dst;
-}
-
-char*
-Alsa_pcmi::play_32be (const float* src, char* dst, int nfrm, int step)
-{
-	while (nfrm--) {
-		float const s = *src;
-
-		int d;
-		if (s > 1) {
-			d = 0x007fffff;
-		} else if (s < -1) {
-			d = 0x00800001;
-		} else {
-			d = (int)((float)0x007fffff * s);
-		}
-		dst[0] = d >> 16;
-		dst[1] = d >> 8;
-		dst[2] = d;
-		dst[3] = 0;
-		dst += _play_step;
-		src += step;
-	}
-	return dst;
-}
-
-char*
-Alsa_pcmi::play_floatne (const float* src, char* dst, int nfrm, int step)
-{
-	while (nfrm--) {
-		*((float*)dst) = *src;
-		dst += _play_step;
-		src += step;
-	}
-	return dst;
-}
-
-char*
-Alsa_pcmi::play_floatre (const float* src, char* dst, int nfrm, int step)
-{
-	uint32_t const* s = (uint32_t const*)src;
-
-	while (nfrm--) {
-		*((uint32_t*)dst) = bswap_32 (*s);
-		dst += _play_step;
-		s += step;
-	}
-	return dst;
-}
-
-const char*
-Alsa_pcmi::capt_16le (const char* src, float* dst, int nfrm, int step)
-{
-	while (nfrm--) {
-		short int s = (src[0] & 0xFF);
-		s          += (src[1] & 0xFF) << 8;
-
-		const float d = (float)s / (float)0x7fff;
-		*dst          = d;
-		dst += step;
-		src += _capt_step;
-	}
-	return src;
-}
-
-const char*
-Alsa_pcmi::capt_16be (const char* src, float* dst, int nfrm, int step)
-{
-	while (nfrm--) {
-		short int s = (src[0] & 0xFF) << 8;
-		s          += (src[1] & 0xFF);
-
-		float const d = (float)s / (float)0x7fff;
-		*dst          = d;
-		dst += step;
-		src += _capt_step;
-	}
-	return src;
-}
-
-const char*
-Alsa_pcmi::capt_24le (const char* src, float* dst, int nfrm, int step)
-{
-	while (nfrm--) {
-		int32_t s = (src[0] & 0xFF);
-		s        += (src[1] & 0xFF) << 8;
-		s        += (src[2] & 0xFF) << 16;
-
-		if (s & 0x00800000) {
-			s -= 0x01000000;
-		}
-		float const d = (float)s / (float)0x007fffff;
-		*dst          = d;
-		dst += step;
-		src += _capt_step;
-	}
-	return src;
-}
-
-const char*
-Alsa_pcmi::capt_24be (const char* src, float* dst, int nfrm, int step)
-{
-	while (nfrm--) {
-		int32_t s = (src[0] & 0xFF) << 16;
-		s        += (src[1] & 0xFF) << 8;
-		s        += (src[2] & 0xFF);
-		if (s & 0x00800000) {
-			s -= 0x01000000;
-		}
-		float const d = (float)s / (float)0x007fffff;
-		*dst          = d;
-		dst += step;
-		src += _capt_step;
-	}
-	return src;
-}
-
-const char*
-Alsa_pcmi::capt_32le (const char* src, float* dst, int nfrm, int step)
-{
-	while (nfrm--) {
-		int32_t s = (src[1] & 0xFF) << 8;
-		s        += (src[2] & 0xFF) << 16;
-		s        += (src[3] & 0xFF) << 24;
-
-		float const d = (float)s / (float)0x7fffff00;
-		*dst          = d;
-		dst += step;
-		src += _capt_step;
-	}
-	return src;
-}
-
-const char*
-Alsa_pcmi::capt_32be (const char* src, float* dst, int nfrm, int step)
-{
-	while (nfrm--) {
-		int32_t s = (src[0] & 0xFF) << 24;
-		s        += (src[1] & 0xFF) << 16;
-		s        += (src[2] & 0xFF) << 8;
-
-		float const d = (float)s / (float)0x7fffff00;
-		*dst          = d;
-		dst += step;
-		src += _capt_step;
-	}
-	return src;
-}
-
-const char*
-Alsa_pcmi::capt_floatne (const char* src, float* dst, int nfrm, int step)
-{
-	while (nfrm--) {
-		*dst = *((float const*)src);
-		dst += step;
-		src += _capt_step;
-	}
-	return src;
-}
-
-const char*
-Alsa_pcmi::capt_floatre (const char* src, float* dst, int nfrm, int step)
-{
-	uint32_t* d = (uint32_t*)dst;
-
-	while (nfrm--) {
-		*d = bswap_32 (*((uint32_t const*)src));
-		d += step;
-		src += _capt_step;
-	}
-	return src;
-}
@@ -25,6 +25,8 @@
 #include <alsa/asoundlib.h>
 #include <stdint.h>
 
+#include "zita-alsa-pcmi-conv.h"
+
 class Alsa_pcmi
 {
 public:
@@ -109,10 +111,6 @@ public:
 	snd_pcm_t* capt_handle (void) const { return _capt_handle; }
 
 private:
-	typedef char* (Alsa_pcmi::*clear_function) (char*, int);
-	typedef char* (Alsa_pcmi::*play_function) (const float*, char*, int, int);
-	typedef const char* (Alsa_pcmi::*capt_function) (const char*, float*, int, int);
-
 	enum { MAXPFD  = 16,
 	       MAXCHAN = 128 };
 
@@ -122,28 +120,6 @@ private:
 	int   recover (void);
 	float xruncheck (snd_pcm_status_t* stat);
 
-	char* clear_32 (char* dst, int nfrm);
-	char* clear_24 (char* dst, int nfrm);
-	char* clear_16 (char* dst, int nfrm);
-
-	char* play_floatne (const float* src, char* dst, int nfrm, int step);
-	char* play_floatre (const float* src, char* dst, int nfrm, int step);
-	char* play_32le (const float* src, char* dst, int nfrm, int step);
-	char* play_24le (const float* src, char* dst, int nfrm, int step);
-	char* play_16le (const float* src, char* dst, int nfrm, int step);
-	char* play_32be (const float* src, char* dst, int nfrm, int step);
-	char* play_24be (const float* src, char* dst, int nfrm, int step);
-	char* play_16be (const float* src, char* dst, int nfrm, int step);
-
-	const char* capt_floatne (const char* src, float* dst, int nfrm, int step);
-	const char* capt_floatre (const char* src, float* dst, int nfrm, int step);
-	const char* capt_32le (const char* src, float* dst, int nfrm, int step);
-	const char* capt_24le (const char* src, float* dst, int nfrm, int step);
-	const char* capt_16le (const char* src, float* dst, int nfrm, int step);
-	const char* capt_32be (const char* src, float* dst, int nfrm, int step);
-	const char* capt_24be (const char* src, float* dst, int nfrm, int step);
-	const char* capt_16be (const char* src, float* dst, int nfrm, int step);
-
 	unsigned int         _fsamp;
 	snd_pcm_uframes_t    _fsize;
 	unsigned int         _play_nfrag;
@@ -176,9 +152,9 @@ private:
 	int                  _capt_step;
 	char*                _play_ptr[MAXCHAN];
 	const char*          _capt_ptr[MAXCHAN];
-	clear_function       _clear_func;
-	play_function        _play_func;
-	capt_function        _capt_func;
+	Alsa_pcmi_conv::clear_function _clear_func;
+	Alsa_pcmi_conv::play_function  _play_func;
+	Alsa_pcmi_conv::capt_function  _capt_func;
 	void*                _dummy[16];
 };
 
@@ -1590,30 +1590,13 @@ void*
 DummyAudioPort::get_buffer (pframes_t n_samples)
 {
 	if (is_input ()) {
-		const std::set<BackendPortPtr>& connections = get_connections ();
-		std::set<BackendPortPtr>::const_iterator it = connections.begin ();
-		if (it == connections.end ()) {
-			memset (_buffer, 0, n_samples * sizeof (Sample));
-		} else {
-			std::shared_ptr<DummyAudioPort> source = std::dynamic_pointer_cast<DummyAudioPort>(*it);
-			assert (source && source->is_output ());
-			if (source->is_physical() && source->is_terminal()) {
-				source->get_buffer(n_samples); // generate signal.
-			}
-			memcpy (_buffer, source->const_buffer (), n_samples * sizeof (Sample));
-			while (++it != connections.end ()) {
-				source = std::dynamic_pointer_cast<DummyAudioPort>(*it);
-				assert (source && source->is_output ());
-				Sample* dst = buffer ();
-				if (source->is_physical() && source->is_terminal()) {
-					source->get_buffer(n_samples); // generate signal.
-				}
-				const Sample* src = source->const_buffer ();
-				for (uint32_t s = 0; s < n_samples; ++s, ++dst, ++src) {
-					*dst += *src;
-				}
+		std::shared_ptr<MixPlan const> plan = mix_plan ();
+		for (std::vector<BackendPortPtr>::const_iterator it = plan->ports.begin (); it != plan->ports.end (); ++it) {
+			if ((*it)->is_physical() && (*it)->is_terminal()) {
+				(*it)->get_buffer(n_samples); // generate signal.
 			}
 		}
+		return mix_connections (_buffer, n_samples);
 	} else if (is_output () && is_physical () && is_terminal()) {
 		if (!_gen_cycle) {
 			generate(n_samples);
@@ -102,6 +102,7 @@ class DummyAudioPort : public DummyPort {
 
 		Sample* buffer () { return _buffer; }
 		const Sample* const_buffer () const { return _buffer; }
+		const Sample* const_audio_buffer () const { return _buffer; }
 		void* get_buffer (pframes_t nframes);
 
 		enum GeneratorType {
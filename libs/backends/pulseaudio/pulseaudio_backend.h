@@ -72,6 +72,7 @@ public:
 
 	Sample* buffer () { return _buffer; }
 	const Sample* const_buffer () const { return _buffer; }
+	const Sample* const_audio_buffer () const { return _buffer; }
 	void* get_buffer (pframes_t nframes);
 
 private:
@@ -1,53 +1,100 @@
-#include "canvas/group.h"
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+#include <ytkmm/ytkmm.h>
+
 #include "canvas/canvas.h"
-#include "canvas/root_group.h"
+#include "canvas/container.h"
 #include "canvas/rectangle.h"
-#include "benchmark.h"
 
 using namespace std;
 using namespace ArdourCanvas;
 
-static void
-test (int items_per_cell)
+/* Compare looking up items at a point in a container holding many
+ * note-like rectangles, with and without a spatial index of the
+ * container's children. Also measures the cost of keeping the index
+ * up to date while children move.
+ *
+ * usage: items_at_point
+ */
+
+static double
+double_random ()
 {
-	Group::default_items_per_cell = items_per_cell;
+	return ((double) rand() / RAND_MAX);
+}
 
-	int const n_rectangles = 10000;
+static double
+elapsed (int64_t start)
+{
+	return (g_get_monotonic_time () - start) / 1e3;
+}
+
+static void
+test (int n_items, bool indexed)
+{
 	int const n_tests = 1000;
-	double const rough_size = 1000;
+	double const width = n_items * 2;
+	double const height = 1024;
 	srand (1);
 
-	ImageCanvas canvas;
+	GtkCanvas canvas;
+	Container* container = new Container (canvas.root ());
+	container->set_indexed_children (indexed);
+
+	vector<Rectangle*> rectangles;
+
+	for (int i = 0; i < n_items; ++i) {
+		double const x = double_random () * width;
+		double const y = double_random () * height;
+		rectangles.push_back (new Rectangle (container, Rect (x, y, x + 10 + double_random () * 100, y + 8)));
+	}
+
+	size_t found = 0;
+	int64_t start;
 
-	list<Item*> rectangles;
+	cout << n_items << (indexed ? "\tindexed" : "\tdumb   ");
 
-	for (int i = 0; i < n_rectangles; ++i) {
-		rectangles.push_back (new Rectangle (canvas.root(), rect_random (rough_size)));
+	/* first lookup builds the table */
+	start = g_get_monotonic_time ();
+	{
+		vector<Item const *> items;
+		canvas.root ()->add_items_at_point (Duple (0, 0), items);
 	}
+	cout << "\t" << elapsed (start);
 
+	start = g_get_monotonic_time ();
 	for (int i = 0; i < n_tests; ++i) {
-		Duple test (double_random() * rough_size, double_random() * rough_size);
+		vector<Item const *> items;
+		canvas.root ()->add_items_at_point (Duple (double_random () * width, double_random () * height), items);
+		found += items.size ();
+	}
+	cout << "\t" << elapsed (start);
 
-		/* ask the group what's at this point */
+	/* like dragging notes around: move one, then look up */
+	start = g_get_monotonic_time ();
+	for (int i = 0; i < n_tests; ++i) {
+		rectangles[rand () % n_items]->set_position (Duple (double_random () * 100, double_random () * 100));
 		vector<Item const *> items;
-		canvas.root()->add_items_at_point (test, items);
+		canvas.root ()->add_items_at_point (Duple (double_random () * width, double_random () * height), items);
+		found += items.size ();
 	}
+	cout << "\t" << elapsed (start);
+
+	/* print the number of items found to check that both agree */
+	cout << "\t(" << found << ")\n";
 }
 
-int main ()
+int main (int argc, char* argv[])
 {
-	int tests[] = { 1, 2, 4, 8, 16, 32, 64, 128, 256 };
-
-	for (unsigned int i = 0; i < sizeof (tests) / sizeof (int); ++i) {
-		int64_t start, stop;
-
-		start = g_get_monotonic_time ();
-		test (tests[i]);
-		stop = g_get_monotonic_time ();
+	Gtk::Main kit (argc, argv);
 
-		double seconds = (start - stop) / 1e6;
+	cout << "items\ttable\tbuild\tlookup\tmove+lookup [ms]\n";
 
-		cout << "Test " << tests[i] << ": " << seconds << "\n";
+	for (int n : { 10000, 100000 }) {
+		test (n, false);
+		test (n, true);
 	}
-}
 
+	return 0;
+}
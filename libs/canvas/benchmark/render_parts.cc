@@ -1,58 +1,72 @@
-#include <sys/time.h>
-#include <pangomm/init.h>
-#include "pbd/compose.h"
-#include "pbd/xml++.h"
-#include "canvas/group.h"
+#include <cstdlib>
+#include <iostream>
+#include <ytkmm/ytkmm.h>
+#include <cairomm/context.h>
+#include <cairomm/surface.h>
+
 #include "canvas/canvas.h"
-#include "canvas/root_group.h"
+#include "canvas/container.h"
 #include "canvas/rectangle.h"
-#include "benchmark.h"
 
 using namespace std;
 using namespace ArdourCanvas;
 
-class RenderParts : public Benchmark
+/* Compare rendering a canvas in small parts, as happens when a canvas
+ * is scrolled or partially redrawn, with and without a spatial index of
+ * the children of a container holding many note-like rectangles.
+ *
+ * usage: render_parts
+ */
+
+static double
+double_random ()
 {
-public:
-	RenderParts (string const & session) : Benchmark (session) {}
+	return ((double) rand() / RAND_MAX);
+}
 
-	void set_items_per_cell (int items)
-	{
-		_items_per_cell = items;
-	}
+static double
+test (int n_items, bool indexed)
+{
+	double const width = 10000;
+	double const height = 1024;
+	srand (1);
 
-	void do_run (ImageCanvas& canvas)
-	{
-		Group::default_items_per_cell = _items_per_cell;
+	GtkCanvas canvas;
+	Container* container = new Container (canvas.root ());
+	container->set_indexed_children (indexed);
 
-		for (int i = 0; i < 1e4; i += 50) {
-			canvas.render_to_image (Rect (i, 0, i + 50, 1024));
-		}
+	for (int i = 0; i < n_items; ++i) {
+		double const x = double_random () * width;
+		double const y = double_random () * height;
+		new Rectangle (container, Rect (x, y, x + 10 + double_random () * 100, y + 8));
 	}
 
-private:
-	int _items_per_cell;
-};
+	Cairo::RefPtr<Cairo::ImageSurface> surface = Cairo::ImageSurface::create (Cairo::FORMAT_ARGB32, 50, height);
+	Cairo::RefPtr<Cairo::Context> context = Cairo::Context::create (surface);
 
-int main (int argc, char* argv[])
-{
-	if (argc < 2) {
-		cerr << "Syntax: render_parts <session>\n";
-		exit (EXIT_FAILURE);
+	int64_t const start = g_get_monotonic_time ();
+
+	for (int i = 0; i < width; i += 50) {
+		context->save ();
+		context->translate (-i, 0);
+		canvas.render (Rect (i, 0, i + 50, height), context);
+		context->restore ();
 	}
 
-	Pango::init ();
+	return (g_get_monotonic_time () - start) / 1e3;
+}
 
-	RenderParts render_parts (argv[1]);
+int main (int argc, char* argv[])
+{
+	Gtk::Main kit (argc, argv);
 
-	int tests[] = { 16, 32, 64, 128, 256, 512, 1024, 1e4, 1e5, 1e6 };
+	cout << "items\tdumb\tindexed [ms]\n";
 
-	for (unsigned int i = 0; i < sizeof (tests) / sizeof (int); ++i) {
-		render_parts.set_items_per_cell (tests[i]);
-		cout << tests[i] << " " << render_parts.run () << "\n";
+	for (int n : { 10000, 100000 }) {
+		double const dumb = test (n, false);
+		double const indexed = test (n, true);
+		cout << n << "\t" << dumb << "\t" << indexed << "\n";
 	}
 
 	return 0;
 }
-
-
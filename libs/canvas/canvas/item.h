@@ -239,6 +239,13 @@ public:
 	void lower_child_to_bottom (Item *);
 	virtual void child_changed (bool bbox_changed);
 
+	/** Keep our children in a spatial index, which is updated as children
+	 *  move or change size, rather than rebuilt. Worthwhile for items with
+	 *  many (thousands of) children.
+	 */
+	void set_indexed_children (bool);
+	bool indexed_children () const { return _indexed_children; }
+
 	PackOptions pack_options () const { return _pack_options; }
 	void set_pack_options (PackOptions);
 
@@ -351,7 +358,9 @@ public:
 	void clear_items (bool with_delete);
 
 	void ensure_lut () const;
+	void lut_child_changed (Item const *) const;
 	mutable LookupTable* _lut;
+	bool _indexed_children;
 	/* our items, from lowest to highest in the stack */
 	std::list<Item*> _items;
 
@@ -20,6 +20,7 @@
 #ifndef __CANVAS_LOOKUP_TABLE_H__
 #define __CANVAS_LOOKUP_TABLE_H__
 
+#include <unordered_map>
 #include <vector>
 #include <boost/multi_array.hpp>
 
@@ -42,6 +43,14 @@ public:
     virtual std::vector<Item*> items_at_point (Duple const &) const = 0;
     virtual bool has_item_at_point (Duple const & point) const = 0;
 
+    /* Notifications of changes to our item's children. Tables which can
+     * update themselves return true, otherwise the table is discarded
+     * and rebuilt when it is next needed.
+     */
+    virtual bool child_added (Item*, bool /*front*/) { return false; }
+    virtual bool child_removed (Item*) { return false; }
+    virtual bool child_changed (Item const *) { return false; }
+
 protected:
 
     Item const & _item;
@@ -84,6 +93,55 @@ public:
     bool _added;
 };
 
+/** A lookup table which keeps the bounding boxes of its item's children
+ *  in a sparse, uniform grid. Moving, resizing, adding or removing a
+ *  child only updates the cells of that child, rather than rebuilding
+ *  the whole table.
+ */
+class LIBCANVAS_API GridLookupTable : public LookupTable
+{
+public:
+	GridLookupTable (Item const &);
+
+	std::vector<Item*> get (Rect const &);
+	std::vector<Item*> items_at_point (Duple const &) const;
+	bool has_item_at_point (Duple const & point) const;
+
+	bool child_added (Item*, bool front);
+	bool child_removed (Item*);
+	bool child_changed (Item const *);
+
+private:
+	struct Entry {
+		Entry () : item (0), order (0), large (false), stale (false) {}
+
+		Item*   item;
+		Rect    rect;   ///< bounding box in our item's coordinates, empty if not indexed
+		int64_t order;  ///< position in our item's stack of children
+		bool    large;  ///< too large for the grid, kept in _large
+		bool    stale;  ///< rect needs to be updated
+	};
+
+	typedef std::vector<Entry*> Cell;
+
+	void refresh () const;
+	void insert (Entry&) const;
+	void erase (Entry&) const;
+	void candidates (Rect const &, std::vector<Entry*>&) const;
+	bool cell_range (Rect const &, int64_t&, int64_t&, int64_t&, int64_t&) const;
+
+	static int64_t cell_key (int64_t x, int64_t y) { return (int64_t) (((uint64_t) x << 32) ^ ((uint64_t) y & 0xffffffff)); }
+
+	double _cell_size;
+	int64_t _front;
+	int64_t _back;
+
+	mutable std::unordered_map<Item const *, Entry> _entries;
+	mutable std::unordered_map<int64_t, Cell>        _cells;
+	mutable std::vector<Entry*>                      _large;
+	mutable std::vector<Entry*>                      _stale;
+};
+
 }
 
 #endif
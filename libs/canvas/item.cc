@@ -45,6 +45,7 @@ Item::Item (Canvas* canvas)
 	, _pack_options (PackOptions (0))
 	, _layout_sensitive (false)
 	, _lut (0)
+	, _indexed_children (false)
 	, _resize_queued (false)
 	, _requested_width (-1)
 	, _requested_height (-1)
@@ -66,6 +67,7 @@ Item::Item (Item* parent)
 	, _pack_options (PackOptions (0))
 	, _layout_sensitive (false)
 	, _lut (0)
+	, _indexed_children (false)
 	, _resize_queued (false)
 	, _requested_width (-1)
 	, _requested_height (-1)
@@ -94,6 +96,7 @@ Item::Item (Item* parent, Duple const& p)
 	, _pack_options (PackOptions (0))
 	, _layout_sensitive (false)
 	, _lut (0)
+	, _indexed_children (false)
 	, _resize_queued (false)
 	, _requested_width (-1.)
 	, _requested_height(-1.)
@@ -293,6 +296,10 @@ Item::set_position (Duple p)
 
 	_position = p;
 
+	if (_parent) {
+		_parent->lut_child_changed (this);
+	}
+
 	/* only update canvas and parent if visible. Otherwise, this
 	   will be done when ::show() is called.
 	*/
@@ -411,6 +418,7 @@ Item::propagate_show_hide ()
 	/* bounding box may have changed while we were hidden */
 
 	if (_parent) {
+		_parent->lut_child_changed (this);
 		_parent->child_changed (true);
 	}
 
@@ -617,6 +625,9 @@ Item::_size_allocate (Rect const & r)
 	if (_layout_sensitive) {
 		/* this definitely affects the item */
 		_position = Duple (r.x0, r.y0);
+		if (_parent) {
+			_parent->lut_child_changed (this);
+		}
 		/* this may have no effect on the item */
 		_allocation = r;
 	}
@@ -769,6 +780,7 @@ Item::end_change ()
 		_canvas->item_changed (this, _pre_change_bounding_box);
 
 		if (_parent) {
+			_parent->lut_child_changed (this);
 			_parent->child_changed (_pre_change_bounding_box != _bounding_box);
 		}
 	}
@@ -1063,7 +1075,9 @@ Item::add (Item* i)
 
 	_items.push_back (i);
 	i->reparent (this, true);
-	invalidate_lut ();
+	if (!_lut || !_lut->child_added (i, false)) {
+		invalidate_lut ();
+	}
 	set_bbox_dirty ();
 }
 
@@ -1074,7 +1088,9 @@ Item::add_front (Item* i)
 
 	_items.push_front (i);
 	i->reparent (this, true);
-	invalidate_lut ();
+	if (!_lut || !_lut->child_added (i, true)) {
+		invalidate_lut ();
+	}
 	set_bbox_dirty();
 }
 
@@ -1101,7 +1117,9 @@ Item::remove (Item* i)
 	i->unparent ();
 	i->set_layout_sensitive (false);
 	_items.remove (i);
-	invalidate_lut ();
+	if (!_lut || !_lut->child_removed (i)) {
+		invalidate_lut ();
+	}
 	set_bbox_dirty ();
 
 	end_change ();
@@ -1157,7 +1175,9 @@ Item::raise_child_to_top (Item* i)
 	_items.remove (i);
 	_items.push_back (i);
 
-	invalidate_lut ();
+	if (!_lut || !_lut->child_removed (i) || !_lut->child_added (i, false)) {
+		invalidate_lut ();
+	}
         redraw ();
 }
 
@@ -1190,7 +1210,9 @@ Item::lower_child_to_bottom (Item* i)
 	}
 	_items.remove (i);
 	_items.push_front (i);
-	invalidate_lut ();
+	if (!_lut || !_lut->child_removed (i) || !_lut->child_added (i, true)) {
+		invalidate_lut ();
+	}
         redraw ();
 }
 
@@ -1198,7 +1220,11 @@ void
 Item::ensure_lut () const
 {
 	if (!_lut) {
-		_lut = new DumbLookupTable (*this);
+		if (_indexed_children) {
+			_lut = new GridLookupTable (*this);
+		} else {
+			_lut = new DumbLookupTable (*this);
+		}
 	}
 }
 
@@ -1209,16 +1235,40 @@ Item::invalidate_lut () const
 	_lut = 0;
 }
 
+/** Tell our lookup table that the geometry of one of our children changed */
 void
-Item::child_changed (bool bbox_changed)
+Item::lut_child_changed (Item const * child) const
 {
+	if (_lut && !_lut->child_changed (child)) {
+		invalidate_lut ();
+	}
+}
+
+void
+Item::set_indexed_children (bool yn)
+{
+	if (yn == _indexed_children) {
+		return;
+	}
+
+	_indexed_children = yn;
 	invalidate_lut ();
+}
+
+void
+Item::child_changed (bool bbox_changed)
+{
+	/* an index is kept up to date by lut_child_changed() */
+	if (!_indexed_children) {
+		invalidate_lut ();
+	}
 
 	if (bbox_changed) {
 		set_bbox_dirty ();
 	}
 
 	if (!change_blocked && _parent) {
+		_parent->lut_child_changed (this);
 		_parent->child_changed (bbox_changed);
 	}
 }
@@ -1351,6 +1401,9 @@ void
 Item::set_bbox_dirty () const
 {
 	_bounding_box_dirty = true;
+	if (_parent) {
+		_parent->lut_child_changed (this);
+	}
 	Item* i = _parent;
 	while (i) {
 		i->set_bbox_dirty ();
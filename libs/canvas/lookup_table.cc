@@ -18,6 +18,9 @@
  * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
  */
 
+#include <algorithm>
+#include <cmath>
+
 #include "canvas/item.h"
 #include "canvas/lookup_table.h"
 
@@ -321,3 +324,301 @@ OptimizingLookupTable::get (Rect const & area)
 	return vitems;
 }
 
+
+/* ****************************************************************************/
+
+/** children covering more cells than this are not kept in the grid */
+static const int64_t max_cells_per_child = 16;
+
+/** cell indices beyond this are not kept in the grid (far away, or huge children) */
+static const double max_cell_index = 1 << 30;
+
+GridLookupTable::GridLookupTable (Item const & item)
+	: LookupTable (item)
+	, _cell_size (1)
+	, _front (0)
+	, _back (0)
+{
+	/* size the cells to hold about a couple of typical children each */
+
+	Distance w = 0;
+	Distance h = 0;
+	int      n = 0;
+
+	for (auto const & i : _item.items ()) {
+		Entry& e = _entries[i];
+		e.item   = i;
+		e.order  = _back++;
+
+		Rect const bbox = i->bounding_box ();
+
+		if (bbox) {
+			e.rect = i->item_to_parent (bbox);
+			/* ignore children with "infinite" extent */
+			if (e.rect.width () < 1e5 && e.rect.height () < 1e5) {
+				w += e.rect.width ();
+				h += e.rect.height ();
+				++n;
+			}
+		}
+	}
+
+	if (n > 0) {
+		_cell_size = max (8.0, 2 * max (w, h) / n);
+	} else {
+		_cell_size = 64;
+	}
+
+	_cells.reserve (_entries.size ());
+
+	for (auto & e : _entries) {
+		insert (e.second);
+	}
+}
+
+bool
+GridLookupTable::cell_range (Rect const & r, int64_t& x0, int64_t& y0, int64_t& x1, int64_t& y1) const
+{
+	double const fx0 = floor (r.x0 / _cell_size);
+	double const fy0 = floor (r.y0 / _cell_size);
+	double const fx1 = floor (r.x1 / _cell_size);
+	double const fy1 = floor (r.y1 / _cell_size);
+
+	if (fabs (fx0) > max_cell_index || fabs (fy0) > max_cell_index || fabs (fx1) > max_cell_index || fabs (fy1) > max_cell_index) {
+		return false;
+	}
+
+	x0 = fx0;
+	y0 = fy0;
+	x1 = fx1;
+	y1 = fy1;
+
+	return true;
+}
+
+void
+GridLookupTable::insert (Entry& e) const
+{
+	if (!e.rect) {
+		return;
+	}
+
+	int64_t x0, y0, x1, y1;
+
+	if (!cell_range (e.rect, x0, y0, x1, y1) || (x1 - x0 + 1) * (y1 - y0 + 1) > max_cells_per_child) {
+		e.large = true;
+		_large.push_back (&e);
+		return;
+	}
+
+	for (int64_t x = x0; x <= x1; ++x) {
+		for (int64_t y = y0; y <= y1; ++y) {
+			_cells[cell_key (x, y)].push_back (&e);
+		}
+	}
+}
+
+void
+GridLookupTable::erase (Entry& e) const
+{
+	if (e.large) {
+		_large.erase (std::find (_large.begin (), _large.end (), &e));
+		e.large = false;
+		return;
+	}
+
+	if (!e.rect) {
+		return;
+	}
+
+	int64_t x0, y0, x1, y1;
+	cell_range (e.rect, x0, y0, x1, y1);
+
+	for (int64_t x = x0; x <= x1; ++x) {
+		for (int64_t y = y0; y <= y1; ++y) {
+			auto c = _cells.find (cell_key (x, y));
+			if (c == _cells.end ()) {
+				continue;
+			}
+			Cell::iterator i = std::find (c->second.begin (), c->second.end (), &e);
+			if (i != c->second.end ()) {
+				*i = c->second.back ();
+				c->second.pop_back ();
+			}
+			if (c->second.empty ()) {
+				_cells.erase (c);
+			}
+		}
+	}
+}
+
+void
+GridLookupTable::refresh () const
+{
+	for (auto & e : _stale) {
+		erase (*e);
+
+		Rect const bbox = e->item->bounding_box ();
+		e->rect  = bbox ? e->item->item_to_parent (bbox) : Rect ();
+		e->stale = false;
+
+		insert (*e);
+	}
+
+	_stale.clear ();
+}
+
+/** @param area Area in our item's coordinates
+ *  @param entries filled with the entries which may intersect area,
+ *  in stacking order.
+ */
+void
+GridLookupTable::candidates (Rect const & area, vector<Entry*>& entries) const
+{
+	refresh ();
+
+	int64_t x0, y0, x1, y1;
+
+	if (!cell_range (area, x0, y0, x1, y1) || (double) (x1 - x0 + 1) * (y1 - y0 + 1) > _cells.size ()) {
+		/* the area covers more cells than there are in use */
+		for (auto const & c : _cells) {
+			for (auto const & e : c.second) {
+				if (e->rect.intersection (area)) {
+					entries.push_back (e);
+				}
+			}
+		}
+	} else {
+		for (int64_t x = x0; x <= x1; ++x) {
+			for (int64_t y = y0; y <= y1; ++y) {
+				auto c = _cells.find (cell_key (x, y));
+				if (c != _cells.end ()) {
+					entries.insert (entries.end (), c->second.begin (), c->second.end ());
+				}
+			}
+		}
+	}
+
+	entries.insert (entries.end (), _large.begin (), _large.end ());
+
+	/* children may be in more than one cell */
+	std::sort (entries.begin (), entries.end (), [] (Entry const * a, Entry const * b) { return a->order < b->order; });
+	entries.erase (std::unique (entries.begin (), entries.end ()), entries.end ());
+}
+
+vector<Item*>
+GridLookupTable::get (Rect const & area)
+{
+	/* area is in window coordinates, allow for rounding in item_to_window() */
+	vector<Entry*> entries;
+	candidates (_item.window_to_item (area).expand (2), entries);
+
+	vector<Item*> vitems;
+
+	for (auto const & e : entries) {
+		Rect item_bbox = e->item->bounding_box ();
+		if (!item_bbox) continue;
+		Rect item_rect = e->item->item_to_window (item_bbox);
+		if (item_rect.intersection (area)) {
+			vitems.push_back (e->item);
+		}
+	}
+
+	return vitems;
+}
+
+vector<Item*>
+GridLookupTable::items_at_point (Duple const & point) const
+{
+	/* Point is in window coordinate system */
+
+	Duple const p = _item.window_to_item (point);
+	vector<Entry*> entries;
+	candidates (Rect (p.x, p.y, p.x, p.y).expand (2), entries);
+
+	vector<Item*> vitems;
+
+	for (auto const & e : entries) {
+		if (e->item->covers (point)) {
+			vitems.push_back (e->item);
+		}
+	}
+
+	return vitems;
+}
+
+bool
+GridLookupTable::has_item_at_point (Duple const & point) const
+{
+	/* Point is in window coordinate system */
+
+	Duple const p = _item.window_to_item (point);
+	vector<Entry*> entries;
+	candidates (Rect (p.x, p.y, p.x, p.y).expand (2), entries);
+
+	for (auto const & e : entries) {
+		if (e->item->visible () && e->item->covers (point)) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+bool
+GridLookupTable::child_added (Item* i, bool front)
+{
+	if (_entries.find (i) != _entries.end ()) {
+		return false;
+	}
+
+	Entry& e = _entries[i];
+	e.item   = i;
+	e.order  = front ? --_front : _back++;
+
+	/* compute the bounding box when it is needed */
+	e.stale = true;
+	_stale.push_back (&e);
+
+	return true;
+}
+
+bool
+GridLookupTable::child_removed (Item* i)
+{
+	/* do not call any methods of the item, it may be in the middle of
+	 * deletion (see Item::remove())
+	 */
+	auto e = _entries.find (i);
+
+	if (e == _entries.end ()) {
+		return true;
+	}
+
+	if (e->second.stale) {
+		_stale.erase (std::find (_stale.begin (), _stale.end (), &e->second));
+	}
+
+	erase (e->second);
+	_entries.erase (e);
+
+	return true;
+}
+
+bool
+GridLookupTable::child_changed (Item const * i)
+{
+	auto e = _entries.find (i);
+
+	/* not (yet) one of our children, see Item::add() */
+	if (e == _entries.end ()) {
+		return true;
+	}
+
+	if (!e->second.stale) {
+		e->second.stale = true;
+		_stale.push_back (&e->second);
+	}
+
+	return true;
+}
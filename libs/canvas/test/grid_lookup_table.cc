@@ -0,0 +1,226 @@
+#include <algorithm>
+#include <cstdlib>
+#include <vector>
+
+#include "canvas/canvas.h"
+#include "canvas/container.h"
+#include "canvas/lookup_table.h"
+#include "canvas/rectangle.h"
+#include "grid_lookup_table.h"
+
+using namespace std;
+using namespace ArdourCanvas;
+
+CPPUNIT_TEST_SUITE_REGISTRATION (GridLookupTableTest);
+
+namespace {
+
+/** A canvas that is never shown */
+class TestCanvas : public Canvas
+{
+public:
+	void request_redraw (Rect const &) {}
+	void request_size (Duple) {}
+	void grab (Item *) {}
+	void ungrab () {}
+	void queue_resize () {}
+	void focus (Item *) {}
+	void unfocus (Item*) {}
+	Rect visible_area () const { return Rect (0, 0, 4096, 4096); }
+	Coord width () const { return 4096; }
+	Coord height () const { return 4096; }
+	bool get_mouse_position (Duple&) const { return false; }
+	void re_enter () {}
+	Glib::RefPtr<Pango::Context> get_pango_context () { return Glib::RefPtr<Pango::Context> (); }
+	void pick_current_item (int) {}
+	void pick_current_item (Duple const &, int) {}
+};
+
+double
+double_random ()
+{
+	return ((double) rand () / RAND_MAX);
+}
+
+/** note-like rectangles, some of them on or close to integer coordinates */
+void
+populate (Container* c, vector<Rectangle*>& rects, int n, double size)
+{
+	for (int i = 0; i < n; ++i) {
+		double x = double_random () * size;
+		double y = double_random () * size;
+		if (i % 3 == 0) {
+			x = (int) x;
+			y = (int) y;
+		}
+		rects.push_back (new Rectangle (c, Rect (x, y, x + 5 + double_random () * 20, y + 8)));
+	}
+	/* and a few large ones, which are not kept in the grid */
+	rects.push_back (new Rectangle (c, Rect (0, 0, size, size / 2)));
+	rects.push_back (new Rectangle (c, Rect (size / 3, 0, size / 3 + 2, size)));
+}
+
+vector<Item*>
+brute_force_at_point (Container const * c, Duple const & p)
+{
+	vector<Item*> rv;
+	for (auto const & i : c->items ()) {
+		if (i->covers (p)) {
+			rv.push_back (i);
+		}
+	}
+	return rv;
+}
+
+vector<Item*>
+brute_force_get (Container const * c, Rect const & area)
+{
+	vector<Item*> rv;
+	for (auto const & i : c->items ()) {
+		Rect const bbox = i->bounding_box ();
+		if (bbox && i->item_to_window (bbox).intersection (area)) {
+			rv.push_back (i);
+		}
+	}
+	return rv;
+}
+
+/** children found by the container's own (indexed) lookup */
+vector<Item*>
+container_at_point (Container const * c, Duple const & p)
+{
+	vector<Item const *> items;
+	c->add_items_at_point (p, items);
+
+	vector<Item*> rv;
+	for (auto const & i : items) {
+		if (i->parent () == c) {
+			rv.push_back (const_cast<Item*> (i));
+		}
+	}
+	return rv;
+}
+
+}
+
+/** Lookups at random points find the same items, in the same order, as a scan of all children */
+void
+GridLookupTableTest::items_at_point ()
+{
+	srand (1);
+
+	TestCanvas         canvas;
+	Container*         c = new Container (canvas.root ());
+	vector<Rectangle*> rects;
+
+	populate (c, rects, 2000, 1000);
+
+	GridLookupTable table (*c);
+
+	for (int i = 0; i < 5000; ++i) {
+		Duple const p (double_random () * 1100 - 50, double_random () * 1100 - 50);
+		CPPUNIT_ASSERT (table.items_at_point (p) == brute_force_at_point (c, p));
+		CPPUNIT_ASSERT_EQUAL (!brute_force_at_point (c, p).empty (), table.has_item_at_point (p));
+	}
+}
+
+/** Scan along lines in small steps, crossing many cell borders (and item
+ *  edges), including points at and just outside the edges of items.
+ */
+void
+GridLookupTableTest::cell_borders ()
+{
+	srand (2);
+
+	TestCanvas         canvas;
+	Container*         c = new Container (canvas.root ());
+	vector<Rectangle*> rects;
+
+	populate (c, rects, 500, 200);
+
+	/* items exactly at, and within the lookup fuzz of, a range of positions */
+	for (int i = 0; i < 200; i += 8) {
+		rects.push_back (new Rectangle (c, Rect (i, i, i + 8, i + 8)));
+		rects.push_back (new Rectangle (c, Rect (i + 0.5, 100, i + 1.5, 101)));
+		rects.push_back (new Rectangle (c, Rect (i - 2.5, 150, i - 2.25, 150.25)));
+	}
+
+	GridLookupTable table (*c);
+
+	for (double y = -4; y < 210; y += 3.25) {
+		for (double x = -4; x < 210; x += 0.25) {
+			Duple const p (x, y);
+			CPPUNIT_ASSERT (table.items_at_point (p) == brute_force_at_point (c, p));
+		}
+	}
+
+	for (double x = -4; x < 210; x += 0.25) {
+		for (double y : { 99.75, 100.0, 100.25, 101.0, 101.25, 149.75, 150.0, 150.25, 150.5 }) {
+			Duple const p (x, y);
+			CPPUNIT_ASSERT (table.items_at_point (p) == brute_force_at_point (c, p));
+		}
+	}
+}
+
+/** Areas of all sizes find the same items as a scan of all children */
+void
+GridLookupTableTest::get ()
+{
+	srand (3);
+
+	TestCanvas         canvas;
+	Container*         c = new Container (canvas.root ());
+	vector<Rectangle*> rects;
+
+	populate (c, rects, 2000, 1000);
+
+	GridLookupTable table (*c);
+
+	for (int i = 0; i < 1000; ++i) {
+		double const x = double_random () * 1100 - 50;
+		double const y = double_random () * 1100 - 50;
+		double const s = (i % 10 == 0) ? 2000 : double_random () * 100;
+		Rect const   area (x, y, x + s, y + s * double_random ());
+		CPPUNIT_ASSERT (table.get (area) == brute_force_get (c, area));
+	}
+}
+
+/** An indexed container keeps its table up to date when children change */
+void
+GridLookupTableTest::updates ()
+{
+	srand (4);
+
+	TestCanvas         canvas;
+	Container*         c = new Container (canvas.root ());
+	vector<Rectangle*> rects;
+
+	c->set_indexed_children (true);
+	populate (c, rects, 1000, 500);
+
+	for (int i = 0; i < 2000; ++i) {
+		Rectangle* r = rects[rand () % rects.size ()];
+
+		switch (i % 5) {
+		case 0:
+			r->set_position (Duple (double_random () * 100 - 50, double_random () * 100 - 50));
+			break;
+		case 1:
+			r->set (Rect (0, 0, 5 + double_random () * 50, 8));
+			break;
+		case 2:
+			r->raise_to_top ();
+			break;
+		case 3:
+			rects.push_back (new Rectangle (c, Rect (double_random () * 500, double_random () * 500, 510, 510)));
+			break;
+		case 4:
+			rects.erase (std::find (rects.begin (), rects.end (), r));
+			delete r;
+			break;
+		}
+
+		Duple const p (double_random () * 550 - 25, double_random () * 550 - 25);
+		CPPUNIT_ASSERT (container_at_point (c, p) == brute_force_at_point (c, p));
+	}
+}
@@ -0,0 +1,18 @@
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+class GridLookupTableTest : public CppUnit::TestFixture
+{
+	CPPUNIT_TEST_SUITE (GridLookupTableTest);
+	CPPUNIT_TEST (items_at_point);
+	CPPUNIT_TEST (cell_borders);
+	CPPUNIT_TEST (get);
+	CPPUNIT_TEST (updates);
+	CPPUNIT_TEST_SUITE_END ();
+
+public:
+	void items_at_point ();
+	void cell_borders ();
+	void get ();
+	void updates ();
+};
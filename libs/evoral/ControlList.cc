@@ -58,6 +58,8 @@ using namespace Temporal;
 
 namespace Evoral
 {
+ControlList::fill_ramp_t ControlList::_fill_ramp = &ControlList::default_fill_ramp;
+
 inline bool
 event_time_less_than (ControlEvent* a, ControlEvent* b)
 {
@@ -84,6 +86,9 @@ ControlList::ControlList (const Parameter& id, const ParameterDescriptor& desc,
 	did_write_during_pass       = false;
 	insert_position             = timepos_t::max (time_domain());
 	most_recent_insert_iterator = _events.end ();
+	_eval_domain                = time_domain ();
+	_eval_index_valid           = false;
+	_edit_count                 = 1;
 }
 
 ControlList::ControlList (const ControlList& other)
@@ -104,6 +109,9 @@ ControlList::ControlList (const ControlList& other)
 	did_write_during_pass       = false;
 	insert_position             = timepos_t::max (time_domain());
 	most_recent_insert_iterator = _events.end ();
+	_eval_domain                = time_domain ();
+	_eval_index_valid           = false;
+	_edit_count                 = 1;
 
 	// XXX copy_events() emits Dirty, but this is just assignment copy/construction
 	copy_events (other);
@@ -122,6 +130,10 @@ ControlList::ControlList (const ControlList& other, timepos_t const& start, time
 	_lookup_cache.range.second = _events.end ();
 	_search_cache.first        = _events.end ();
 	_sort_pending              = false;
+	_in_write_pass             = false;
+	_eval_domain               = time_domain ();
+	_eval_index_valid          = false;
+	_edit_count                = 1;
 
 	/* now grab the relevant points, and shift them back if necessary */
 
@@ -238,10 +250,37 @@ ControlList::maybe_signal_changed ()
 	if (_frozen) {
 		_changed_when_thawed = true;
 	} else {
+		build_eval_index ();
 		Dirty (); /* EMIT SIGNAL */
 	}
 }
 
+void
+ControlList::build_eval_index ()
+{
+	PBD::RWLock::WriterLock lm (_lock);
+
+	if (_eval_index_valid || _in_write_pass) {
+		return;
+	}
+
+	_eval_when.clear ();
+	_eval_value.clear ();
+	_eval_domain = time_domain ();
+
+	for (auto const& e : _events) {
+		if (e->when.time_domain () != _eval_domain) {
+			/* the list is being converted, or was loaded with mixed
+			 * time domains; fall back to using the event list */
+			return;
+		}
+		_eval_when.push_back (e->when.val ());
+		_eval_value.push_back (e->value);
+	}
+
+	_eval_index_valid = true;
+}
+
 void
 ControlList::clear ()
 {
@@ -548,6 +587,8 @@ ControlList::write_pass_finished (timepos_t const& /*when*/, double thinning_fac
 	}
 	new_write_pass = true;
 	_in_write_pass = false;
+
+	build_eval_index ();
 }
 
 void
@@ -561,6 +602,10 @@ ControlList::set_in_write_pass (bool yn, bool add_point, timepos_t when)
 		PBD::RWLock::WriterLock lm (_lock);
 		add_guard_point (when, timecnt_t (time_domain()));
 	}
+
+	if (!yn) {
+		build_eval_index ();
+	}
 }
 
 void
@@ -1341,6 +1386,8 @@ ControlList::mark_dirty () const
 	_lookup_cache.range.second = _events.end ();
 	_search_cache.left         = timepos_t::max (time_domain());
 	_search_cache.first        = _events.end ();
+	_eval_index_valid          = false;
+	++_edit_count;
 
 	if (_curve) {
 		_curve->mark_dirty ();
@@ -1620,6 +1667,10 @@ ControlList::multipoint_eval (timepos_t const& xtime) const
 	double    uval, lval;
 	double    fraction;
 
+	if (_eval_index_valid && xtime.time_domain () == _eval_domain) {
+		return indexed_eval (xtime.val ());
+	}
+
 	/* "Stepped" lookup (no interpolation) */
 	/* FIXME: no cache.  significant? */
 	if (_interpolation == Discrete) {
@@ -1696,6 +1747,181 @@ ControlList::multipoint_eval (timepos_t const& xtime) const
 	return (*range.first)->value;
 }
 
+/** Binary search equivalent of multipoint_eval() using the eval index */
+double
+ControlList::indexed_eval (int64_t x) const
+{
+	std::vector<int64_t>::const_iterator const b = _eval_when.begin ();
+	std::vector<int64_t>::const_iterator const e = _eval_when.end ();
+
+	if (_interpolation == Discrete) {
+		std::vector<int64_t>::const_iterator i = lower_bound (b, e, x);
+		assert (i != e);
+		if (i == b || *i == x) {
+			return _eval_value[i - b];
+		}
+		return _eval_value[i - b - 1];
+	}
+
+	pair<std::vector<int64_t>::const_iterator, std::vector<int64_t>::const_iterator> range = equal_range (b, e, x);
+
+	if (range.first != range.second) {
+		/* x is a control point in the data */
+		return _eval_value[range.first - b];
+	}
+	if (range.first == b) {
+		return _eval_value.front ();
+	}
+	if (range.second == e) {
+		return _eval_value.back ();
+	}
+
+	size_t const u        = range.second - b;
+	double const lval     = _eval_value[u - 1];
+	double const uval     = _eval_value[u];
+	double const fraction = (double)(x - _eval_when[u - 1]) / (double)(_eval_when[u] - _eval_when[u - 1]);
+
+	switch (_interpolation) {
+		case Logarithmic:
+			return interpolate_logarithmic (lval, uval, fraction, _desc.lower, _desc.upper);
+		case Exponential:
+			return interpolate_gain (lval, uval, fraction, _desc.upper);
+		case Curved:
+			/* only used x-fade curves, never direct eval */
+			assert (0);
+		default: // Linear
+			return interpolate_linear (lval, uval, fraction);
+	}
+}
+
+bool
+ControlList::unlocked_eval_block (double x0, double dx, float* vec, int32_t veclen) const
+{
+	if (!_eval_index_valid || _eval_domain != time_domain () || _interpolation == Curved || _eval_when.size () < 2) {
+		return false;
+	}
+
+	if (veclen < 1) {
+		return true;
+	}
+
+	if (dx <= 0) {
+		(*_fill_ramp) (vec, veclen, indexed_eval ((int64_t)x0), 0.f);
+		return true;
+	}
+
+	size_t const n = _eval_when.size ();
+
+	/* index of the first point after x, positions increase monotonically
+	 * so this only needs a single search.
+	 */
+	size_t u = upper_bound (_eval_when.begin (), _eval_when.end (), (int64_t)x0) - _eval_when.begin ();
+
+	int32_t i = 0;
+
+	while (i < veclen) {
+		double const rx = x0 + i * dx;
+
+		while (u < n && _eval_when[u] <= rx) {
+			++u;
+		}
+
+		/* samples [i, e) are between point u - 1 and u */
+		int32_t e = veclen;
+
+		if (u < n) {
+			double const k = ceil ((_eval_when[u] - rx) / dx);
+			if (k < veclen - i) {
+				e = i + std::max<int32_t> (1, k);
+			}
+			while (e < veclen && x0 + e * dx < _eval_when[u]) {
+				++e;
+			}
+			while (e > i + 1 && x0 + (e - 1) * dx >= _eval_when[u]) {
+				--e;
+			}
+		}
+
+		render_segment (u, rx, dx, vec + i, e - i);
+		i = e;
+	}
+
+	return true;
+}
+
+/** Fill @param vec with @param len values of the segment ending at point
+ * @param u of the eval index, starting at position @param rx.
+ */
+void
+ControlList::render_segment (size_t u, double rx, double dx, float* vec, int32_t len) const
+{
+	if (u == 0) {
+		/* before the first point */
+		(*_fill_ramp) (vec, len, _eval_value.front (), 0.f);
+		return;
+	}
+
+	size_t l = u - 1;
+
+	if (u == _eval_when.size ()) {
+		/* after the last point */
+		(*_fill_ramp) (vec, len, _eval_value.back (), 0.f);
+	} else {
+		double const before = _eval_value[l];
+		double const after  = _eval_value[u];
+		double const vdelta = after - before;
+		double const trange = (double)(_eval_when[u] - _eval_when[l]);
+		double const f0     = (rx - _eval_when[l]) / trange;
+		double const df     = dx / trange;
+
+		if (vdelta == 0.0 || _interpolation == Discrete) {
+			(*_fill_ramp) (vec, len, before, 0.f);
+		} else if (_interpolation == Logarithmic && before > 0 && after > 0) {
+			/* from * (to / from) ^ fraction, non-positive values
+			 * have no log-scale position, those use linear below.
+			 */
+			double const lr = log (after / before);
+			(*_fill_ramp) (vec, len, f0 * lr, df * lr);
+			for (int32_t i = 0; i < len; ++i) {
+				vec[i] = before * exp (vec[i]);
+			}
+		} else if (_interpolation == Exponential) {
+			/* see interpolate_gain () */
+			double const from = before + TINY_NUMBER;
+			double const to   = after + TINY_NUMBER;
+			double const up   = _desc.upper;
+			if (fabs (to - from) < TINY_NUMBER) {
+				(*_fill_ramp) (vec, len, to, 0.f);
+			} else {
+				double const g0 = gain_to_position (from * 2. / up);
+				double const g1 = gain_to_position (to * 2. / up);
+				(*_fill_ramp) (vec, len, g0 + f0 * (g1 - g0), df * (g1 - g0));
+				for (int32_t i = 0; i < len; ++i) {
+					vec[i] = position_to_gain (vec[i]) * up / 2.;
+				}
+			}
+		} else { // Linear
+			(*_fill_ramp) (vec, len, before + vdelta * f0, vdelta * df);
+		}
+	}
+
+	if (rx == _eval_when[l]) {
+		/* rx is a control point, use the first of identical points */
+		while (l > 0 && _eval_when[l - 1] == _eval_when[l]) {
+			--l;
+		}
+		vec[0] = _eval_value[l];
+	}
+}
+
+void
+ControlList::default_fill_ramp (float* vec, uint32_t len, float start, float step)
+{
+	for (uint32_t i = 0; i < len; ++i) {
+		vec[i] = start + i * step;
+	}
+}
+
 void
 ControlList::build_search_cache_if_necessary (timepos_t const& start_time) const
 {
@@ -2300,6 +2526,7 @@ ControlList::finish_domain_bounce (Temporal::DomainBounceInfo& dbi)
 			t.set_time_domain (dbi.from);
 			e->when = t;
 		}
+		mark_dirty ();
 	}
 
 	maybe_signal_changed ();
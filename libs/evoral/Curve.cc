@@ -365,18 +365,23 @@ Curve::_get_vector (Temporal::timepos_t x0, Temporal::timepos_t x1, float *vec,
 		return;
 	}
 
-	if (_dirty) {
-		solve ();
-	}
-
-	rx = lx;
-
 	double dx = 0.;
 
 	if (veclen > 1) {
 		dx = (hx - lx) / (veclen - 1);
 	}
 
+	/* walk the list's eval index once for the whole vector */
+	if (_list.unlocked_eval_block (lx, dx, vec, veclen)) {
+		return;
+	}
+
+	if (_dirty) {
+		solve ();
+	}
+
+	rx = lx;
+
 	for (i = 0; i < veclen; ++i, rx += dx) {
 		vec[i] = multipoint_eval (x0.is_beats() ? Temporal::timepos_t::from_ticks (rx) : Temporal::timepos_t::from_superclock (rx));
 	}
@@ -23,8 +23,10 @@
 #ifndef EVORAL_CONTROL_LIST_HPP
 #define EVORAL_CONTROL_LIST_HPP
 
+#include <atomic>
 #include <cassert>
 #include <list>
+#include <vector>
 #include <stdint.h>
 
 #include <boost/pool/pool.hpp>
@@ -317,6 +319,25 @@ public:
 	 */
 	double unlocked_eval (Temporal::timepos_t const & x) const;
 
+	/** Evaluate @param veclen equidistant points x0, x0 + dx, ... into @param vec
+	 * using the eval index (caller must hold the lock). This is used
+	 * for automation buffers of a whole process cycle, and walks the
+	 * control points once, rather than searching for each sample.
+	 *
+	 * @param x0 position of the first point (in the list's time domain)
+	 * @param dx distance between points
+	 * @returns false if the index cannot be used (e.g. it is not yet
+	 * built, or for Curved interpolation), and @param vec is unmodified.
+	 */
+	bool unlocked_eval_block (double x0, double dx, float* vec, int32_t veclen) const;
+
+	typedef void (*fill_ramp_t) (float* vec, uint32_t len, float start, float step);
+
+	/** Allows to use an optimized routine to render automation segments,
+	 * which sets vec[i] = start + i * step for i in [0, len).
+	 */
+	static void override_fill_ramp (fill_ramp_t func) { _fill_ramp = func; }
+
 	bool rt_safe_earliest_event_discrete_unlocked (Temporal::timepos_t const & start, Temporal::timepos_t & x, double& y, bool inclusive) const;
 	bool rt_safe_earliest_event_linear_unlocked (Temporal::timepos_t const & start, Temporal::timepos_t & x, double& y, bool inclusive, Temporal::timecnt_t min_x_delta = Temporal::timecnt_t::max()) const;
 
@@ -328,6 +349,11 @@ public:
 
 	void mark_dirty () const;
 
+	/** @return a counter that is incremented by mark_dirty(), for
+	 * caching data that is derived from the list of events.
+	 */
+	uint64_t edit_count () const { return _edit_count.load (); }
+
 	enum InterpolationStyle {
 		Discrete,
 		Linear,
@@ -384,6 +410,10 @@ public:
 
 	void build_search_cache_if_necessary (Temporal::timepos_t const & start) const;
 
+	void build_eval_index ();
+	double indexed_eval (int64_t x) const;
+	void render_segment (size_t u, double rx, double dx, float* vec, int32_t len) const;
+
 	std::shared_ptr<ControlList> cut_copy_clear (Temporal::timepos_t const &, Temporal::timepos_t const &, int op);
 	bool erase_range_internal (Temporal::timepos_t const & start, Temporal::timepos_t const & end, EventList &);
 
@@ -398,6 +428,20 @@ public:
 	mutable LookupCache   _lookup_cache;
 	mutable SearchCache   _search_cache;
 
+	/* Contiguous copy of the event list (time and value), used for binary
+	 * search and block evaluation. It is rebuilt (with the write lock held)
+	 * when the list changes, and unused while a write-pass is in progress,
+	 * or if events use different time domains.
+	 */
+	std::vector<int64_t>          _eval_when;
+	std::vector<double>           _eval_value;
+	Temporal::TimeDomain          _eval_domain;
+	mutable std::atomic<bool>     _eval_index_valid;
+	mutable std::atomic<uint64_t> _edit_count;
+
+	static void        default_fill_ramp (float* vec, uint32_t len, float start, float step);
+	static fill_ramp_t _fill_ramp;
+
 	mutable PBD::RWLock _lock;
 
 	Parameter             _parameter;
@@ -1,6 +1,7 @@
 #include "CurveTest.h"
 #include "evoral/ControlList.h"
 #include "evoral/Curve.h"
+#include <math.h>
 #include <stdlib.h>
 
 CPPUNIT_TEST_SUITE_REGISTRATION (CurveTest);
@@ -523,3 +524,102 @@ CurveTest::constrainedCubic ()
 		CPPUNIT_ASSERT_DOUBLES_EQUAL(v, g[x], 0.000008);
 	}
 }
+
+void
+CurveTest::indexedEval ()
+{
+	/* fast_simple_add () does not signal a change, so `cl` uses the
+	 * event list, while thaw () builds the eval index of `ci`.
+	 */
+	std::shared_ptr<Evoral::ControlList> cl = TestCtrlList();
+	std::shared_ptr<Evoral::ControlList> ci = TestCtrlList();
+
+	cl->create_curve ();
+	ci->create_curve ();
+
+	srand (42);
+
+	ci->freeze ();
+	samplepos_t pos = 1000;
+	for (int i = 0; i < 2000; ++i) {
+		double v = (rand () % 100) / 100.0;
+		if (i % 7 == 0) {
+			/* some repeated values */
+			v = 0.5;
+		}
+		cl->fast_simple_add (timepos_t (pos), v);
+		ci->fast_simple_add (timepos_t (pos), v);
+		if (i == 1000) {
+			/* duplicate position */
+			cl->fast_simple_add (timepos_t (pos), 1.0);
+			ci->fast_simple_add (timepos_t (pos), 1.0);
+		}
+		pos += 1 + rand () % 300;
+	}
+	ci->thaw ();
+
+	samplepos_t const end = pos + 1000;
+
+	ControlList::InterpolationStyle styles[] = { ControlList::Linear, ControlList::Discrete, ControlList::Exponential };
+
+	for (size_t s = 0; s < sizeof (styles) / sizeof (styles[0]); ++s) {
+		CPPUNIT_ASSERT (cl->set_interpolation (styles[s]));
+		CPPUNIT_ASSERT (ci->set_interpolation (styles[s]));
+
+		for (samplepos_t x = 0; x < end; x += 13) {
+			/* the lookup-cache of the event list may interpolate at a control point,
+			 * while the index returns its value, hence no exact comparison.
+			 */
+			CPPUNIT_ASSERT_DOUBLES_EQUAL (cl->unlocked_eval (timepos_t (x)), ci->unlocked_eval (timepos_t (x)), 1e-6);
+		}
+
+		float vl[1024];
+		float vi[1024];
+
+		for (samplepos_t x = 0; x < end; x += 4000) {
+			cl->curve ().get_vector (timepos_t (x), timepos_t (x + 5000), vl, 1024);
+			ci->curve ().get_vector (timepos_t (x), timepos_t (x + 5000), vi, 1024);
+			for (int i = 0; i < 1024; ++i) {
+				CPPUNIT_ASSERT_DOUBLES_EQUAL (vl[i], vi[i], 1e-6);
+			}
+		}
+
+		/* with a fresh lookup-cache, the event list must match exactly */
+		for (samplepos_t x = 0; x < end; x += 997) {
+			cl->mark_dirty ();
+			CPPUNIT_ASSERT_DOUBLES_EQUAL (cl->unlocked_eval (timepos_t (x)), ci->unlocked_eval (timepos_t (x)), 1e-9);
+		}
+
+		/* one value per sample, as used for automation buffers */
+		for (samplepos_t x = 0; x < end; x += 5000) {
+			ci->curve ().get_vector (timepos_t (x), timepos_t (x + 1023), vi, 1024);
+			for (int i = 0; i < 1024; ++i) {
+				CPPUNIT_ASSERT_DOUBLES_EQUAL (ci->unlocked_eval (timepos_t (x + i)), vi[i], 1e-5);
+			}
+		}
+	}
+
+	/* logarithmic segments with a non-positive value are linear */
+	Evoral::ParameterDescriptor desc;
+	desc.lower = 0.001;
+	desc.upper = 2.0;
+	std::shared_ptr<Evoral::ControlList> lg (new Evoral::ControlList (Evoral::Parameter (0), desc, Temporal::TimeDomainProvider (Temporal::AudioTime)));
+	lg->create_curve ();
+	CPPUNIT_ASSERT (lg->set_interpolation (ControlList::Logarithmic));
+
+	lg->freeze ();
+	lg->fast_simple_add (timepos_t (0), 1.0);
+	lg->fast_simple_add (timepos_t (1024), 0.0);
+	lg->fast_simple_add (timepos_t (2048), 1.0);
+	lg->fast_simple_add (timepos_t (3072), 2.0);
+	lg->thaw ();
+
+	float vec[4096];
+	lg->curve ().get_vector (timepos_t (0), timepos_t (4095), vec, 4096);
+	for (int i = 0; i < 2048; ++i) {
+		CPPUNIT_ASSERT_DOUBLES_EQUAL (fabs (1.0 - i / 1024.0), vec[i], 1e-5);
+	}
+	for (int i = 2048; i < 3072; ++i) {
+		CPPUNIT_ASSERT_DOUBLES_EQUAL (pow (2.0, (i - 2048) / 1024.0), vec[i], 1e-5);
+	}
+}
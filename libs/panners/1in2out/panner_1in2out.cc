@@ -168,12 +168,16 @@ Panner1in2out::distribute_one (AudioBuffer& srcbuf, BufferSet& obufs, gain_t gai
 
 		delta = -(delta / (float)(limit));
 
+		pan_t g[64];
+
 		for (n = 0; n < limit; n++) {
 			left_interp = left_interp + delta;
 			left        = left_interp + 0.9 * (left - left_interp);
-			dst[n] += src[n] * left * gain_coeff;
+			g[n] = left * gain_coeff;
 		}
 
+		mix_buffers_with_gain_vector (dst, src, g, limit);
+
 		/* then pan the rest of the buffer; no need for interpolation for this bit */
 
 		pan = left * gain_coeff;
@@ -216,12 +220,16 @@ Panner1in2out::distribute_one (AudioBuffer& srcbuf, BufferSet& obufs, gain_t gai
 
 		delta = -(delta / (float)(limit));
 
+		pan_t g[64];
+
 		for (n = 0; n < limit; n++) {
 			right_interp = right_interp + delta;
 			right        = right_interp + 0.9 * (right - right_interp);
-			dst[n] += src[n] * right * gain_coeff;
+			g[n] = right * gain_coeff;
 		}
 
+		mix_buffers_with_gain_vector (dst, src, g, limit);
+
 		/* then pan the rest of the buffer, no need for interpolation for this bit */
 
 		pan = right * gain_coeff;
@@ -304,9 +312,7 @@ Panner1in2out::distribute_one_automated (AudioBuffer& srcbuf, BufferSet& obufs,
 	dst  = obufs.get_audio (0).data ();
 	pbuf = buffers[0];
 
-	for (pframes_t n = 0; n < nframes; ++n) {
-		dst[n] += src[n] * pbuf[n];
-	}
+	mix_buffers_with_gain_vector (dst, src, pbuf, nframes);
 
 	/* XXX it would be nice to mark the buffer as written to */
 
@@ -315,9 +321,7 @@ Panner1in2out::distribute_one_automated (AudioBuffer& srcbuf, BufferSet& obufs,
 	dst  = obufs.get_audio (1).data ();
 	pbuf = buffers[1];
 
-	for (pframes_t n = 0; n < nframes; ++n) {
-		dst[n] += src[n] * pbuf[n];
-	}
+	mix_buffers_with_gain_vector (dst, src, pbuf, nframes);
 
 	/* XXX it would be nice to mark the buffer as written to */
 }
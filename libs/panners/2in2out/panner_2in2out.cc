@@ -295,12 +295,16 @@ Panner2in2out::distribute_one (AudioBuffer& srcbuf, BufferSet& obufs, gain_t gai
 
 		delta = -(delta / (float)(limit));
 
+		pan_t g[64];
+
 		for (n = 0; n < limit; n++) {
 			left_interp[which] = left_interp[which] + delta;
 			left[which]        = left_interp[which] + 0.9 * (left[which] - left_interp[which]);
-			dst[n] += src[n] * left[which] * gain_coeff;
+			g[n] = left[which] * gain_coeff;
 		}
 
+		mix_buffers_with_gain_vector (dst, src, g, limit);
+
 		/* then pan the rest of the buffer; no need for interpolation for this bit */
 
 		pan = left[which] * gain_coeff;
@@ -343,12 +347,16 @@ Panner2in2out::distribute_one (AudioBuffer& srcbuf, BufferSet& obufs, gain_t gai
 
 		delta = -(delta / (float)(limit));
 
+		pan_t g[64];
+
 		for (n = 0; n < limit; n++) {
 			right_interp[which] = right_interp[which] + delta;
 			right[which]        = right_interp[which] + 0.9 * (right[which] - right_interp[which]);
-			dst[n] += src[n] * right[which] * gain_coeff;
+			g[n] = right[which] * gain_coeff;
 		}
 
+		mix_buffers_with_gain_vector (dst, src, g, limit);
+
 		/* then pan the rest of the buffer, no need for interpolation for this bit */
 
 		pan = right[which] * gain_coeff;
@@ -449,9 +457,7 @@ Panner2in2out::distribute_one_automated (AudioBuffer& srcbuf, BufferSet& obufs,
 	dst  = obufs.get_audio (0).data ();
 	pbuf = buffers[0];
 
-	for (pframes_t n = 0; n < nframes; ++n) {
-		dst[n] += src[n] * pbuf[n];
-	}
+	mix_buffers_with_gain_vector (dst, src, pbuf, nframes);
 
 	/* XXX it would be nice to mark the buffer as written to */
 
@@ -460,9 +466,7 @@ Panner2in2out::distribute_one_automated (AudioBuffer& srcbuf, BufferSet& obufs,
 	dst  = obufs.get_audio (1).data ();
 	pbuf = buffers[1];
 
-	for (pframes_t n = 0; n < nframes; ++n) {
-		dst[n] += src[n] * pbuf[n];
-	}
+	mix_buffers_with_gain_vector (dst, src, pbuf, nframes);
 
 	/* XXX it would be nice to mark the buffer as written to */
 }
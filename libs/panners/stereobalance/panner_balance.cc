@@ -175,12 +175,16 @@ Pannerbalance::distribute_one (AudioBuffer& srcbuf, BufferSet& obufs, gain_t gai
 
 		delta = -(delta / (float)(limit));
 
+		pan_t g[64];
+
 		for (n = 0; n < limit; n++) {
 			pos_interp[which] = pos_interp[which] + delta;
 			pos[which]        = pos_interp[which] + 0.9 * (pos[which] - pos_interp[which]);
-			dst[n] += src[n] * pos[which] * gain_coeff;
+			g[n] = pos[which] * gain_coeff;
 		}
 
+		mix_buffers_with_gain_vector (dst, src, g, limit);
+
 		/* then pan the rest of the buffer; no need for interpolation for this bit */
 
 		pan = pos[which] * gain_coeff;
@@ -248,9 +252,7 @@ Pannerbalance::distribute_one_automated (AudioBuffer& srcbuf, BufferSet& obufs,
 	dst  = obufs.get_audio (which).data ();
 	pbuf = buffers[which];
 
-	for (pframes_t n = 0; n < nframes; ++n) {
-		dst[n] += src[n] * pbuf[n];
-	}
+	mix_buffers_with_gain_vector (dst, src, pbuf, nframes);
 
 	/* XXX it would be nice to mark the buffer as written to */
 }
@@ -123,12 +123,15 @@ public:
 	{
 		std::unique_lock m (mutex._mutex, std::adopt_lock);
 		_cond.wait (m);
+		m.release (); /* the caller still owns the lock */
 	}
 
 	bool wait_for (Mutex& mutex, std::chrono::milliseconds const& rel_time)
 	{
 		std::unique_lock m (mutex._mutex, std::adopt_lock);
-		return std::cv_status::no_timeout == _cond.wait_for (m, rel_time);
+		bool rv = std::cv_status::no_timeout == _cond.wait_for (m, rel_time);
+		m.release (); /* the caller still owns the lock */
+		return rv;
 	}
 
 private:
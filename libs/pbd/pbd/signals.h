@@ -23,8 +23,11 @@
 
 #include <csignal>
 
+#include <algorithm>
 #include <list>
 #include <map>
+#include <memory>
+#include <vector>
 
 #ifdef nil
 #undef nil
@@ -128,12 +131,80 @@ public:
 
 private:
 
-	/** The slots that this signal will call on emission */
-	typedef std::map<std::shared_ptr<Connection>, slot_function_type> Slots;
+	/** A connected slot. Once disconnected, it is marked dead, and
+	 * the functor is released as soon as no emission is calling it.
+	 */
+	struct SlotRecord {
+		SlotRecord (slot_function_type const& f)
+			: functor (f)
+			, alive (true)
+			, calls (0)
+		{}
+
+		slot_function_type functor;
+		std::atomic<bool>  alive;
+		std::atomic<int>   calls; ///< emissions that may be calling the functor
+	};
+
+	typedef std::shared_ptr<SlotRecord> SlotRecordPtr;
+
+	/** Slots in the order in which they were connected. Connecting
+	 * appends to the list in place while there is room. Emission only
+	 * looks at the first @a size entries, which are never modified.
+	 */
+	struct SlotList {
+		SlotList (size_t c)
+			: records (new SlotRecordPtr[c])
+			, capacity (c)
+			, size (0)
+		{}
+
+		std::unique_ptr<SlotRecordPtr[]> records;
+		size_t const                     capacity;
+		std::atomic<size_t>              size;
+	};
+
+	typedef std::shared_ptr<SlotList> SlotListPtr;
+
+	/** The slots that this signal will call on emission (protected by _mutex) */
+	typedef std::map<std::shared_ptr<Connection>, SlotRecordPtr> Slots;
 	Slots _slots;
 
+	/** The slot list used by emissions, read without locking (RCU).
+	 * It may contain slots that have since been disconnected, those
+	 * are skipped.
+	 */
+	std::atomic<SlotListPtr*> _slot_list;
+	mutable std::atomic<int>  _active_reads;
+
+	/* Everything below is protected by _mutex. Memory is only
+	 * released when slots are connected or disconnected, never
+	 * by an emission.
+	 */
+
+	/** Replaced lists, readers may still be copying the pointer */
+	std::vector<SlotListPtr*> _retired_lists;
+	/** Replaced lists that emissions are still iterating over */
+	std::vector<SlotListPtr> _dead_lists;
+	/** Disconnected slots that emissions may still be calling */
+	std::vector<SlotRecordPtr> _dead_slots;
+	/** Disconnected slots in the current list */
+	size_t _n_dead;
+
+	SlotListPtr read_slot_list () const;
+	void        add_slot (SlotRecordPtr const&);
+	void        remove_slot (SlotRecordPtr const&);
+	void        publish_slot_list (size_t capacity);
+	void        reclaim ();
+
 public:
 
+	SignalWithCombiner ()
+		: _slot_list (0)
+		, _active_reads (0)
+		, _n_dead (0)
+	{}
+
 	static void compositor (typename std::function<void(A...)> f,
 	                        EventLoop* event_loop,
 	                        EventLoop::InvalidationRecord* ir, A... a);
@@ -329,6 +400,149 @@ SignalWithCombiner<Combiner, R(A...)>::~SignalWithCombiner ()
 	for (typename Slots::const_iterator i = _slots.begin(); i != _slots.end(); ++i) {
 		i->first->signal_going_away ();
 	}
+	delete _slot_list.load ();
+	for (auto const & sl : _retired_lists) {
+		delete sl;
+	}
+}
+
+/** Lock-free: obtain a reference to the current slot list.
+ * The reader only needs to be protected while copying the shared_ptr,
+ * not for the duration of the emission.
+ */
+template <typename Combiner, typename R, typename... A>
+typename SignalWithCombiner<Combiner, R(A...)>::SlotListPtr
+SignalWithCombiner<Combiner, R(A...)>::read_slot_list () const
+{
+	SlotListPtr rv;
+	/* sequentially consistent, pairs with reclaim () */
+	_active_reads.fetch_add (1);
+	SlotListPtr* sl = _slot_list.load ();
+	if (sl) {
+		rv = *sl;
+	}
+	_active_reads.fetch_sub (1);
+	return rv;
+}
+
+/** Append a slot to the current list, or publish a larger list
+ * if it is full. Amortized O(1). Must be called with _mutex held.
+ */
+template <typename Combiner, typename R, typename... A>
+void
+SignalWithCombiner<Combiner, R(A...)>::add_slot (SlotRecordPtr const& rec)
+{
+	SlotListPtr* box = _slot_list.load ();
+
+	if (!box || (*box)->size.load (std::memory_order_relaxed) == (*box)->capacity) {
+		publish_slot_list (std::max<size_t> (8, 2 * _slots.size ()));
+		box = _slot_list.load ();
+	} else {
+		reclaim ();
+	}
+
+	SlotList& sl (**box);
+	size_t const n = sl.size.load (std::memory_order_relaxed);
+	sl.records[n] = rec;
+	sl.size.store (n + 1, std::memory_order_release);
+}
+
+/** Mark a slot as disconnected. The functor (and any object bound
+ * to it) is released right away, unless an emission is calling it.
+ * Must be called with _mutex held.
+ */
+template <typename Combiner, typename R, typename... A>
+void
+SignalWithCombiner<Combiner, R(A...)>::remove_slot (SlotRecordPtr const& rec)
+{
+	/* sequentially consistent, pairs with emission */
+	rec->alive.store (false);
+
+	if (rec->calls.load () == 0) {
+		rec->functor = slot_function_type ();
+	} else {
+		_dead_slots.push_back (rec);
+	}
+
+	SlotList const& sl (**_slot_list.load ());
+
+	/* compact the list once most of it is disconnected slots */
+	if (++_n_dead > 8 && 2 * _n_dead > sl.size.load (std::memory_order_relaxed)) {
+		publish_slot_list (std::max<size_t> (8, 2 * _slots.size ()));
+	} else {
+		reclaim ();
+	}
+}
+
+/** Publish a new slot list with the given capacity, containing all
+ * connected slots. Must be called with _mutex held.
+ */
+template <typename Combiner, typename R, typename... A>
+void
+SignalWithCombiner<Combiner, R(A...)>::publish_slot_list (size_t capacity)
+{
+	SlotListPtr  sl (new SlotList (capacity));
+	SlotListPtr* old_sl = _slot_list.load ();
+
+	if (old_sl) {
+		SlotList const& o (**old_sl);
+		size_t const    n = o.size.load (std::memory_order_relaxed);
+		size_t          k = 0;
+		for (size_t i = 0; i < n; ++i) {
+			if (o.records[i]->alive.load (std::memory_order_relaxed)) {
+				sl->records[k++] = o.records[i];
+			}
+		}
+		sl->size.store (k, std::memory_order_relaxed);
+	}
+
+	_n_dead = 0;
+	_slot_list.store (new SlotListPtr (sl));
+
+	if (old_sl) {
+		_retired_lists.push_back (old_sl);
+	}
+
+	reclaim ();
+}
+
+/** Release memory that emissions no longer reference. This never
+ * waits for readers, anything still in use is kept for next time.
+ * Must be called with _mutex held.
+ */
+template <typename Combiner, typename R, typename... A>
+void
+SignalWithCombiner<Combiner, R(A...)>::reclaim ()
+{
+	/* Once no reader is in read_slot_list (), no reader can
+	 * be copying from a list that is no longer published. */
+	if (!_retired_lists.empty () && _active_reads.load () == 0) {
+		for (auto const & sl : _retired_lists) {
+			if (sl->use_count () > 1) {
+				/* still iterated over, but no new references can be taken */
+				_dead_lists.push_back (*sl);
+			}
+			delete sl;
+		}
+		_retired_lists.clear ();
+	}
+
+	for (typename std::vector<SlotListPtr>::iterator i = _dead_lists.begin (); i != _dead_lists.end ();) {
+		if (i->use_count () == 1) {
+			i = _dead_lists.erase (i);
+		} else {
+			++i;
+		}
+	}
+
+	for (typename std::vector<SlotRecordPtr>::iterator i = _dead_slots.begin (); i != _dead_slots.end ();) {
+		if ((*i)->calls.load () == 0) {
+			(*i)->functor = slot_function_type ();
+			i = _dead_slots.erase (i);
+		} else {
+			++i;
+		}
+	}
 }
 
 /** Arrange for @a slot to be executed whenever this signal is emitted.
@@ -439,76 +653,55 @@ SignalWithCombiner<Combiner, R(A...)>::operator() (A... a)
 	}
 #endif
 
-#ifdef _MSC_VER
-	/* Regarding the note (below) it was initially
+	/* Obtain the current list of slots, without locking. Slots that are
+	 * connected during emission will not be called, slots that are
+	 * disconnected during emission (e.g. by a signal handler) are
+	 * marked dead and skipped.
+	 *
+	 * The list is not copied, so no PBD::StackAllocator based
+	 * vector is needed here. Should one be reintroduced, note:
+	 *
+	 * Regarding the note (below) it was initially
 	 * thought that the problem got fixed in VS2015
-	 * but in fact it still persists even in VS2022 */
-
-	/* Use the older (heap based) mapping when building with MSVC.
+	 * but in fact it still persists even in VS2022
+	 *
+	 * Use the older (heap based) mapping when building with MSVC.
 	 * Our StackAllocator class depends on 'boost::aligned_storage'
 	 * which is known to be troublesome with Visual C++ :-
 	 * https://www.boost.org/doc/libs/1_65_0/libs/type_traits/doc/html/boost_typetraits/reference/aligned_storage.html
 	 */
-	std::vector<Connection*> s;
-#else
-	const std::size_t nslots = 512;
-	std::vector<Connection*,PBD::StackAllocator<Connection*,nslots> > s;
-#endif
+	SlotListPtr sl = read_slot_list ();
 
-	/* First, make a copy of the current connection state for us to iterate
-	 * over later (the connection state may be changed by a signal handler.
-	 */
+	/* Tell disconnect() that the functor may be in use, while calling it */
+	struct CallGuard {
+		CallGuard (SlotRecord& r) : rec (r) { rec.calls.fetch_add (1); }
+		~CallGuard () { rec.calls.fetch_sub (1); }
+		SlotRecord& rec;
+	};
 
-	{
-		PBD::Mutex::Lock lm (_mutex);
-		/* copy only the raw pointer, no need for a shared_ptr in this
-		 * context, we only use the address as a lookup into the _slots
-		 * container. Note: because of the use of a stack allocator,
-		 * this is *unlikely* to cause any (heap) memory
-		 * allocation. That will only happen if the number of
-		 * connections to this signal exceeds the value of nslots
-		 * defined above. As of April 2025, the maximum number of
-		 * connections appears to be ntracks+1.
-		 */
-		for (auto const & [connection,functor] : _slots) {
-			s.push_back (connection.get());
+	if constexpr (std::is_void_v<R>) {
+		if (!sl) {
+			return;
 		}
-	}
 
-	if constexpr (std::is_void_v<R>) {
-		slot_function_type functor;
+		size_t const n = sl->size.load (std::memory_order_acquire);
 
-		for (auto const & c : s) {
+		for (size_t i = 0; i < n; ++i) {
 
-			/* We may have just called a slot, and this may have
-			 * resulted in disconnection of other slots from us.
-			 * The list copy means that this won't cause any
-			 * problems with invalidated iterators, but we must
-			 * check to see if the slot we are about to call is
-			 * still on the list.
-			 */
-			bool still_there = false;
-
-			{
-				PBD::Mutex::Lock lm (_mutex);
-				typename Slots::const_iterator f = std::find_if (_slots.begin(), _slots.end(), [&](typename Slots::value_type const & elem) { return elem.first.get() == c; });
-				if (f != _slots.end()) {
-					functor = f->second;
-					still_there = true;
-				}
-			}
+			SlotRecord& rec (*sl->records[i]);
+			CallGuard   cg (rec);
 
-			if (still_there) {
+			if (rec.alive.load ()) {
 #ifdef DEBUG_PBD_SIGNAL_EMISSION
 				if (_debug_emission) {
-					std::cerr << "signal @ " << this << " calling slot for connection @ " << c << " of " << _slots.size() << std::endl;
+					std::cerr << "signal @ " << this << " calling slot @ " << &rec << " of " << n << std::endl;
 				}
 #endif
-				functor (a...);
+				rec.functor (a...);
 			} else {
 #ifdef DEBUG_PBD_SIGNAL_EMISSION
 				if (_debug_emission) {
-					std::cerr << "signal @ " << this << " connection  " << c << " of " << _slots.size() << " was no longer in the slot list\n";
+					std::cerr << "signal @ " << this << " slot  " << &rec << " of " << n << " was disconnected\n";
 				}
 #endif
 			}
@@ -522,7 +715,7 @@ SignalWithCombiner<Combiner, R(A...)>::operator() (A... a)
 		return;
 
 	} else {
-		if (s.empty()) {
+		if (!sl) {
 			return typename Combiner::result_type ();
 		}
 
@@ -547,43 +740,31 @@ SignalWithCombiner<Combiner, R(A...)>::operator() (A... a)
 		 *
 		 */
 
-		std::vector<R> r;
-		r.reserve (s.size());
-		slot_function_type functor;
+		size_t const n = sl->size.load (std::memory_order_acquire);
 
-		for (auto const & c : s) {
+		std::vector<R> r;
+		r.reserve (n);
 
-			/* We may have just called a slot, and this may have resulted in
-			 * disconnection of other slots from us.  The list copy means that
-			 * this won't cause any problems with invalidated iterators, but we
-			 * must check to see if the slot we are about to call is still on the list.
-			 */
-			bool still_there = false;
+		for (size_t i = 0; i < n; ++i) {
 
-			{
-				PBD::Mutex::Lock lm (_mutex);
-				typename Slots::const_iterator f = std::find_if (_slots.begin(), _slots.end(), [&](typename Slots::value_type const & elem) { return elem.first.get() == c; });
+			SlotRecord& rec (*sl->records[i]);
+			CallGuard   cg (rec);
 
-				if (f != _slots.end()) {
-					functor = f->second;
-					still_there = true;
-				}
-			}
-			if (still_there) {
+			if (rec.alive.load ()) {
 #ifdef DEBUG_PBD_SIGNAL_EMISSION
 				if (_debug_emission) {
-					std::cerr << "signal @ " << this << " calling non-void slot for connection @ " << c << " of " << _slots.size() << std::endl;
+					std::cerr << "signal @ " << this << " calling non-void slot @ " << &rec << " of " << n << std::endl;
 				}
 #endif
-				r.push_back (functor (a...));
+				r.push_back (rec.functor (a...));
 			}
+		}
 
 #ifdef DEBUG_PBD_SIGNAL_EMISSION
-			if (_debug_emission) {
-				std::cerr << "------ Signal @ " << this << " emission process ends\n";
-			}
-#endif
+		if (_debug_emission) {
+			std::cerr << "------ Signal @ " << this << " emission process ends\n";
 		}
+#endif
 		/* Call our combiner to do whatever is required to the result values */
 		Combiner c;
 		return c (r.begin(), r.end());
@@ -597,7 +778,9 @@ SignalWithCombiner<Combiner, R(A...)>::_connect (PBD::EventLoop::InvalidationRec
 {
 	std::shared_ptr<Connection> c (new Connection (this, ir));
 	PBD::Mutex::Lock lm (_mutex);
-	_slots[c] = f;
+	SlotRecordPtr rec (new SlotRecord (f));
+	_slots[c] = rec;
+	add_slot (rec);
 
 #ifdef DEBUG_PBD_SIGNAL_CONNECTIONS
 	if (_slots.size() > max_signal_subscribers) {
@@ -625,7 +808,13 @@ SignalWithCombiner<Combiner, R(A...)>::disconnect (std::shared_ptr<Connection> c
 		/* Spin */
 		lm.try_acquire ();
 	}
-	_slots.erase (c);
+	typename Slots::iterator i = _slots.find (c);
+	if (i != _slots.end ()) {
+		SlotRecordPtr rec (i->second);
+		_slots.erase (i);
+		/* emissions in progress must not call this slot anymore */
+		remove_slot (rec);
+	}
 	lm.release ();
 
 	c->disconnected ();
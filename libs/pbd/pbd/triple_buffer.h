@@ -0,0 +1,120 @@
+/*
+ * Copyright (C) 2026 Ardour Developers
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+namespace PBD {
+
+/** Publish a value from one (realtime) writer thread to any number of
+ * reader threads, without locks.
+ *
+ * The writer fills write_buffer() and calls publish(); it never waits
+ * and never allocates. Readers copy the most recently published value
+ * with read(). The slot being written is never the one last published,
+ * so a copy only needs to be repeated if the writer published twice
+ * while it was being made.
+ *
+ * T is copied while the writer may be modifying a different slot: it
+ * must not (re)allocate memory when written to, e.g. vectors need to
+ * have their final size before the TripleBuffer is constructed.
+ */
+template <class T>
+class /*LIBPBD_API*/ TripleBuffer
+{
+public:
+	TripleBuffer (T const& initial)
+		: _latest (0)
+		, _write (1)
+	{
+		for (int i = 0; i < 3; ++i) {
+			_slot[i] = initial;
+			_seq[i].store (0);
+		}
+	}
+
+	/** Writer: the slot to fill before calling publish() */
+	T& write_buffer ()
+	{
+		if (!(_seq[_write].load (std::memory_order_relaxed) & 1)) {
+			/* odd sequence: write in progress */
+			_seq[_write].fetch_add (1, std::memory_order_relaxed);
+			std::atomic_thread_fence (std::memory_order_release);
+		}
+		return _slot[_write];
+	}
+
+	/** Writer: make the content of write_buffer() available to readers */
+	void publish ()
+	{
+		if (!(_seq[_write].load (std::memory_order_relaxed) & 1)) {
+			/* nothing was written */
+			return;
+		}
+		_seq[_write].fetch_add (1, std::memory_order_release);
+		_latest.store (_write, std::memory_order_release);
+		_write = (_write + 1) % 3;
+	}
+
+	/** Reader: copy the most recently published value
+	 * @return the number of values published so far, 0 if none
+	 */
+	uint64_t read (T& copy) const
+	{
+		for (;;) {
+			int const      i = _latest.load (std::memory_order_acquire);
+			uint64_t const s = _seq[i].load (std::memory_order_acquire);
+
+			if (s & 1) {
+				/* overtaken by the writer, retry */
+				continue;
+			}
+
+			copy = _slot[i];
+
+			std::atomic_thread_fence (std::memory_order_acquire);
+			if (_seq[i].load (std::memory_order_relaxed) == s) {
+				return _published (s, i);
+			}
+		}
+	}
+
+private:
+	T                     _slot[3];
+	std::atomic<uint64_t> _seq[3];
+	std::atomic<int>      _latest;
+	int                   _write; // only used by the writer
+
+	/* each publish() increments the sequence of one slot by 2,
+	 * slots are used in turn */
+	uint64_t _published (uint64_t seq, int slot) const
+	{
+		uint64_t const rounds = seq / 2;
+		if (rounds == 0) {
+			return 0;
+		}
+		return (rounds - 1) * 3 + (slot == 0 ? 3 : slot);
+	}
+
+	TripleBuffer (TripleBuffer const&);
+	TripleBuffer& operator= (TripleBuffer const&);
+};
+
+} // namespace PBD
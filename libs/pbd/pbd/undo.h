@@ -22,6 +22,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <list>
 #include <map>
 #include <string>
@@ -78,10 +79,24 @@ public:
 		return _timestamp;
 	}
 
+	/** Process-wide unique identifier, new for every instance (and copy) */
+	uint64_t serial () const
+	{
+		return _serial;
+	}
+
+	/** Incremented whenever the list of commands changes */
+	uint32_t revision () const
+	{
+		return _revision;
+	}
+
 private:
 	std::list<PBD::Command*> actions;
 	Glib::DateTime          _timestamp;
 	bool                    _clearing;
+	uint64_t                _serial;
+	uint32_t                _revision;
 
 	void about_to_explicitly_delete ();
 };
@@ -136,6 +151,8 @@ public:
 	PBD::Signal<void()> EndUndoRedo;
 
 private:
+	friend class UndoJournal;
+
 	bool                        _clearing;
 	uint32_t                    _depth;
 	std::list<UndoTransaction*> UndoList;
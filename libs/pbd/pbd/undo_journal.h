@@ -0,0 +1,104 @@
+/*
+ * Copyright (C) 2026 Ardour Developers
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "pbd/libpbd_visibility.h"
+
+class XMLNode;
+
+namespace PBD {
+
+class UndoHistory;
+class UndoTransaction;
+
+/** Append-only on-disk representation of an UndoHistory.
+ *
+ * Every transaction is written to the journal once, as a separate XML
+ * record. Subsequent saves only append transactions that were added
+ * since, plus small markers for transactions that were undone or fell
+ * off the start of the history. Transactions that were modified since
+ * they were written (e.g. a command was removed) are written again,
+ * along with all that follow them. The journal is rewritten (compacted)
+ * when it is written to a different file, or when it has grown to
+ * more than twice the size of the live records.
+ *
+ * When loading, only the headers are scanned to find the records that
+ * are still live, and only those are parsed, one at a time.
+ */
+class LIBPBD_API UndoJournal
+{
+public:
+	typedef std::function<UndoTransaction* (XMLNode const&)> TransactionFactory;
+
+	UndoJournal ();
+
+	/** Write the last @p depth transactions of @p history to @p path
+	 * (all of them if @p depth is negative).
+	 * @return 0 on success
+	 */
+	int save (UndoHistory const& history, int32_t depth, std::string const& path);
+
+	/** Add all live transactions of the journal at @p path to @p history,
+	 * using @p factory to create them from their XML state.
+	 * @return 0 on success, 1 if there is no journal, -1 on error
+	 */
+	int load (std::string const& path, UndoHistory& history, TransactionFactory factory);
+
+	/** Forget about the journal's file, the next save() rewrites it */
+	void reset ();
+
+	/** Size of the journal file, in bytes */
+	int64_t file_size () const { return _file_size; }
+
+	/** Total size of all live records, in bytes */
+	int64_t live_size () const { return _live_size; }
+
+	static const char* const header;
+
+private:
+	struct Record {
+		Record (uint64_t s, uint32_t r, uint64_t j, int64_t o, int64_t l)
+			: serial (s), revision (r), journal_serial (j), offset (o), size (l) {}
+
+		uint64_t serial;         ///< UndoTransaction::serial ()
+		uint32_t revision;       ///< UndoTransaction::revision () when written
+		uint64_t journal_serial; ///< identifies the record in the file
+		int64_t  offset;         ///< of the XML payload
+		int64_t  size;           ///< of the XML payload
+	};
+
+	int  compact (std::vector<UndoTransaction*> const&, std::string const& path);
+	bool write_record (FILE*, UndoTransaction const&);
+
+	std::string        _path;
+	std::deque<Record> _live;
+	uint64_t           _next_serial;
+	int64_t            _file_size;
+	int64_t            _live_size;
+	bool               _dirty;
+};
+
+} /* namespace */
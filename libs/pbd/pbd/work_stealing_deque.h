@@ -0,0 +1,171 @@
+/*
+ * Copyright (C) 2026 Ardour Developers
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#ifndef _pbd_work_stealing_deque_h_
+#define _pbd_work_stealing_deque_h_
+
+#include <atomic>
+#include <cassert>
+#include <stdint.h>
+#include <stdlib.h>
+
+namespace PBD {
+
+/* Bounded lock free single producer, multiple consumer work-stealing deque.
+ *
+ * The owner thread push()es and pop()s at the bottom (LIFO), any other
+ * thread may steal() from the top (FIFO).
+ *
+ * This is the Chase-Lev deque using the memory-ordering described in
+ * "Correct and Efficient Work-Stealing for Weak Memory Models"
+ * (Lê, Pop, Cohen, Zappa Nardelli, PPoPP 2013), without dynamic
+ * growth: the buffer is only (re)allocated by reserve(), which must not be
+ * called concurrently with any other method.
+ */
+template <typename T>
+class /*LIBPBD_API*/ WorkStealingDeque
+{
+public:
+	WorkStealingDeque (size_t buffer_size = 8)
+		: _buffer (0)
+		, _buffer_mask (0)
+	{
+		_top.store (0);
+		_bottom.store (0);
+		reserve (buffer_size);
+	}
+
+	~WorkStealingDeque ()
+	{
+		delete[] _buffer;
+	}
+
+	size_t capacity () const {
+		return _buffer_mask + 1;
+	}
+
+	static size_t
+	power_of_two_size (size_t sz)
+	{
+		int32_t power_of_two;
+		for (power_of_two = 1; 1U << power_of_two < sz; ++power_of_two) ;
+		return 1U << power_of_two;
+	}
+
+	/* not thread-safe */
+	void
+	reserve (size_t buffer_size)
+	{
+		buffer_size = power_of_two_size (buffer_size);
+		assert ((buffer_size >= 2) && ((buffer_size & (buffer_size - 1)) == 0));
+		if (_buffer_mask >= buffer_size - 1) {
+			return;
+		}
+		delete[] _buffer;
+		_buffer      = new std::atomic<T>[buffer_size];
+		_buffer_mask = buffer_size - 1;
+		clear ();
+	}
+
+	/* not thread-safe */
+	void
+	clear ()
+	{
+		_top.store (0, std::memory_order_relaxed);
+		_bottom.store (0, std::memory_order_relaxed);
+	}
+
+	bool
+	empty () const
+	{
+		return _bottom.load (std::memory_order_relaxed) <= _top.load (std::memory_order_relaxed);
+	}
+
+	/** Add an element at the bottom. Must only be called by the owner.
+	 * @return false if the deque is full.
+	 */
+	bool
+	push (T const& data)
+	{
+		int64_t b = _bottom.load (std::memory_order_relaxed);
+		int64_t t = _top.load (std::memory_order_acquire);
+		if (b - t > (int64_t)_buffer_mask) {
+			return false;
+		}
+		_buffer[b & _buffer_mask].store (data, std::memory_order_relaxed);
+		std::atomic_thread_fence (std::memory_order_release);
+		_bottom.store (b + 1, std::memory_order_relaxed);
+		return true;
+	}
+
+	/** Take the most recently pushed element. Must only be called by the owner. */
+	bool
+	pop (T& data)
+	{
+		int64_t b = _bottom.load (std::memory_order_relaxed) - 1;
+		_bottom.store (b, std::memory_order_relaxed);
+		std::atomic_thread_fence (std::memory_order_seq_cst);
+		int64_t t = _top.load (std::memory_order_relaxed);
+
+		if (t > b) {
+			/* empty */
+			_bottom.store (b + 1, std::memory_order_relaxed);
+			return false;
+		}
+
+		data = _buffer[b & _buffer_mask].load (std::memory_order_relaxed);
+
+		if (t == b) {
+			/* last element, race against thieves */
+			bool rv = _top.compare_exchange_strong (t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+			_bottom.store (b + 1, std::memory_order_relaxed);
+			return rv;
+		}
+		return true;
+	}
+
+	/** Take the oldest element. May be called by any thread. */
+	bool
+	steal (T& data)
+	{
+		int64_t t = _top.load (std::memory_order_acquire);
+		std::atomic_thread_fence (std::memory_order_seq_cst);
+		int64_t b = _bottom.load (std::memory_order_acquire);
+
+		if (t >= b) {
+			return false;
+		}
+
+		data = _buffer[t & _buffer_mask].load (std::memory_order_relaxed);
+		return _top.compare_exchange_strong (t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+	}
+
+private:
+	char                 _pad0[64];
+	std::atomic<T>*      _buffer;
+	size_t               _buffer_mask;
+	char                 _pad1[64 - sizeof (std::atomic<T>*) - sizeof (size_t)];
+	std::atomic<int64_t> _top;
+	char                 _pad2[64 - sizeof (int64_t)];
+	std::atomic<int64_t> _bottom;
+	char                 _pad3[64 - sizeof (int64_t)];
+};
+
+} // namespace PBD
+
+#endif
@@ -0,0 +1,82 @@
+/*
+ * Copyright (C) 2026 Ardour Developers
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/* Measures the cost of connecting to and emitting a PBD::Signal
+ * with a varying number of slots.
+ *
+ * usage: signals-bench [n-emissions]
+ */
+
+#include <cstdlib>
+#include <iostream>
+
+#include "pbd/microseconds.h"
+#include "pbd/signals.h"
+
+static int N = 0;
+
+static void
+receiver ()
+{
+	++N;
+}
+
+int
+main (int argc, char* argv[])
+{
+	size_t const n_slots[] = { 1, 10, 500, 5000 };
+	int          n_emit    = 10000;
+
+	if (argc > 1) {
+		n_emit = std::max (1, atoi (argv[1]));
+	}
+
+	for (auto const& n : n_slots) {
+		PBD::Signal<void()>       sig;
+		PBD::ScopedConnectionList cl;
+
+		PBD::microseconds_t t0 = PBD::get_microseconds ();
+		for (size_t i = 0; i < n; ++i) {
+			sig.connect_same_thread (cl, std::bind (&receiver));
+		}
+		PBD::microseconds_t t1 = PBD::get_microseconds ();
+
+		N = 0;
+		for (int i = 0; i < n_emit; ++i) {
+			sig ();
+		}
+		PBD::microseconds_t t2 = PBD::get_microseconds ();
+
+		if (N != (int)(n * n_emit)) {
+			std::cerr << "Expected " << n * n_emit << " calls, got " << N << "\n";
+			return 1;
+		}
+
+		PBD::microseconds_t t3 = PBD::get_microseconds ();
+		cl.drop_connections ();
+		PBD::microseconds_t t4 = PBD::get_microseconds ();
+
+		std::cout << n << " slot(s): "
+		          << (1000.0 * (t1 - t0) / n) << " ns/connect, "
+		          << (1000.0 * (t4 - t3) / n) << " ns/disconnect, "
+		          << (1000.0 * (t2 - t1) / n_emit) << " ns/emission, "
+		          << (1000.0 * (t2 - t1) / (n_emit * n)) << " ns/slot\n";
+	}
+
+	return 0;
+}
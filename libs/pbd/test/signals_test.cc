@@ -1,3 +1,6 @@
+#include <iostream>
+#include <memory>
+
 #include "signals_test.h"
 #include "pbd/signals.h"
 
@@ -84,3 +87,118 @@ SignalsTest::testScopedConnectionList ()
 
 	CPPUNIT_ASSERT_EQUAL (1, N);
 }
+
+void
+SignalsTest::testDisconnectDuringEmission ()
+{
+	Emitter* e = new Emitter;
+	PBD::ScopedConnection c[3];
+
+	/* the first slot to be called disconnects all others */
+	for (int i = 0; i < 3; ++i) {
+		e->Fred.connect_same_thread (c[i], [&c] () {
+			++N;
+			for (int j = 0; j < 3; ++j) {
+				c[j].disconnect ();
+			}
+		});
+	}
+
+	N = 0;
+	e->emit ();
+	CPPUNIT_ASSERT_EQUAL (1, N);
+	CPPUNIT_ASSERT (e->Fred.empty ());
+
+	/* slots connected during emission are not called */
+	PBD::ScopedConnection d;
+	PBD::ScopedConnection f;
+	e->Fred.connect_same_thread (d, [e, &f] () {
+		++N;
+		e->Fred.connect_same_thread (f, std::bind (&receiver));
+	});
+
+	N = 0;
+	e->emit ();
+	CPPUNIT_ASSERT_EQUAL (1, N);
+	CPPUNIT_ASSERT_EQUAL ((size_t)2, e->Fred.size ());
+
+	delete e;
+}
+
+void
+SignalsTest::testDisconnectReleasesSlot ()
+{
+	Emitter* e = new Emitter;
+	std::shared_ptr<int> obj (new int (0));
+	std::weak_ptr<int>   w (obj);
+
+	PBD::ScopedConnection c;
+	e->Fred.connect_same_thread (c, [obj] () { ++N; });
+	obj.reset ();
+
+	N = 0;
+	e->emit ();
+	CPPUNIT_ASSERT_EQUAL (1, N);
+	CPPUNIT_ASSERT (!w.expired ());
+
+	/* objects bound to a slot are released by disconnect () */
+	c.disconnect ();
+	CPPUNIT_ASSERT (w.expired ());
+
+	/* unless the slot is being called, then they are released
+	 * the next time a slot is connected or disconnected */
+	obj.reset (new int (0));
+	w = obj;
+	e->Fred.connect_same_thread (c, [&c, obj] () { ++N; c.disconnect (); });
+	obj.reset ();
+
+	N = 0;
+	e->emit ();
+	CPPUNIT_ASSERT_EQUAL (1, N);
+	CPPUNIT_ASSERT (!w.expired ());
+
+	PBD::ScopedConnection d;
+	e->Fred.connect_same_thread (d, std::bind (&receiver));
+	CPPUNIT_ASSERT (w.expired ());
+
+	delete e;
+}
+
+void
+SignalsTest::testManyConnections ()
+{
+	Emitter* e = new Emitter;
+	PBD::ScopedConnection c[100];
+
+	/* grow the slot list, and compact it again */
+	for (int i = 0; i < 100; ++i) {
+		e->Fred.connect_same_thread (c[i], std::bind (&receiver));
+	}
+
+	N = 0;
+	e->emit ();
+	CPPUNIT_ASSERT_EQUAL (100, N);
+
+	for (int i = 0; i < 100; i += 2) {
+		c[i].disconnect ();
+	}
+	for (int i = 0; i < 20; i += 2) {
+		e->Fred.connect_same_thread (c[i], std::bind (&receiver));
+	}
+
+	N = 0;
+	e->emit ();
+	CPPUNIT_ASSERT_EQUAL (60, N);
+	CPPUNIT_ASSERT_EQUAL ((size_t)60, e->Fred.size ());
+
+	for (int i = 0; i < 100; ++i) {
+		c[i].disconnect ();
+	}
+
+	N = 0;
+	e->emit ();
+	CPPUNIT_ASSERT_EQUAL (0, N);
+	CPPUNIT_ASSERT (e->Fred.empty ());
+
+	delete e;
+}
@@ -7,6 +7,9 @@ class SignalsTest : public CppUnit::TestFixture
 	CPPUNIT_TEST (testEmission);
 	CPPUNIT_TEST (testDestruction);
 	CPPUNIT_TEST (testScopedConnectionList);
+	CPPUNIT_TEST (testDisconnectDuringEmission);
+	CPPUNIT_TEST (testDisconnectReleasesSlot);
+	CPPUNIT_TEST (testManyConnections);
 	CPPUNIT_TEST_SUITE_END ();
 
 public:
@@ -14,4 +17,7 @@ public:
 	void testEmission ();
 	void testDestruction ();
 	void testScopedConnectionList ();
+	void testDisconnectDuringEmission ();
+	void testDisconnectReleasesSlot ();
+	void testManyConnections ();
 };
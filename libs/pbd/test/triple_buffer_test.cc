@@ -0,0 +1,114 @@
+#include <pthread.h>
+#include <vector>
+
+#include "pbd/triple_buffer.h"
+
+#include "triple_buffer_test.h"
+
+CPPUNIT_TEST_SUITE_REGISTRATION (TripleBufferTest);
+
+using namespace PBD;
+
+typedef std::vector<uint64_t> Values;
+
+void
+TripleBufferTest::testPublish ()
+{
+	TripleBuffer<Values> tb (Values (4, 0));
+	Values               v;
+
+	CPPUNIT_ASSERT_EQUAL (uint64_t (0), tb.read (v));
+	CPPUNIT_ASSERT_EQUAL (size_t (4), v.size ());
+
+	/* nothing written, nothing published */
+	tb.publish ();
+	CPPUNIT_ASSERT_EQUAL (uint64_t (0), tb.read (v));
+
+	for (uint64_t n = 1; n < 10; ++n) {
+		Values& w = tb.write_buffer ();
+		for (size_t i = 0; i < w.size (); ++i) {
+			w[i] = n;
+		}
+		/* not visible before publish () */
+		tb.read (v);
+		CPPUNIT_ASSERT_EQUAL (n - 1, v[0]);
+
+		tb.publish ();
+		CPPUNIT_ASSERT_EQUAL (n, tb.read (v));
+		CPPUNIT_ASSERT_EQUAL (n, v[3]);
+	}
+}
+
+namespace {
+
+struct Race {
+	Race () : tb (Values (256, 0)), done (false) {}
+
+	TripleBuffer<Values> tb;
+	std::atomic<bool>    done;
+};
+
+static const uint64_t n_publish = 200000;
+
+void*
+writer (void* arg)
+{
+	Race* r = static_cast<Race*> (arg);
+	for (uint64_t n = 1; n <= n_publish; ++n) {
+		Values& w = r->tb.write_buffer ();
+		for (size_t i = 0; i < w.size (); ++i) {
+			w[i] = n;
+		}
+		r->tb.publish ();
+	}
+	r->done = true;
+	return 0;
+}
+
+void*
+reader (void* arg)
+{
+	Race*    r    = static_cast<Race*> (arg);
+	uint64_t last = 0;
+	Values   v;
+
+	do {
+		uint64_t n = r->tb.read (v);
+		/* never torn, never older than a previous read */
+		for (size_t i = 0; i < v.size (); ++i) {
+			if (v[i] != n) {
+				return (void*)1;
+			}
+		}
+		if (n < last) {
+			return (void*)1;
+		}
+		last = n;
+	} while (!r->done);
+
+	return 0;
+}
+
+} // namespace
+
+void
+TripleBufferTest::testRace ()
+{
+	Race      r;
+	pthread_t w;
+	pthread_t rd[2];
+
+	CPPUNIT_ASSERT (pthread_create (&rd[0], NULL, reader, &r) == 0);
+	CPPUNIT_ASSERT (pthread_create (&rd[1], NULL, reader, &r) == 0);
+	CPPUNIT_ASSERT (pthread_create (&w, NULL, writer, &r) == 0);
+
+	void* rv;
+	CPPUNIT_ASSERT (pthread_join (w, &rv) == 0);
+	CPPUNIT_ASSERT (pthread_join (rd[0], &rv) == 0);
+	CPPUNIT_ASSERT (rv == 0);
+	CPPUNIT_ASSERT (pthread_join (rd[1], &rv) == 0);
+	CPPUNIT_ASSERT (rv == 0);
+
+	Values v;
+	CPPUNIT_ASSERT_EQUAL (n_publish, r.tb.read (v));
+}
@@ -0,0 +1,14 @@
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+class TripleBufferTest : public CppUnit::TestFixture
+{
+	CPPUNIT_TEST_SUITE (TripleBufferTest);
+	CPPUNIT_TEST (testPublish);
+	CPPUNIT_TEST (testRace);
+	CPPUNIT_TEST_SUITE_END ();
+
+public:
+	void testPublish ();
+	void testRace ();
+};
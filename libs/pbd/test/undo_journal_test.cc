@@ -0,0 +1,287 @@
+#include "undo_journal_test.h"
+
+#include <glib.h>
+#include <glibmm/miscutils.h>
+
+#include "pbd/gstdio_compat.h"
+#include "pbd/string_convert.h"
+#include "pbd/undo.h"
+#include "pbd/undo_journal.h"
+#include "pbd/xml++.h"
+
+#include "test_common.h"
+
+using namespace std;
+using namespace PBD;
+
+CPPUNIT_TEST_SUITE_REGISTRATION (UndoJournalTest);
+
+namespace {
+
+class TestCommand : public Command
+{
+public:
+	~TestCommand () { drop_references (); }
+	void operator() () {}
+	void undo () {}
+};
+
+UndoTransaction*
+make_transaction (std::string const& name, int n_commands = 0)
+{
+	UndoTransaction* ut = new UndoTransaction ();
+	ut->set_name (name);
+	for (int i = 0; i < n_commands; ++i) {
+		ut->add_command (new TestCommand);
+	}
+	return ut;
+}
+
+/* transactions with commands are named "<name>(<number of commands>)" */
+UndoTransaction*
+transaction_from_state (XMLNode const& node)
+{
+	std::string name;
+	if (!node.get_property ("name", name)) {
+		return 0;
+	}
+	size_t const n = node.children ().size ();
+	if (n > 0) {
+		name += "(" + PBD::to_string (n) + ")";
+	}
+	return make_transaction (name, n);
+}
+
+/* load the journal at @p path into a new history, return the names of its transactions */
+std::string
+reload (std::string const& path)
+{
+	UndoHistory history;
+	UndoJournal journal;
+
+	CPPUNIT_ASSERT_EQUAL (0, journal.load (path, history, &transaction_from_state));
+
+	std::string names;
+	while (history.undo_depth () > 0) {
+		names = history.next_undo () + names;
+		history.undo (1);
+	}
+	return names;
+}
+
+std::string
+journal_path (std::string const& name)
+{
+	return Glib::build_filename (test_output_directory ("undo_journal"), name);
+}
+
+int64_t
+file_size (std::string const& path)
+{
+	GStatBuf statbuf;
+	if (g_stat (path.c_str (), &statbuf) != 0) {
+		return -1;
+	}
+	return statbuf.st_size;
+}
+
+void
+truncate_file (std::string const& path, int64_t size)
+{
+	gchar* contents;
+	gsize  length;
+
+	CPPUNIT_ASSERT (g_file_get_contents (path.c_str (), &contents, &length, NULL));
+	CPPUNIT_ASSERT ((gsize) size <= length);
+	CPPUNIT_ASSERT (g_file_set_contents (path.c_str (), contents, size, NULL));
+	g_free (contents);
+}
+
+}
+
+void
+UndoJournalTest::testRoundTrip ()
+{
+	std::string const path = journal_path ("roundtrip");
+
+	UndoHistory history;
+	UndoJournal journal;
+
+	for (char c = 'a'; c <= 'e'; ++c) {
+		history.add (make_transaction (std::string (1, c)));
+	}
+
+	CPPUNIT_ASSERT_EQUAL (0, journal.save (history, -1, path));
+	CPPUNIT_ASSERT_EQUAL (std::string ("abcde"), reload (path));
+
+	/* missing file */
+	UndoJournal other;
+	CPPUNIT_ASSERT_EQUAL (1, other.load (journal_path ("does-not-exist"), history, &transaction_from_state));
+}
+
+void
+UndoJournalTest::testAppend ()
+{
+	std::string const path = journal_path ("append");
+
+	UndoHistory history;
+	UndoJournal journal;
+
+	history.add (make_transaction ("a"));
+	history.add (make_transaction ("b"));
+	CPPUNIT_ASSERT_EQUAL (0, journal.save (history, -1, path));
+
+	int64_t const size = file_size (path);
+	CPPUNIT_ASSERT_EQUAL (size, journal.file_size ());
+
+	/* saving again without changes does not touch the file */
+	CPPUNIT_ASSERT_EQUAL (0, journal.save (history, -1, path));
+	CPPUNIT_ASSERT_EQUAL (size, file_size (path));
+
+	/* only the new transaction is appended */
+	history.add (make_transaction ("c"));
+	CPPUNIT_ASSERT_EQUAL (0, journal.save (history, -1, path));
+	CPPUNIT_ASSERT (file_size (path) > size);
+	CPPUNIT_ASSERT (file_size (path) < 2 * size);
+	CPPUNIT_ASSERT_EQUAL (std::string ("abc"), reload (path));
+
+	/* continue appending to a journal that was loaded */
+	UndoHistory loaded;
+	UndoJournal loaded_journal;
+	CPPUNIT_ASSERT_EQUAL (0, loaded_journal.load (path, loaded, &transaction_from_state));
+	int64_t const loaded_size = file_size (path);
+
+	loaded.add (make_transaction ("d"));
+	CPPUNIT_ASSERT_EQUAL (0, loaded_journal.save (loaded, -1, path));
+	CPPUNIT_ASSERT (file_size (path) < loaded_size + size);
+	CPPUNIT_ASSERT_EQUAL (std::string ("abcd"), reload (path));
+}
+
+void
+UndoJournalTest::testUndoAndDepth ()
+{
+	std::string const path = journal_path ("undo");
+
+	UndoHistory history;
+	UndoJournal journal;
+
+	for (char c = 'a'; c <= 'e'; ++c) {
+		history.add (make_transaction (std::string (1, c)));
+	}
+	CPPUNIT_ASSERT_EQUAL (0, journal.save (history, -1, path));
+
+	/* undone transactions are dropped */
+	history.undo (2);
+	CPPUNIT_ASSERT_EQUAL (0, journal.save (history, -1, path));
+	CPPUNIT_ASSERT_EQUAL (std::string ("abc"), reload (path));
+
+	/* and replaced by new ones */
+	history.add (make_transaction ("x"));
+	CPPUNIT_ASSERT_EQUAL (0, journal.save (history, -1, path));
+	CPPUNIT_ASSERT_EQUAL (std::string ("abcx"), reload (path));
+
+	/* only the most recent ones are kept */
+	history.add (make_transaction ("y"));
+	CPPUNIT_ASSERT_EQUAL (0, journal.save (history, 3, path));
+	CPPUNIT_ASSERT_EQUAL (std::string ("cxy"), reload (path));
+
+	/* transactions before the previously saved ones */
+	history.undo (3);
+	CPPUNIT_ASSERT_EQUAL (0, journal.save (history, 3, path));
+	CPPUNIT_ASSERT_EQUAL (std::string ("ab"), reload (path));
+
+	/* nothing left */
+	history.undo (2);
+	CPPUNIT_ASSERT_EQUAL (0, journal.save (history, 3, path));
+	CPPUNIT_ASSERT_EQUAL (std::string (), reload (path));
+}
+
+void
+UndoJournalTest::testModified ()
+{
+	std::string const path = journal_path ("modified");
+
+	UndoHistory history;
+	UndoJournal journal;
+
+	Command*         a1 = new TestCommand;
+	Command*         b1 = new TestCommand;
+	UndoTransaction* a  = make_transaction ("a", 1);
+	UndoTransaction* b  = make_transaction ("b", 2);
+
+	a->add_command (a1);
+	b->add_command (b1);
+
+	history.add (a);
+	history.add (b);
+	history.add (make_transaction ("c", 1));
+	CPPUNIT_ASSERT_EQUAL (0, journal.save (history, -1, path));
+	CPPUNIT_ASSERT_EQUAL (std::string ("a(2)b(3)c(1)"), reload (path));
+
+	int64_t const size = file_size (path);
+
+	/* a command is removed, because the object it refers to is gone */
+	delete b1;
+	CPPUNIT_ASSERT_EQUAL (0, journal.save (history, -1, path));
+	CPPUNIT_ASSERT_EQUAL (std::string ("a(2)b(2)c(1)"), reload (path));
+
+	/* only the modified transaction and the ones after it are appended */
+	CPPUNIT_ASSERT (file_size (path) > size);
+	CPPUNIT_ASSERT (file_size (path) < 2 * size);
+
+	/* the oldest one */
+	history.add (make_transaction ("d"));
+	CPPUNIT_ASSERT_EQUAL (0, journal.save (history, -1, path));
+	delete a1;
+	CPPUNIT_ASSERT_EQUAL (0, journal.save (history, -1, path));
+	CPPUNIT_ASSERT_EQUAL (std::string ("a(1)b(2)c(1)d"), reload (path));
+}
+
+void
+UndoJournalTest::testCompaction ()
+{
+	std::string const path = journal_path ("compaction");
+
+	UndoHistory history;
+	UndoJournal journal;
+
+	history.set_depth (10);
+
+	for (int i = 0; i < 1000; ++i) {
+		history.add (make_transaction (PBD::to_string (i % 10)));
+		CPPUNIT_ASSERT_EQUAL (0, journal.save (history, 10, path));
+		CPPUNIT_ASSERT (journal.file_size () <= 2 * journal.live_size () + 65536 + 1024);
+	}
+
+	CPPUNIT_ASSERT_EQUAL (journal.file_size (), file_size (path));
+	CPPUNIT_ASSERT_EQUAL (std::string ("0123456789"), reload (path));
+}
+
+void
+UndoJournalTest::testIncompleteWrite ()
+{
+	std::string const path = journal_path ("incomplete");
+
+	UndoHistory history;
+	UndoJournal journal;
+
+	history.add (make_transaction ("a"));
+	history.add (make_transaction ("b"));
+	CPPUNIT_ASSERT_EQUAL (0, journal.save (history, -1, path));
+	int64_t const size = file_size (path);
+
+	history.add (make_transaction ("c"));
+	CPPUNIT_ASSERT_EQUAL (0, journal.save (history, -1, path));
+
+	/* cut off the last record, as if saving had been interrupted */
+	truncate_file (path, size + 10);
+	CPPUNIT_ASSERT_EQUAL (std::string ("ab"), reload (path));
+
+	/* the next save rewrites the journal */
+	UndoHistory loaded;
+	UndoJournal loaded_journal;
+	CPPUNIT_ASSERT_EQUAL (0, loaded_journal.load (path, loaded, &transaction_from_state));
+	loaded.add (make_transaction ("d"));
+	CPPUNIT_ASSERT_EQUAL (0, loaded_journal.save (loaded, -1, path));
+	CPPUNIT_ASSERT_EQUAL (std::string ("abd"), reload (path));
+}
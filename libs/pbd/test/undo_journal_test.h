@@ -0,0 +1,22 @@
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+class UndoJournalTest : public CppUnit::TestFixture
+{
+	CPPUNIT_TEST_SUITE (UndoJournalTest);
+	CPPUNIT_TEST (testRoundTrip);
+	CPPUNIT_TEST (testAppend);
+	CPPUNIT_TEST (testUndoAndDepth);
+	CPPUNIT_TEST (testModified);
+	CPPUNIT_TEST (testCompaction);
+	CPPUNIT_TEST (testIncompleteWrite);
+	CPPUNIT_TEST_SUITE_END ();
+
+public:
+	void testRoundTrip ();
+	void testAppend ();
+	void testUndoAndDepth ();
+	void testModified ();
+	void testCompaction ();
+	void testIncompleteWrite ();
+};
@@ -21,6 +21,7 @@
  * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
  */
 
+#include <atomic>
 #include <sstream>
 #include <string>
 #include <time.h>
@@ -32,15 +33,21 @@ using namespace std;
 using namespace sigc;
 using namespace PBD;
 
+static std::atomic<uint64_t> next_transaction_serial (0);
+
 UndoTransaction::UndoTransaction ()
 	: _timestamp (g_date_time_new_now_local ())
 	, _clearing (false)
+	, _serial (++next_transaction_serial)
+	, _revision (0)
 {
 }
 
 UndoTransaction::UndoTransaction (const UndoTransaction& rhs)
 	: Command (rhs._name)
 	, _clearing (false)
+	, _serial (++next_transaction_serial)
+	, _revision (0)
 {
 	_timestamp = rhs._timestamp;
 	clear ();
@@ -89,6 +96,7 @@ UndoTransaction::add_command (Command* const cmd)
 
 	cmd->DropReferences.connect_same_thread (*this, std::bind (&command_death, this, cmd));
 	actions.push_back (cmd);
+	++_revision;
 }
 
 void
@@ -99,6 +107,7 @@ UndoTransaction::remove_command (Command* const action)
 		return;
 	}
 	actions.erase (i);
+	++_revision;
 }
 
 bool
@@ -116,6 +125,7 @@ UndoTransaction::clear ()
 	}
 	actions.clear ();
 	_clearing = false;
+	++_revision;
 }
 
 void
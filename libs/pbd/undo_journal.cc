@@ -0,0 +1,312 @@
+/*
+ * Copyright (C) 2026 Ardour Developers
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstring>
+#include <list>
+#include <memory>
+
+#include <glib.h>
+
+#include "pbd/gstdio_compat.h"
+#include "pbd/undo.h"
+#include "pbd/undo_journal.h"
+#include "pbd/xml++.h"
+
+using namespace PBD;
+
+/* File format:
+ *
+ *   ArdourUndoJournal 1
+ *   T <serial> <size>     a transaction, followed by <size> bytes of XML and a newline
+ *   X <serial>            drop all transactions after <serial> (they were undone,
+ *                         or modified and are written again)
+ *   F <serial>            drop all transactions before <serial> (history depth)
+ *
+ * Serials are assigned by the journal, and increase monotonically
+ * in file order.
+ */
+
+const char* const UndoJournal::header = "ArdourUndoJournal 1";
+
+/* rewrite the journal when it contains more dead than live data */
+static const int64_t compaction_slack = 65536;
+
+typedef std::unique_ptr<FILE, int (*) (FILE*)> FilePtr;
+
+UndoJournal::UndoJournal ()
+{
+	reset ();
+}
+
+void
+UndoJournal::reset ()
+{
+	_path.clear ();
+	_live.clear ();
+	_next_serial = 0;
+	_file_size   = 0;
+	_live_size   = 0;
+	_dirty       = false;
+}
+
+int
+UndoJournal::save (UndoHistory const& history, int32_t depth, std::string const& path)
+{
+	std::list<UndoTransaction*> const& ul (history.UndoList);
+
+	size_t n = ul.size ();
+	if (depth >= 0 && (size_t) depth < n) {
+		n = depth;
+	}
+
+	std::list<UndoTransaction*>::const_iterator i = ul.begin ();
+	std::advance (i, ul.size () - n);
+	std::vector<UndoTransaction*> want (i, ul.end ());
+
+	if (_dirty || path != _path || want.empty ()) {
+		return compact (want, path);
+	}
+
+	/* find the oldest wanted transaction in the journal */
+	size_t p = 0;
+	while (p < _live.size () && _live[p].serial != want.front ()->serial ()) {
+		++p;
+	}
+
+	if (p == _live.size ()) {
+		return compact (want, path);
+	}
+
+	/* ..and how many of the following ones are there already, unmodified */
+	size_t common = 0;
+	while (p + common < _live.size () && common < want.size ()
+	       && _live[p + common].serial == want[common]->serial ()
+	       && _live[p + common].revision == want[common]->revision ()) {
+		++common;
+	}
+
+	if (common == 0) {
+		/* the oldest one was modified, there is nothing to keep */
+		return compact (want, path);
+	}
+
+	if (p == 0 && common == want.size () && common == _live.size ()) {
+		/* unchanged */
+		return 0;
+	}
+
+	if (_file_size > 2 * _live_size + compaction_slack) {
+		return compact (want, path);
+	}
+
+	FilePtr f (g_fopen (path.c_str (), "ab"), ::fclose);
+
+	if (!f || fseek (f.get (), 0, SEEK_END) != 0 || ftell (f.get ()) != _file_size) {
+		/* modified behind our back */
+		f.reset ();
+		return compact (want, path);
+	}
+
+	bool ok = true;
+
+	if (p + common < _live.size ()) {
+		ok = fprintf (f.get (), "X %" PRIu64 "\n", _live[p + common - 1].journal_serial) > 0;
+		while (_live.size () > p + common) {
+			_live_size -= _live.back ().size;
+			_live.pop_back ();
+		}
+	}
+
+	for (size_t k = common; ok && k < want.size (); ++k) {
+		ok = write_record (f.get (), *want[k]);
+	}
+
+	if (ok && p > 0) {
+		ok = fprintf (f.get (), "F %" PRIu64 "\n", _live[p].journal_serial) > 0;
+		while (p--) {
+			_live_size -= _live.front ().size;
+			_live.pop_front ();
+		}
+	}
+
+	ok = ok && fflush (f.get ()) == 0;
+	_file_size = ftell (f.get ());
+
+	if (!ok || fclose (f.release ()) != 0) {
+		/* the journal is still readable, but rewrite it next time */
+		_dirty = true;
+		return -1;
+	}
+
+	return 0;
+}
+
+bool
+UndoJournal::write_record (FILE* f, UndoTransaction const& ut)
+{
+	XMLTree tree;
+	tree.set_root (&ut.get_state ());
+	std::string const& xml (tree.write_buffer ());
+
+	uint64_t const serial = ++_next_serial;
+
+	if (fprintf (f, "T %" PRIu64 " %" PRIu64 "\n", serial, (uint64_t) xml.size ()) <= 0) {
+		return false;
+	}
+
+	int64_t const offset = ftell (f);
+
+	if (fwrite (xml.c_str (), 1, xml.size (), f) != xml.size () || fputc ('\n', f) == EOF) {
+		return false;
+	}
+
+	_live.push_back (Record (ut.serial (), ut.revision (), serial, offset, xml.size ()));
+	_live_size += xml.size ();
+	return true;
+}
+
+int
+UndoJournal::compact (std::vector<UndoTransaction*> const& want, std::string const& path)
+{
+	std::string const tmp_path = path + ".tmp";
+
+	reset ();
+
+	FilePtr f (g_fopen (tmp_path.c_str (), "wb"), ::fclose);
+
+	if (!f) {
+		return -1;
+	}
+
+	bool ok = fprintf (f.get (), "%s\n", header) > 0;
+
+	for (size_t k = 0; ok && k < want.size (); ++k) {
+		ok = write_record (f.get (), *want[k]);
+	}
+
+	ok = ok && fflush (f.get ()) == 0;
+	_file_size = ftell (f.get ());
+	ok = (fclose (f.release ()) == 0) && ok;
+
+	if (!ok || ::g_rename (tmp_path.c_str (), path.c_str ()) != 0) {
+		::g_remove (tmp_path.c_str ());
+		reset ();
+		return -1;
+	}
+
+	_path = path;
+	return 0;
+}
+
+int
+UndoJournal::load (std::string const& path, UndoHistory& history, TransactionFactory factory)
+{
+	reset ();
+
+	FilePtr f (g_fopen (path.c_str (), "rb"), ::fclose);
+
+	if (!f) {
+		return 1;
+	}
+
+	char line[128];
+
+	if (!fgets (line, sizeof (line), f.get ()) || strncmp (line, header, strlen (header)) != 0) {
+		return -1;
+	}
+
+	int64_t const hdr_end = ftell (f.get ());
+	fseek (f.get (), 0, SEEK_END);
+	int64_t const total = ftell (f.get ());
+	fseek (f.get (), hdr_end, SEEK_SET);
+
+	/* 1st pass: only read record headers to find which ones are live */
+
+	std::deque<Record> live;
+	int64_t            valid_end = hdr_end;
+
+	while (fgets (line, sizeof (line), f.get ())) {
+		uint64_t serial;
+		uint64_t size;
+
+		if (line[0] == 'T' && sscanf (line, "T %" SCNu64 " %" SCNu64, &serial, &size) == 2) {
+			int64_t const offset = ftell (f.get ());
+			if (offset + (int64_t) size + 1 > total) {
+				/* incomplete write */
+				break;
+			}
+			fseek (f.get (), size + 1, SEEK_CUR);
+			live.push_back (Record (0, 0, serial, offset, size));
+		} else if (line[0] == 'X' && sscanf (line, "X %" SCNu64, &serial) == 1) {
+			while (!live.empty () && live.back ().journal_serial > serial) {
+				live.pop_back ();
+			}
+		} else if (line[0] == 'F' && sscanf (line, "F %" SCNu64, &serial) == 1) {
+			while (!live.empty () && live.front ().journal_serial < serial) {
+				live.pop_front ();
+			}
+		} else {
+			break;
+		}
+
+		_next_serial = std::max (_next_serial, serial);
+		valid_end    = ftell (f.get ());
+	}
+
+	/* 2nd pass: parse live records, one at a time */
+
+	std::vector<char> buf;
+
+	for (std::deque<Record>::iterator r = live.begin (); r != live.end (); ++r) {
+		buf.resize (r->size + 1);
+
+		if (fseek (f.get (), r->offset, SEEK_SET) != 0 || fread (&buf[0], 1, r->size, f.get ()) != (size_t) r->size) {
+			_dirty = true;
+			break;
+		}
+		buf[r->size] = '\0';
+
+		XMLTree tree;
+		UndoTransaction* ut = 0;
+
+		if (tree.read_buffer (&buf[0]) && tree.root ()) {
+			ut = factory (*tree.root ());
+		}
+
+		if (!ut) {
+			/* the record stays in the file, drop it on the next save */
+			_dirty = true;
+			continue;
+		}
+
+		history.add (ut);
+
+		r->serial   = ut->serial ();
+		r->revision = ut->revision ();
+		_live.push_back (*r);
+		_live_size += r->size;
+	}
+
+	_path      = path;
+	_file_size = valid_end;
+	_dirty     = _dirty || valid_end != total;
+
+	return 0;
+}
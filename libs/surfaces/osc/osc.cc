@@ -49,6 +49,7 @@
 #include "ardour/route_group.h"
 #include "ardour/audio_track.h"
 #include "ardour/midi_track.h"
+#include "ardour/meter.h"
 #include "ardour/mixer_scene.h"
 #include "ardour/vca.h"
 #include "ardour/monitor_control.h"
@@ -116,6 +117,9 @@ OSC::OSC (Session& s, uint32_t port)
 	, default_gainmode (0)
 	, default_send_size (0)
 	, default_plugin_size (0)
+	, default_bundle (false)
+	, default_feedback_rate (10)
+	, _meter_delta (0)
 	, tick (true)
 	, bank_dirty (false)
 	, observer_busy (true)
@@ -321,6 +325,7 @@ OSC::stop ()
 		surface_destroy (sur);
 	}
 	_surface.clear();
+	clear_bundles ();
 
 	/* stop main loop */
 	if (local_server) {
@@ -394,6 +399,9 @@ OSC::surface_destroy (OSCSurface* sur)
 		}
 	}
 	sur->observers.clear();
+
+	// pending feedback is stale, re-enabled by set_bundling() if the surface is reused
+	drop_bundle (sur->remote_url);
 }
 
 
@@ -746,9 +754,9 @@ OSC::send_current_value (const char* path, lo_arg** argv, int argc, lo_message m
 	OSCSurface *sur = get_surface(get_address (msg));
 
 	if (sur->feedback[14]) {
-		lo_send_message (get_address (msg), X_("/reply"), reply);
+		send_reply (get_address (msg), X_("/reply"), reply);
 	} else {
-		lo_send_message (get_address (msg), X_("#reply"), reply);
+		send_reply (get_address (msg), X_("#reply"), reply);
 	}
 	lo_message_free (reply);
 }
@@ -1099,9 +1107,9 @@ OSC::routes_list (lo_message msg)
 				lo_message_add_int32 (reply, s->rec_enable_control()->get_value());
 			}
 			if (sur->feedback[14]) {
-				lo_send_message (get_address (msg), X_("/reply"), reply);
+				send_reply (get_address (msg), X_("/reply"), reply);
 			} else {
-				lo_send_message (get_address (msg), X_("#reply"), reply);
+				send_reply (get_address (msg), X_("#reply"), reply);
 			}
 			lo_message_free (reply);
 		}
@@ -1121,9 +1129,9 @@ OSC::routes_list (lo_message msg)
 	}
 
 	if (sur->feedback[14]) {
-		lo_send_message (get_address (msg), X_("/reply"), reply);
+		send_reply (get_address (msg), X_("/reply"), reply);
 	} else {
-		lo_send_message (get_address (msg), X_("#reply"), reply);
+		send_reply (get_address (msg), X_("#reply"), reply);
 	}
 
 	lo_message_free (reply);
@@ -1382,6 +1390,7 @@ OSC::refresh_surface (lo_message msg)
 	uint32_t pp = s->plug_page_size;
 
 	surface_destroy (s);
+	set_bundling (s);
 	// restart all observers
 	set_surface (bs, st, fb, gm, sp, pp, msg);
 	return 0;
@@ -1653,7 +1662,10 @@ OSC::surface_parse (const char *path, const char* types, lo_arg **argv, int argc
 		}
 	}
 
-	if (argc == 1 && !strncmp (path, X_("/set_surface/feedback"), 21)) {
+	if (argc == 1 && !strncmp (path, X_("/set_surface/feedback_rate"), 26)) {
+		ret = set_surface_feedback_rate (data, msg);
+	}
+	else if (argc == 1 && !strncmp (path, X_("/set_surface/feedback"), 21)) {
 		ret = set_surface_feedback (data, msg);
 	}
 	else if (argc == 1 && !strncmp (path, X_("/set_surface/bank_size"), 22)) {
@@ -1673,6 +1685,9 @@ OSC::surface_parse (const char *path, const char* types, lo_arg **argv, int argc
 	}
 	else if (argc == 1 && !strncmp (path, X_("/set_surface/port"), 17)) {
 		ret = set_surface_port (data, msg);
+	}
+	else if (argc == 1 && !strncmp (path, X_("/set_surface/bundle"), 19)) {
+		ret = set_surface_bundle (data, msg);
 	} else if (strlen(path) == 12) {
 
 		// command is in /set_surface iii form
@@ -1754,7 +1769,7 @@ OSC::surface_parse (const char *path, const char* types, lo_arg **argv, int argc
 					lo_message_add_int32 (reply, (int) linkset);
 					lo_message_add_int32 (reply, (int) linkid);
 					lo_message_add_int32 (reply, (int) port);
-					lo_send_message (get_address (msg), X_("/set_surface"), reply);
+					send_reply (get_address (msg), X_("/set_surface"), reply);
 					lo_message_free (reply);
 					return 0;
 				}
@@ -1974,6 +1989,34 @@ OSC::set_surface_gainmode (uint32_t gm, lo_message msg)
 	return 0;
 }
 
+/* periodic() ticks at 10Hz, lower feedback rates skip ticks */
+static uint32_t
+feedback_ticks (uint32_t rate)
+{
+	if (!rate) {
+		return 1;
+	}
+	return std::max (1u, (10 + rate / 2) / rate);
+}
+
+int
+OSC::set_surface_bundle (uint32_t yn, lo_message msg)
+{
+	OSCSurface *s = get_surface(get_address (msg), true);
+	s->bundle = yn;
+	set_bundling (s);
+	return 0;
+}
+
+int
+OSC::set_surface_feedback_rate (uint32_t fr, lo_message msg)
+{
+	OSCSurface *s = get_surface(get_address (msg), true);
+	s->feedback_ticks = feedback_ticks (fr);
+	s->tick_count = 0;
+	return 0;
+}
+
 int
 OSC::set_surface_port (uint32_t po, lo_message msg)
 {
@@ -2006,8 +2049,11 @@ OSC::set_surface_port (uint32_t po, lo_message msg)
 				}
 				char * rurl;
 				rurl = lo_address_get_url (new_addr);
+				// nothing must be queued for the old url
+				drop_bundle (sur->remote_url);
 				sur->remote_url = rurl;
 				free (rurl);
+				set_bundling (sur);
 				for (uint32_t it = 0; it < _surface.size();) {
 					if (&_surface[it] == sur) {
 						it++;
@@ -2089,11 +2135,15 @@ OSC::get_surface (lo_address addr , bool quiet)
 	s.plugin_id = 1;
 	s.linkset = 0;
 	s.linkid = 1;
+	s.bundle = default_bundle;
+	s.feedback_ticks = feedback_ticks (default_feedback_rate);
+	s.tick_count = 0;
 
 	s.nstrips = s.strips.size();
 	{
 		_surface.push_back (s);
 	}
+	set_bundling (&_surface[_surface.size() - 1]);
 
 	if (!quiet) {
 		strip_feedback (&s, true);
@@ -2244,7 +2294,7 @@ OSC::_recalcbanks ()
 			// This surface uses /strip/list tell it routes have changed
 			lo_message reply;
 			reply = lo_message_new ();
-			lo_send_message (addr, X_("/strip/list"), reply);
+			send_reply (addr, X_("/strip/list"), reply);
 			lo_message_free (reply);
 		} else {
 			strip_feedback (sur, false);
@@ -2386,7 +2436,7 @@ OSC::bank_leds (OSCSurface* s)
 		} else {
 			lo_message_add_int32 (reply, 1);
 		}
-		lo_send_message (addr, X_("/bank_up"), reply);
+		send_reply (addr, X_("/bank_up"), reply);
 		lo_message_free (reply);
 		reply = lo_message_new ();
 		if (bank > 1) {
@@ -2394,7 +2444,7 @@ OSC::bank_leds (OSCSurface* s)
 		} else {
 			lo_message_add_int32 (reply, 0);
 		}
-		lo_send_message (addr, X_("/bank_down"), reply);
+		send_reply (addr, X_("/bank_down"), reply);
 		lo_message_free (reply);
 	}
 }
@@ -2962,7 +3012,7 @@ OSC::transport_sample (lo_message msg)
 	lo_message reply = lo_message_new ();
 	lo_message_add_int64 (reply, pos);
 
-	lo_send_message (get_address (msg), X_("/transport_frame"), reply);
+	send_reply (get_address (msg), X_("/transport_frame"), reply);
 
 	lo_message_free (reply);
 }
@@ -2979,7 +3029,7 @@ OSC::transport_speed (lo_message msg)
 	lo_message reply = lo_message_new ();
 	lo_message_add_double (reply, ts);
 
-	lo_send_message (get_address (msg), X_("/transport_speed"), reply);
+	send_reply (get_address (msg), X_("/transport_speed"), reply);
 
 	lo_message_free (reply);
 }
@@ -2996,7 +3046,7 @@ OSC::record_enabled (lo_message msg)
 	lo_message reply = lo_message_new ();
 	lo_message_add_int32 (reply, re);
 
-	lo_send_message (get_address (msg), X_("/record_enabled"), reply);
+	send_reply (get_address (msg), X_("/record_enabled"), reply);
 
 	lo_message_free (reply);
 }
@@ -3140,7 +3190,7 @@ OSC::trigger_bank_state (lo_address addr)
 	lo_message_add_int32 (bank_msg, _tbank_start_route);  //route start offs
 	lo_message_add_int32 (bank_msg, TriggerBox::default_triggers_per_box);  //total avail triggers
 	lo_message_add_int32 (bank_msg, _tbank_start_row);  //trigger start offs
-	lo_send_message (addr, X_("/trigger_grid/bank"), bank_msg);
+	send_reply (addr, X_("/trigger_grid/bank"), bank_msg);
 	lo_message_free (bank_msg);
 
 	return 0;
@@ -3157,7 +3207,7 @@ OSC::trigger_grid_state (lo_address addr, bool zero_it)
 		for (int row = 0; row < 8; row++) { //ToDo: trigger bank size
 			lo_message_add_int32 (trig_msg, zero_it ? -1 : trigger_display_at(rt, row).state);  // -1 = empty; 0 stopped; 1 playing
 		}
-		lo_send_message (addr, string_compose(X_("/trigger_grid/%1/state"), rt).c_str(), trig_msg);
+		send_reply (addr, string_compose(X_("/trigger_grid/%1/state"), rt).c_str(), trig_msg);
 		lo_message_free (trig_msg);
 	}
 	return 0;
@@ -3176,7 +3226,7 @@ OSC::mixer_scene_state (lo_address addr, bool zero_it)
 		} else {
 			lo_message_add_string (scene_msg, "");
 		}
-		lo_send_message (addr, string_compose(X_("/mixer_scene/%1/name"), scn).c_str(), scene_msg);
+		send_reply (addr, string_compose(X_("/mixer_scene/%1/name"), scn).c_str(), scene_msg);
 		lo_message_free (scene_msg);
 	}
 	return 0;
@@ -3362,7 +3412,7 @@ OSC::send_group_list (lo_address addr)
 	for (auto const & rg : groups) {
 		lo_message_add_string (reply, rg->name().c_str());
 	}
-	lo_send_message (addr, X_("/group/list"), reply);
+	send_reply (addr, X_("/group/list"), reply);
 	lo_message_free (reply);
 	return 0;
 }
@@ -3425,7 +3475,7 @@ OSC::route_get_sends(lo_message msg) {
 	}
 	// if used dedicated message path to identify this reply in async operation.
 	// Naming it #reply wont help the client to identify the content.
-	lo_send_message(get_address (msg), X_("/strip/sends"), reply);
+	send_reply (get_address (msg), X_("/strip/sends"), reply);
 
 	lo_message_free(reply);
 
@@ -3487,7 +3537,7 @@ OSC::route_get_receives(lo_message msg) {
 
 	// I have used a dedicated message path to identify this reply in async operation.
 	// Naming it #reply wont help the client to identify the content.
-	lo_send_message(get_address (msg), X_("/strip/receives"), reply);
+	send_reply (get_address (msg), X_("/strip/receives"), reply);
 	lo_message_free(reply);
 	return 0;
 }
@@ -4217,7 +4267,6 @@ OSC::_strip_parse (const char *path, const char *sub_path, const char* types, lo
 				}
 			} else {
 				/// put list of VCAs this strip is controlled by
-				_lo_lock.lock ();
 				lo_message rmsg = lo_message_new ();
 				if (param_1) {
 					int sid = 0;
@@ -4237,9 +4286,8 @@ OSC::_strip_parse (const char *path, const char *sub_path, const char* types, lo
 						lo_message_add_string (rmsg, v->name().c_str());
 					}
 				}
-				lo_send_message (get_address (msg), path, rmsg);
+				send_reply (get_address (msg), path, rmsg);
 				lo_message_free (rmsg);
-				_lo_lock.unlock ();
 				ret = 0;
 			}
 		}
@@ -4248,7 +4296,6 @@ OSC::_strip_parse (const char *path, const char *sub_path, const char* types, lo
 
 	if (ret) {
 		int sid = 0;
-		_lo_lock.lock ();
 		lo_message rmsg = lo_message_new ();
 		if (param_1) {
 			if (types[0] == 'f') {
@@ -4270,9 +4317,8 @@ OSC::_strip_parse (const char *path, const char *sub_path, const char* types, lo
 			//lo_message_add_string (rmsg, val.c_str());
 			lo_message_add_string (rmsg, " ");
 		}
-		lo_send_message (get_address (msg), path, rmsg);
+		send_reply (get_address (msg), path, rmsg);
 		lo_message_free (rmsg);
-		_lo_lock.unlock ();
 	}
 
 	return ret;
@@ -4358,7 +4404,7 @@ OSC::strip_state (const char *path, std::shared_ptr<ARDOUR::Stripable> s, int ss
 	} else {
 		lo_message_add_int32 (reply, -1);
 	}
-	lo_send_message (get_address (msg), X_(path), reply);
+	send_reply (get_address (msg), X_(path), reply);
 	lo_message_free (reply);
 	return 0;
 }
@@ -5379,7 +5425,7 @@ OSC::route_plugin_list (int ssid, lo_message msg) {
 		piid++;
 	}
 
-	lo_send_message (get_address (msg), X_("/strip/plugin/list"), reply);
+	send_reply (get_address (msg), X_("/strip/plugin/list"), reply);
 	lo_message_free (reply);
 	return 0;
 }
@@ -5499,14 +5545,14 @@ OSC::route_plugin_descriptor (int ssid, int piid, lo_message msg) {
 			lo_message_add_double (reply, 0);
 		}
 
-		lo_send_message (get_address (msg), X_("/strip/plugin/descriptor"), reply);
+		send_reply (get_address (msg), X_("/strip/plugin/descriptor"), reply);
 		lo_message_free (reply);
 	}
 
 	lo_message reply = lo_message_new ();
 	lo_message_add_int32 (reply, ssid);
 	lo_message_add_int32 (reply, piid);
-	lo_send_message (get_address (msg), X_("/strip/plugin/descriptor_end"), reply);
+	send_reply (get_address (msg), X_("/strip/plugin/descriptor_end"), reply);
 	lo_message_free (reply);
 
 	return 0;
@@ -6090,6 +6136,7 @@ OSC::periodic (void)
 			bank_dirty = false;
 			tick = true;
 		}
+		flush_bundles ();
 		return true;
 	}
 
@@ -6103,23 +6150,30 @@ OSC::periodic (void)
 			session->request_locate (scrub_place, false, MustStop);
 		}
 	}
+	read_meter_snapshot ();
+
 	for (uint32_t it = 0; it < _surface.size(); it++) {
 		OSCSurface* sur = &_surface[it];
+		// rate limited polled feedback, timeouts count down every tick
+		bool poll = ++sur->tick_count >= sur->feedback_ticks;
+		if (poll) {
+			sur->tick_count = 0;
+		}
 		OSCSelectObserver* so;
 		if ((so = dynamic_cast<OSCSelectObserver*>(sur->sel_obs)) != 0) {
-			so->tick ();
+			so->tick (poll);
 		}
 		OSCCueObserver* co;
 		if ((co = dynamic_cast<OSCCueObserver*>(sur->cue_obs)) != 0) {
-			co->tick ();
+			co->tick (poll);
 		}
 		if (sur->global_obs) {
-			sur->global_obs->tick ();
+			sur->global_obs->tick (poll);
 		}
 		for (uint32_t i = 0; i < sur->observers.size(); i++) {
 			OSCRouteObserver* ro;
 			if ((ro = dynamic_cast<OSCRouteObserver*>(sur->observers[i])) != 0) {
-				ro->tick ();
+				ro->tick (poll);
 			}
 		}
 	}
@@ -6134,6 +6188,7 @@ OSC::periodic (void)
 			x++;
 		}
 	}
+	flush_bundles ();
 	return true;
 }
 
@@ -6150,6 +6205,9 @@ OSC::get_state () const
 	node.set_property (X_("gainmode"), default_gainmode);
 	node.set_property (X_("send-page-size"), default_send_size);
 	node.set_property (X_("plug-page-size"), default_plugin_size);
+	node.set_property (X_("bundle"), default_bundle);
+	node.set_property (X_("feedback-rate"), default_feedback_rate);
+	node.set_property (X_("meter-delta"), _meter_delta);
 	return node;
 }
 
@@ -6172,6 +6230,9 @@ OSC::set_state (const XMLNode& node, int version)
 	node.get_property (X_("gainmode"), default_gainmode);
 	node.get_property (X_("send-page-size"), default_send_size);
 	node.get_property (X_("plugin-page-size"), default_plugin_size);
+	node.get_property (X_("bundle"), default_bundle);
+	node.get_property (X_("feedback-rate"), default_feedback_rate);
+	node.get_property (X_("meter-delta"), _meter_delta);
 
 	global_init = true;
 	tick = false;
@@ -6694,16 +6755,11 @@ OSC::cue_send_enable (uint32_t id, float state, lo_message msg)
 int
 OSC::float_message (string path, float val, lo_address addr)
 {
-	_lo_lock.lock ();
-
 	lo_message reply;
 	reply = lo_message_new ();
 	lo_message_add_float (reply, (float) val);
 
-	lo_send_message (addr, path.c_str(), reply);
-	Glib::usleep(1);
-	lo_message_free (reply);
-	_lo_lock.unlock ();
+	send_message (addr, path.c_str(), reply);
 
 	return 0;
 }
@@ -6711,7 +6767,6 @@ OSC::float_message (string path, float val, lo_address addr)
 int
 OSC::float_message_with_id (std::string path, uint32_t ssid, float value, bool in_line, lo_address addr)
 {
-	_lo_lock.lock ();
 	lo_message msg = lo_message_new ();
 	if (in_line) {
 		path = string_compose ("%1/%2", path, ssid);
@@ -6720,26 +6775,18 @@ OSC::float_message_with_id (std::string path, uint32_t ssid, float value, bool i
 	}
 	lo_message_add_float (msg, value);
 
-	lo_send_message (addr, path.c_str(), msg);
-	Glib::usleep(1);
-	lo_message_free (msg);
-	_lo_lock.unlock ();
+	send_message (addr, path.c_str(), msg);
 	return 0;
 }
 
 int
 OSC::int_message (string path, int val, lo_address addr)
 {
-	_lo_lock.lock ();
-
 	lo_message reply;
 	reply = lo_message_new ();
 	lo_message_add_int32 (reply, (float) val);
 
-	lo_send_message (addr, path.c_str(), reply);
-	Glib::usleep(1);
-	lo_message_free (reply);
-	_lo_lock.unlock ();
+	send_message (addr, path.c_str(), reply);
 
 	return 0;
 }
@@ -6747,7 +6794,6 @@ OSC::int_message (string path, int val, lo_address addr)
 int
 OSC::int_message_with_id (std::string path, uint32_t ssid, int value, bool in_line, lo_address addr)
 {
-	_lo_lock.lock ();
 	lo_message msg = lo_message_new ();
 	if (in_line) {
 		path = string_compose ("%1/%2", path, ssid);
@@ -6756,26 +6802,18 @@ OSC::int_message_with_id (std::string path, uint32_t ssid, int value, bool in_li
 	}
 	lo_message_add_int32 (msg, value);
 
-	lo_send_message (addr, path.c_str(), msg);
-	Glib::usleep(1);
-	lo_message_free (msg);
-	_lo_lock.unlock ();
+	send_message (addr, path.c_str(), msg);
 	return 0;
 }
 
 int
 OSC::text_message (string path, string val, lo_address addr)
 {
-	_lo_lock.lock ();
-
 	lo_message reply;
 	reply = lo_message_new ();
 	lo_message_add_string (reply, val.c_str());
 
-	lo_send_message (addr, path.c_str(), reply);
-	Glib::usleep(1);
-	lo_message_free (reply);
-	_lo_lock.unlock ();
+	send_message (addr, path.c_str(), reply);
 
 	return 0;
 }
@@ -6783,7 +6821,6 @@ OSC::text_message (string path, string val, lo_address addr)
 int
 OSC::text_message_with_id (std::string path, uint32_t ssid, std::string val, bool in_line, lo_address addr)
 {
-	_lo_lock.lock ();
 	lo_message msg = lo_message_new ();
 	if (in_line) {
 		path = string_compose ("%1/%2", path, ssid);
@@ -6793,11 +6830,217 @@ OSC::text_message_with_id (std::string path, uint32_t ssid, std::string val, boo
 
 	lo_message_add_string (msg, val.c_str());
 
-	lo_send_message (addr, path.c_str(), msg);
+	send_message (addr, path.c_str(), msg);
+	return 0;
+}
+
+bool
+OSC::meter_changed (float last, float now) const
+{
+	if (last == now) {
+		return false;
+	}
+	if (last <= -193 || now <= -193) {
+		// signal appears or goes away
+		return true;
+	}
+	return fabsf (now - last) >= _meter_delta;
+}
+
+/* All observers' meters are read from one session meter snapshot
+ * per periodic() tick, rather than from each route's PeakMeter.
+ */
+void
+OSC::read_meter_snapshot ()
+{
+	_meter_index.clear ();
+
+	if (!session->meter_snapshot (_meter_snapshot)) {
+		return;
+	}
+	for (uint32_t r = 0; r < _meter_snapshot.n_routes; ++r) {
+		_meter_index[_meter_snapshot.route_id[r]] = r;
+	}
+}
+
+float
+OSC::meter_level (std::shared_ptr<Stripable> s) const
+{
+	std::map<PBD::ID, uint32_t>::const_iterator r = _meter_index.find (s->id ());
+	if (r != _meter_index.end ()) {
+		return _meter_snapshot.mcp[r->second];
+	}
+	/* not yet published */
+	if (s->peak_meter ()) {
+		return s->peak_meter ()->meter_level (0, MeterMCP);
+	}
+	return -193;
+}
+
+/* Feedback for surfaces with bundling enabled is collected in one
+ * bundle per surface and sent at the end of each periodic() tick,
+ * or earlier when the next message would not fit in a UDP datagram.
+ * All others get one datagram per message.
+ *
+ * This takes ownership of msg.
+ */
+void
+OSC::send_message (lo_address addr, const char* path, lo_message msg)
+{
+	PBD::Mutex::Lock lm (_lo_lock);
+
+	if (!_bundles.empty ()) {
+		char* rurl = lo_address_get_url (addr);
+		PendingBundles::iterator b = _bundles.find (rurl);
+		free (rurl);
+
+		if (b != _bundles.end ()) {
+			if (queue_message (b->second, path, msg)) {
+				return;
+			}
+			// too large for a bundle, keep the order of messages
+			if (b->second.bundle) {
+				send_bundle (b->second);
+			}
+		}
+	}
+
+	lo_send_message (addr, path, msg);
 	Glib::usleep(1);
 	lo_message_free (msg);
-	_lo_lock.unlock ();
-	return 0;
+}
+
+/* Replies to queries are sent right away. Pending feedback for the
+ * surface is sent first, so it does not arrive after the reply.
+ *
+ * Unlike send_message(), this does not take ownership of msg.
+ */
+void
+OSC::send_reply (lo_address addr, const char* path, lo_message msg)
+{
+	PBD::Mutex::Lock lm (_lo_lock);
+
+	if (!_bundles.empty ()) {
+		char* rurl = lo_address_get_url (addr);
+		PendingBundles::iterator b = _bundles.find (rurl);
+		free (rurl);
+
+		if (b != _bundles.end () && b->second.bundle) {
+			send_bundle (b->second);
+		}
+	}
+
+	lo_send_message (addr, path, msg);
+}
+
+// UDP payload of an ethernet frame
+#define OSC_BUNDLE_SIZE 1472
+// "#bundle" string and time tag
+#define OSC_BUNDLE_HEADER_SIZE 16
+
+bool
+OSC::queue_message (PendingBundle& b, const char* path, lo_message msg)
+{
+	// each bundle element is preceded by its size
+	size_t len = lo_message_length (msg, path) + 4;
+
+	if (OSC_BUNDLE_HEADER_SIZE + len > OSC_BUNDLE_SIZE) {
+		// does not fit any bundle, send on its own
+		return false;
+	}
+
+	if (b.bundle && b.size + len > OSC_BUNDLE_SIZE) {
+		send_bundle (b);
+	}
+
+	if (!b.bundle) {
+		lo_timetag now;
+		lo_timetag_now (&now);
+		b.bundle = lo_bundle_new (now);
+		b.size = OSC_BUNDLE_HEADER_SIZE;
+	}
+
+	lo_bundle_add_message (b.bundle, path, msg);
+	b.size += len;
+	return true;
+}
+
+void
+OSC::send_bundle (PendingBundle& b)
+{
+	lo_send_bundle (b.addr, b.bundle);
+	// also frees the messages
+	lo_bundle_free_messages (b.bundle);
+	b.bundle = 0;
+	b.size = 0;
+}
+
+void
+OSC::flush_bundles ()
+{
+	PBD::Mutex::Lock lm (_lo_lock);
+
+	for (PendingBundles::iterator b = _bundles.begin (); b != _bundles.end (); ++b) {
+		if (b->second.bundle) {
+			send_bundle (b->second);
+		}
+	}
+}
+
+void
+OSC::set_bundling (OSCSurface* sur)
+{
+	PBD::Mutex::Lock lm (_lo_lock);
+
+	PendingBundles::iterator b = _bundles.find (sur->remote_url);
+
+	if (sur->bundle) {
+		if (b == _bundles.end ()) {
+			PendingBundle pb;
+			pb.addr = lo_address_new_from_url (sur->remote_url.c_str());
+			pb.bundle = 0;
+			pb.size = 0;
+			_bundles[sur->remote_url] = pb;
+		}
+	} else if (b != _bundles.end ()) {
+		if (b->second.bundle) {
+			send_bundle (b->second);
+		}
+		lo_address_free (b->second.addr);
+		_bundles.erase (b);
+	}
+}
+
+void
+OSC::drop_bundle (std::string const& url)
+{
+	PBD::Mutex::Lock lm (_lo_lock);
+
+	PendingBundles::iterator b = _bundles.find (url);
+
+	if (b == _bundles.end ()) {
+		return;
+	}
+	if (b->second.bundle) {
+		// e.g. the strips cleared by surface_destroy()
+		send_bundle (b->second);
+	}
+	lo_address_free (b->second.addr);
+	_bundles.erase (b);
+}
+
+void
+OSC::clear_bundles ()
+{
+	PBD::Mutex::Lock lm (_lo_lock);
+
+	for (PendingBundles::iterator b = _bundles.begin (); b != _bundles.end (); ++b) {
+		if (b->second.bundle) {
+			send_bundle (b->second);
+		}
+		lo_address_free (b->second.addr);
+	}
+	_bundles.clear ();
 }
 
 // we have to have a sorted list of stripables that have sends pointed at our aux
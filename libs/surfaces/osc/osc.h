@@ -26,6 +26,7 @@
 #define ardour_osc_h
 
 #include <bitset>
+#include <map>
 #include <memory>
 #include <string>
 #include <vector>
@@ -40,6 +41,7 @@
 #include "pbd/abstract_ui.h"
 
 #include "ardour/types.h"
+#include "ardour/meter_snapshot.h"
 #include "ardour/send.h"
 #include "ardour/plugin.h"
 #include "control_protocol/control_protocol.h"
@@ -93,12 +95,17 @@ class OSC : public ARDOUR::ControlProtocol, public AbstractUI<OSCUIRequest>
 
 	// generic osc send
 	PBD::Mutex _lo_lock;
+	void send_reply (lo_address addr, const char* path, lo_message msg);
 	int float_message (std::string, float value, lo_address addr);
 	int int_message (std::string, int value, lo_address addr);
 	int text_message (std::string path, std::string val, lo_address addr);
 	int float_message_with_id (std::string, uint32_t ssid, float value, bool in_line, lo_address addr);
 	int int_message_with_id (std::string, uint32_t ssid, int value, bool in_line, lo_address addr);
 	int text_message_with_id (std::string path, uint32_t ssid, std::string val, bool in_line, lo_address addr);
+	// true if a meter moved enough to be worth sending, see meter_delta
+	bool meter_changed (float last, float now) const;
+	// MCP level of a strip's meter in dBFS, from the snapshot read by periodic()
+	float meter_level (std::shared_ptr<ARDOUR::Stripable>) const;
 
 	int send_group_list (lo_address addr);
 
@@ -168,6 +175,10 @@ class OSC : public ARDOUR::ControlProtocol, public AbstractUI<OSCUIRequest>
 		OSCCueObserver* cue_obs;	// pointer to this surface's cue observer
 		uint32_t linkset;			// ID of a set of surfaces used as one
 		uint32_t linkid;			// ID of this surface within a linkset
+		// feedback rate
+		bool bundle;				// send feedback as OSC bundles, once per tick
+		uint32_t feedback_ticks;	// ticks between polled feedback (meters, position)
+		uint32_t tick_count;		// ticks since polled feedback was last sent
 	};
 		/*
 		 * feedback bits:
@@ -255,6 +266,12 @@ class OSC : public ARDOUR::ControlProtocol, public AbstractUI<OSCUIRequest>
 	void set_send_size (int ss) { default_send_size = ss; }
 	int get_plugin_size() { return default_plugin_size; }
 	void set_plugin_size (int ps) { default_plugin_size = ps; }
+	bool get_bundle() { return default_bundle; }
+	void set_bundle (bool yn) { default_bundle = yn; }
+	int get_feedback_rate() { return default_feedback_rate; }
+	void set_feedback_rate (int fr) { default_feedback_rate = fr; }
+	float get_meter_delta() { return _meter_delta; }
+	void set_meter_delta (float md) { _meter_delta = md; }
 	void clear_devices ();
 	void gui_changed ();
 	void get_surfaces ();
@@ -294,6 +311,12 @@ class OSC : public ARDOUR::ControlProtocol, public AbstractUI<OSCUIRequest>
 	uint32_t default_gainmode;
 	uint32_t default_send_size;
 	uint32_t default_plugin_size;
+	bool default_bundle;
+	uint32_t default_feedback_rate;
+	float _meter_delta;
+	ARDOUR::MeterSnapshot _meter_snapshot;
+	std::map<PBD::ID, uint32_t> _meter_index; // route ID -> index in _meter_snapshot
+	void read_meter_snapshot ();
 	bool tick;
 	bool bank_dirty;
 	bool observer_busy;
@@ -317,6 +340,23 @@ class OSC : public ARDOUR::ControlProtocol, public AbstractUI<OSCUIRequest>
 
 	std::string get_unix_server_url ();
 	lo_address get_address (lo_message msg);
+
+	// outgoing feedback bundles, by surface url
+	struct PendingBundle {
+		lo_address addr;
+		lo_bundle bundle;
+		size_t size;				// serialized size of bundle
+	};
+	typedef std::map<std::string, PendingBundle> PendingBundles;
+	PendingBundles _bundles;
+
+	void send_message (lo_address addr, const char* path, lo_message msg);
+	bool queue_message (PendingBundle& b, const char* path, lo_message msg);
+	void send_bundle (PendingBundle& b);
+	void flush_bundles ();
+	void set_bundling (OSCSurface* sur);
+	void drop_bundle (std::string const& url);
+	void clear_bundles ();
 	std::string get_port (std::string host);
 	OSCSurface * get_surface (lo_address addr, bool quiet = false);
 	int check_surface (lo_message msg);
@@ -710,6 +750,8 @@ class OSC : public ARDOUR::ControlProtocol, public AbstractUI<OSCUIRequest>
 	int set_surface_feedback (uint32_t fb, lo_message msg);
 	int set_surface_gainmode (uint32_t gm, lo_message msg);
 	int set_surface_port (uint32_t po, lo_message msg);
+	int set_surface_bundle (uint32_t yn, lo_message msg);
+	int set_surface_feedback_rate (uint32_t fr, lo_message msg);
 	int refresh_surface (lo_message msg);
 	int custom_clear (lo_message msg);
 	int custom_mode (float state, lo_message msg);
@@ -104,31 +104,33 @@ OSCCueObserver::refresh_strip (std::shared_ptr<ARDOUR::Stripable> new_strip, Sor
 }
 
 void
-OSCCueObserver::tick ()
+OSCCueObserver::tick (bool poll)
 {
 	if (!tick_enable) {
 		return;
 	}
-	float now_meter;
-	if (_strip->peak_meter()) {
-		now_meter = _strip->peak_meter()->meter_level(0, MeterMCP);
-	} else {
-		now_meter = -193;
-	}
-	if (now_meter < -120) now_meter = -193;
-	if (_last_meter != now_meter) {
-		float signal;
-		if (now_meter < -45) {
-			signal = 0;
+	if (poll) {
+		float now_meter;
+		if (_strip->peak_meter()) {
+			now_meter = _osc.meter_level (_strip);
 		} else {
-			signal = 1;
+			now_meter = -193;
 		}
-		if (_last_signal != signal) {
-			_osc.float_message (X_("/cue/signal"), signal, addr);
-			_last_signal = signal;
+		if (now_meter < -120) now_meter = -193;
+		if (_last_meter != now_meter) {
+			float signal;
+			if (now_meter < -45) {
+				signal = 0;
+			} else {
+				signal = 1;
+			}
+			if (_last_signal != signal) {
+				_osc.float_message (X_("/cue/signal"), signal, addr);
+				_last_signal = signal;
+			}
 		}
+		_last_meter = now_meter;
 	}
-	_last_meter = now_meter;
 
 	for (uint32_t i = 0; i < gain_timeout.size(); i++) {
 		if (gain_timeout[i]) {
@@ -41,7 +41,8 @@ class OSCCueObserver
 
 	std::shared_ptr<ARDOUR::Stripable> strip () const { return _strip; }
 	lo_address address() const { return addr; };
-	void tick (void);
+	// poll: also send meters and other polled values
+	void tick (bool poll = true);
 	typedef std::vector<std::shared_ptr<ARDOUR::Stripable> > Sorted;
 	Sorted sends;
 	void clear_observer (void);
@@ -0,0 +1,234 @@
+/*
+ * Copyright (C) 2026 Ardour Developers
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/* Loopback OSC receiver, measures the feedback an Ardour session with
+ * the OSC surface enabled sends to a single surface.
+ *
+ * It registers itself as a surface with the given feedback settings,
+ * then counts datagrams, bundles, messages and bytes received.
+ *
+ * usage: osc-feedback-bench [-H host] [-p port] [-d seconds] [-f feedback]
+ *                           [-s strip-types] [-b] [-r feedback-rate]
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include <arpa/inet.h>
+#include <getopt.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <lo/lo.h>
+
+#include "pbd/microseconds.h"
+
+struct Stats {
+	uint64_t datagrams;
+	uint64_t bundles;
+	uint64_t messages;
+	uint64_t bytes;
+};
+
+static Stats stats;
+
+static uint32_t
+read_be32 (unsigned char const* p)
+{
+	return ((uint32_t)p[0] << 24) | (p[1] << 16) | (p[2] << 8) | p[3];
+}
+
+static void
+count_packet (unsigned char const* buf, size_t len)
+{
+	if (len < 16 || memcmp (buf, "#bundle", 8)) {
+		++stats.messages;
+		return;
+	}
+
+	++stats.bundles;
+
+	/* "#bundle", time tag, then size prefixed elements */
+	for (size_t off = 16; off + 4 <= len;) {
+		uint32_t size = read_be32 (buf + off);
+		off += 4;
+		if (size == 0 || off + size > len) {
+			break;
+		}
+		count_packet (buf + off, size);
+		off += size;
+	}
+}
+
+static int
+send_msg (int sock, struct sockaddr_in const& to, const char* path, lo_message msg)
+{
+	size_t size = 0;
+	void*  data = lo_message_serialise (msg, path, NULL, &size);
+	int    rv   = sendto (sock, data, size, 0, (struct sockaddr const*)&to, sizeof (to));
+	free (data);
+	lo_message_free (msg);
+	return rv == (int)size ? 0 : -1;
+}
+
+static int
+send_int (int sock, struct sockaddr_in const& to, const char* path, int val)
+{
+	lo_message msg = lo_message_new ();
+	lo_message_add_int32 (msg, val);
+	return send_msg (sock, to, path, msg);
+}
+
+static void
+receive (int sock, PBD::microseconds_t duration)
+{
+	unsigned char buf[65536];
+
+	PBD::microseconds_t const t0 = PBD::get_microseconds ();
+	while (PBD::get_microseconds () - t0 < duration) {
+		struct pollfd pfd;
+		pfd.fd     = sock;
+		pfd.events = POLLIN;
+		if (poll (&pfd, 1, 50) <= 0) {
+			continue;
+		}
+		ssize_t len = recv (sock, buf, sizeof (buf), 0);
+		if (len > 0) {
+			++stats.datagrams;
+			stats.bytes += len;
+			count_packet (buf, len);
+		}
+	}
+}
+
+static void
+usage ()
+{
+	printf ("usage: osc-feedback-bench [-H host] [-p port] [-d seconds] [-f feedback] [-s strip-types] [-b] [-r feedback-rate]\n");
+}
+
+int
+main (int argc, char** argv)
+{
+	const char* host        = "127.0.0.1";
+	int         port        = 3819;
+	int         duration    = 10;
+	int         feedback    = 1 | 2 | 128; // buttons, faders, meters in dB
+	int         strip_types = 31;          // tracks, busses and VCAs
+	bool        bundle      = false;
+	int         rate        = 10;
+
+	int c;
+	while ((c = getopt (argc, argv, "H:p:d:f:s:br:h")) != -1) {
+		switch (c) {
+			case 'H':
+				host = optarg;
+				break;
+			case 'p':
+				port = atoi (optarg);
+				break;
+			case 'd':
+				duration = atoi (optarg) > 0 ? atoi (optarg) : 1;
+				break;
+			case 'f':
+				feedback = atoi (optarg);
+				break;
+			case 's':
+				strip_types = atoi (optarg);
+				break;
+			case 'b':
+				bundle = true;
+				break;
+			case 'r':
+				rate = atoi (optarg);
+				break;
+			default:
+				usage ();
+				return c == 'h' ? 0 : 1;
+		}
+	}
+
+	struct sockaddr_in to;
+	memset (&to, 0, sizeof (to));
+	to.sin_family = AF_INET;
+	to.sin_port   = htons (port);
+	if (inet_pton (AF_INET, host, &to.sin_addr) != 1) {
+		fprintf (stderr, "invalid IPv4 address: %s\n", host);
+		return 1;
+	}
+
+	int sock = socket (AF_INET, SOCK_DGRAM, 0);
+	if (sock < 0) {
+		perror ("socket");
+		return 1;
+	}
+
+	/* Ardour replies to the port messages are sent from */
+	struct sockaddr_in local;
+	memset (&local, 0, sizeof (local));
+	local.sin_family      = AF_INET;
+	local.sin_addr.s_addr = htonl (INADDR_ANY);
+	if (bind (sock, (struct sockaddr*)&local, sizeof (local))) {
+		perror ("bind");
+		close (sock);
+		return 1;
+	}
+
+	send_int (sock, to, "/set_surface/bundle", bundle ? 1 : 0);
+	send_int (sock, to, "/set_surface/feedback_rate", rate);
+
+	/* bank size (0: all strips), strip types, feedback, gainmode (dB) */
+	lo_message msg = lo_message_new ();
+	lo_message_add_int32 (msg, 0);
+	lo_message_add_int32 (msg, strip_types);
+	lo_message_add_int32 (msg, feedback);
+	lo_message_add_int32 (msg, 0);
+	if (send_msg (sock, to, "/set_surface", msg)) {
+		perror ("send");
+		close (sock);
+		return 1;
+	}
+
+	/* skip initial feedback of all strips */
+	receive (sock, 1000000);
+
+	if (stats.datagrams == 0) {
+		fprintf (stderr, "no feedback received from %s:%d\n", host, port);
+		close (sock);
+		return 1;
+	}
+
+	memset (&stats, 0, sizeof (stats));
+	receive (sock, duration * 1000000LL);
+
+	send_int (sock, to, "/set_surface/feedback", 0);
+	close (sock);
+
+	printf ("bundles: %s, feedback rate: %d/s, feedback: %d, strip types: %d, %d sec\n",
+	        bundle ? "yes" : "no", rate, feedback, strip_types, duration);
+	printf ("%8.1f datagrams/s, %8.1f bundles/s, %8.1f messages/s, %8.1f kB/s, %.1f messages per datagram\n",
+	        stats.datagrams / (double)duration, stats.bundles / (double)duration,
+	        stats.messages / (double)duration, stats.bytes / 1024. / duration,
+	        stats.datagrams ? stats.messages / (double)stats.datagrams : 0.);
+
+	return 0;
+}
@@ -240,13 +240,13 @@ OSCGlobalObserver::update_mixer_scene_state ()
 }
 
 void
-OSCGlobalObserver::tick ()
+OSCGlobalObserver::tick (bool poll)
 {
 	if (_init) {
 		return;
 	}
-	samplepos_t now_sample = session->transport_sample();
-	if (feedback[15]) { // trigger grid status
+	samplepos_t now_sample = poll ? session->transport_sample() : _last_sample;
+	if (poll && feedback[15]) { // trigger grid status
 		if (_heartbeat == 0) {
 			_osc.trigger_grid_state(addr);
 			_osc.trigger_bank_state(addr);
@@ -329,11 +329,11 @@ OSCGlobalObserver::tick ()
 			_osc.float_message (X_("/heartbeat"), 0.0, addr);
 		}
 	}
-	if (feedback[7] || feedback[8] || feedback[9]) { // meters enabled
+	if (poll && (feedback[7] || feedback[8] || feedback[9])) { // meters enabled
 		// the only meter here is master
-		float now_meter = session->master_out()->peak_meter()->meter_level(0, MeterMCP);
+		float now_meter = _osc.meter_level (session->master_out());
 		if (now_meter < -94) now_meter = -193;
-		if (_last_meter != now_meter) {
+		if (_osc.meter_changed (_last_meter, now_meter)) {
 			if (feedback[7] || feedback[8]) {
 				if (gainmode && feedback[7]) {
 					// change from db to 0-1
@@ -355,8 +355,8 @@ OSCGlobalObserver::tick ()
 				}
 				_osc.float_message (X_("/master/signal"), signal, addr);
 			}
+			_last_meter = now_meter;
 		}
-		_last_meter = now_meter;
 
 	}
 	if (feedback[4]) {
@@ -58,7 +58,8 @@ class OSCGlobalObserver
 	~OSCGlobalObserver ();
 
 	lo_address address() const { return addr; };
-	void tick (void);
+	// poll: also send meters and other polled values
+	void tick (bool poll = true);
 	void clear_observer (void);
 	void jog_mode (uint32_t jogmode);
 
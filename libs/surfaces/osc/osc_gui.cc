@@ -145,6 +145,35 @@ OSC_GUI::OSC_GUI (OSC& p)
 	gainmode_combo.set_active ((int)cp.get_gainmode());
 	++n;
 
+	// feedback bundles
+	label = manage (new Gtk::Label(_("Bundle Feedback:")));
+	label->set_alignment(1, .5);
+	table->attach (*label, 0, 1, n, n+1, AttachOptions(FILL|EXPAND), AttachOptions(0));
+	table->attach (bundle_button, 1, 2, n, n+1, AttachOptions(FILL|EXPAND), AttachOptions(0), 0, 0);
+	bundle_button.set_active (cp.get_bundle());
+	++n;
+
+	// polled feedback rate
+	label = manage (new Gtk::Label(_("Meter/Position Updates per Second:")));
+	label->set_alignment(1, .5);
+	table->attach (*label, 0, 1, n, n+1, AttachOptions(FILL|EXPAND), AttachOptions(0));
+	table->attach (feedback_rate_entry, 1, 2, n, n+1, AttachOptions(FILL|EXPAND), AttachOptions(0), 0, 0);
+	feedback_rate_entry.set_range (1, 10);
+	feedback_rate_entry.set_increments (1, 5);
+	feedback_rate_entry.set_value (cp.get_feedback_rate());
+	++n;
+
+	// smallest meter change sent
+	label = manage (new Gtk::Label(_("Meter Change Threshold (dB):")));
+	label->set_alignment(1, .5);
+	table->attach (*label, 0, 1, n, n+1, AttachOptions(FILL|EXPAND), AttachOptions(0));
+	table->attach (meter_delta_entry, 1, 2, n, n+1, AttachOptions(FILL|EXPAND), AttachOptions(0), 0, 0);
+	meter_delta_entry.set_digits (1);
+	meter_delta_entry.set_range (0, 20);
+	meter_delta_entry.set_increments (.5, 3);
+	meter_delta_entry.set_value (cp.get_meter_delta());
+	++n;
+
 	// debug setting
 	label = manage (new Gtk::Label(_("Debug:")));
 	label->set_alignment(1, .5);
@@ -193,6 +222,9 @@ OSC_GUI::OSC_GUI (OSC& p)
 	bank_entry.signal_changed().connect (sigc::mem_fun (*this, &OSC_GUI::bank_changed));
 	send_page_entry.signal_changed().connect (sigc::mem_fun (*this, &OSC_GUI::send_page_changed));
 	plugin_page_entry.signal_changed().connect (sigc::mem_fun (*this, &OSC_GUI::plugin_page_changed));
+	bundle_button.signal_clicked().connect (sigc::mem_fun (*this, &OSC_GUI::bundle_changed));
+	feedback_rate_entry.signal_changed().connect (sigc::mem_fun (*this, &OSC_GUI::feedback_rate_changed));
+	meter_delta_entry.signal_changed().connect (sigc::mem_fun (*this, &OSC_GUI::meter_delta_changed));
 
 	// Strip Types Calculate Page
 	int stn = 0; // table row
@@ -591,6 +623,27 @@ OSC_GUI::plugin_page_changed ()
 
 }
 
+void
+OSC_GUI::bundle_changed ()
+{
+	cp.set_bundle (bundle_button.get_active ());
+	save_user ();
+}
+
+void
+OSC_GUI::feedback_rate_changed ()
+{
+	cp.set_feedback_rate (feedback_rate_entry.get_value_as_int ());
+	save_user ();
+}
+
+void
+OSC_GUI::meter_delta_changed ()
+{
+	cp.set_meter_delta (meter_delta_entry.get_value ());
+	save_user ();
+}
+
 void
 OSC_GUI::gainmode_changed ()
 {
@@ -655,6 +708,12 @@ OSC_GUI::factory_reset ()
 	reshow_values ();
 	cp.set_gainmode (0);
 	gainmode_combo.set_active (0);
+	cp.set_bundle (false);
+	bundle_button.set_active (false);
+	cp.set_feedback_rate (10);
+	feedback_rate_entry.set_value (10);
+	cp.set_meter_delta (0);
+	meter_delta_entry.set_value (0);
 	cp.set_portmode (1);
 	portmode_combo.set_active (1);
 	cp.set_remote_port ("8000");
@@ -917,6 +976,18 @@ OSC_GUI::save_user ()
 	child->set_property ("value", cp.get_gainmode());
 	node->add_child_nocopy (*child);
 
+	child = new XMLNode ("Bundle");
+	child->set_property ("value", cp.get_bundle());
+	node->add_child_nocopy (*child);
+
+	child = new XMLNode ("Feedback-Rate");
+	child->set_property ("value", cp.get_feedback_rate());
+	node->add_child_nocopy (*child);
+
+	child = new XMLNode ("Meter-Delta");
+	child->set_property ("value", cp.get_meter_delta());
+	node->add_child_nocopy (*child);
+
 	XMLTree tree;
 	tree.set_root (node);
 
@@ -1013,6 +1084,24 @@ OSC_GUI::load_preset (std::string preset)
 			cp.set_gainmode (atoi (prop->value().c_str()));
 			gainmode_combo.set_active (atoi (prop->value().c_str()));
 		}
+		bool bundle = sesn_bundle;
+		if ((child = root->child ("Bundle")) != 0) {
+			child->get_property ("value", bundle);
+		}
+		cp.set_bundle (bundle);
+		bundle_button.set_active (bundle);
+		uint32_t feedback_rate = sesn_feedback_rate;
+		if ((child = root->child ("Feedback-Rate")) != 0) {
+			child->get_property ("value", feedback_rate);
+		}
+		cp.set_feedback_rate (feedback_rate);
+		feedback_rate_entry.set_value (feedback_rate);
+		float meter_delta = sesn_meter_delta;
+		if ((child = root->child ("Meter-Delta")) != 0) {
+			child->get_property ("value", meter_delta);
+		}
+		cp.set_meter_delta (meter_delta);
+		meter_delta_entry.set_value (meter_delta);
 		cp.gui_changed();
 		clear_device ();
 
@@ -1030,6 +1119,9 @@ OSC_GUI::get_session ()
 	sesn_strips = cp.get_defaultstrip ();
 	sesn_feedback = cp.get_defaultfeedback ();
 	sesn_gainmode = cp.get_gainmode ();
+	sesn_bundle = cp.get_bundle ();
+	sesn_feedback_rate = cp.get_feedback_rate ();
+	sesn_meter_delta = cp.get_meter_delta ();
 }
 
 void
@@ -1050,4 +1142,10 @@ OSC_GUI::restore_sesn_values ()
 	reshow_values ();
 	cp.set_gainmode (sesn_gainmode);
 	gainmode_combo.set_active (sesn_gainmode);
+	cp.set_bundle (sesn_bundle);
+	bundle_button.set_active (sesn_bundle);
+	cp.set_feedback_rate (sesn_feedback_rate);
+	feedback_rate_entry.set_value (sesn_feedback_rate);
+	cp.set_meter_delta (sesn_meter_delta);
+	meter_delta_entry.set_value (sesn_meter_delta);
 }
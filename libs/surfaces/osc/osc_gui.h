@@ -50,6 +50,9 @@ private:
 	Gtk::SpinButton send_page_entry;
 	Gtk::SpinButton plugin_page_entry;
 	Gtk::ComboBoxText gainmode_combo;
+	Gtk::CheckButton bundle_button;
+	Gtk::SpinButton feedback_rate_entry;
+	Gtk::SpinButton meter_delta_entry;
 	Gtk::ComboBoxText preset_combo;
 	std::vector<std::string> preset_options;
 	std::map<std::string,std::string> preset_files;
@@ -64,6 +67,9 @@ private:
 	uint32_t sesn_strips;
 	uint32_t sesn_feedback;
 	uint32_t sesn_gainmode;
+	bool sesn_bundle;
+	uint32_t sesn_feedback_rate;
+	float sesn_meter_delta;
 	void save_user ();
 	void scan_preset_files ();
 	void load_preset (std::string preset);
@@ -79,6 +85,9 @@ private:
 	void bank_changed ();
 	void send_page_changed ();
 	void plugin_page_changed ();
+	void bundle_changed ();
+	void feedback_rate_changed ();
+	void meter_delta_changed ();
 	void strips_changed ();
 	void feedback_changed ();
 	void preset_changed ();
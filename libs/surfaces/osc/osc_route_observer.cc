@@ -114,8 +114,8 @@ void
 OSCRouteObserver::refresh_strip (std::shared_ptr<ARDOUR::Stripable> new_strip, bool force)
 {
 	_init = true;
-	if (_tick_busy) {
-		Glib::usleep(100); // let tick finish
+	{
+		PBD::Mutex::Lock lm (_tick_lock); // let tick finish
 	}
 	_last_gain =-1.0;
 	_last_trim =-1.0;
@@ -227,8 +227,8 @@ void
 OSCRouteObserver::refresh_send (std::shared_ptr<ARDOUR::Send> new_send, bool force)
 {
 	_init = true;
-	if (_tick_busy) {
-		Glib::usleep(100); // let tick finish
+	{
+		PBD::Mutex::Lock lm (_tick_lock); // let tick finish
 	}
 	_last_gain =-1.0;
 	_last_trim =-1.0;
@@ -374,25 +374,25 @@ OSCRouteObserver::send_clear ()
 
 
 void
-OSCRouteObserver::tick ()
+OSCRouteObserver::tick (bool poll)
 {
 	if (_init) {
 		return;
 	}
-	_tick_busy = true;
-	if (feedback[7] || feedback[8] || feedback[9]) { // meters enabled
+	PBD::Mutex::Lock lm (_tick_lock);
+	if (poll && (feedback[7] || feedback[8] || feedback[9])) { // meters enabled
 		// the only meter here is master
 		/* XXXX need to add send meter for send mode or
 		 * disable for send mode
 		 */
 		float now_meter;
 		if (_strip->peak_meter()) {
-			now_meter = _strip->peak_meter()->meter_level(0, MeterMCP);
+			now_meter = _osc.meter_level (_strip);
 		} else {
 			now_meter = -193;
 		}
 		if (now_meter < -120) now_meter = -193;
-		if (_last_meter != now_meter) {
+		if (_osc.meter_changed (_last_meter, now_meter)) {
 			if (feedback[7] || feedback[8]) {
 				if (gainmode && feedback[7]) {
 					_osc.float_message_with_id (X_("/strip/meter"), ssid, ((now_meter + 94) / 100), in_line, addr);
@@ -413,8 +413,8 @@ OSCRouteObserver::tick ()
 				}
 				_osc.float_message_with_id (X_("/strip/signal"), ssid, signal, in_line, addr);
 			}
+			_last_meter = now_meter;
 		}
-		_last_meter = now_meter;
 
 	}
 	if (feedback[1]) {
@@ -425,7 +425,6 @@ OSCRouteObserver::tick ()
 			gain_timeout--;
 		}
 	}
-	_tick_busy = false;
 }
 
 void
@@ -44,7 +44,8 @@ class OSCRouteObserver
 	std::shared_ptr<ARDOUR::Stripable> strip () const { return _strip; }
 	uint32_t strip_id () const { return ssid; }
 	lo_address address () const { return addr; };
-	void tick (void);
+	// poll: also send meters and other polled values
+	void tick (bool poll = true);
 	void send_select_status (const PBD::PropertyChange&);
 	void refresh_strip (std::shared_ptr<ARDOUR::Stripable> strip, bool force);
 	void refresh_send (std::shared_ptr<ARDOUR::Send> send, bool force);
@@ -75,7 +76,7 @@ class OSCRouteObserver
 	uint32_t _expand;
 	bool in_line;
 	ARDOUR::AutoState as;
-	bool _tick_busy;
+	PBD::Mutex _tick_lock;
 	std::shared_ptr<ARDOUR::PannerShell> current_pan_shell;
 
 	void send_clear ();
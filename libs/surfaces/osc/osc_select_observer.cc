@@ -123,8 +123,8 @@ void
 OSCSelectObserver::refresh_strip (std::shared_ptr<ARDOUR::Stripable> new_strip, uint32_t s_nsends, uint32_t gm, bool force)
 {
 	_init = true;
-	if (_tick_busy) {
-		Glib::usleep(100); // let tick finish
+	{
+		PBD::Mutex::Lock lm (_tick_lock); // let tick finish
 	}
 	gainmode = gm;
 
@@ -576,21 +576,21 @@ OSCSelectObserver::plugin_end ()
 }
 
 void
-OSCSelectObserver::tick ()
+OSCSelectObserver::tick (bool poll)
 {
 	if (_init) {
 		return;
 	}
-	_tick_busy = true;
-	if (feedback[7] || feedback[8] || feedback[9]) { // meters enabled
+	PBD::Mutex::Lock lm (_tick_lock);
+	if (poll && (feedback[7] || feedback[8] || feedback[9])) { // meters enabled
 		float now_meter;
 		if (_strip->peak_meter()) {
-			now_meter = _strip->peak_meter()->meter_level(0, MeterMCP);
+			now_meter = _osc.meter_level (_strip);
 		} else {
 			now_meter = -193;
 		}
 		if (now_meter < -120) now_meter = -193;
-		if (_last_meter != now_meter) {
+		if (_osc.meter_changed (_last_meter, now_meter)) {
 			if (feedback[7] || feedback[8]) {
 				string path = X_("/select/meter");
 				if (gainmode && feedback[7]) {
@@ -613,8 +613,8 @@ OSCSelectObserver::tick ()
 				}
 				_osc.float_message (path, signal, addr);
 			}
+			_last_meter = now_meter;
 		}
-		_last_meter = now_meter;
 
 	}
 	if (gain_timeout) {
@@ -624,13 +624,13 @@ OSCSelectObserver::tick ()
 		gain_timeout--;
 	}
 
-	if (as == ARDOUR::Play ||  as == ARDOUR::Touch) {
+	if (poll && (as == ARDOUR::Play ||  as == ARDOUR::Touch)) {
 		if(_last_gain != _strip->gain_control()->get_value()) {
 			_last_gain = _strip->gain_control()->get_value();
 				gain_message ();
 		}
 	}
-	if (_strip->mapped_output (Comp_Redux) && _strip->mapped_control (Comp_Enable) && _strip->mapped_control (Comp_Enable)->get_value()) {
+	if (poll && _strip->mapped_output (Comp_Redux) && _strip->mapped_control (Comp_Enable) && _strip->mapped_control (Comp_Enable)->get_value()) {
 		float new_value = _strip->mapped_output (Comp_Redux)->get_parameter();
 		if (_comp_redux != new_value) {
 			_osc.float_message (X_("/select/comp_redux"), new_value, addr);
@@ -646,7 +646,6 @@ OSCSelectObserver::tick ()
 			send_timeout[i]--;
 		}
 	}
-	_tick_busy = false;
 }
 
 void
@@ -1188,6 +1187,6 @@ OSCSelectObserver::slaved_changed (std::shared_ptr<VCA> vca, bool state)
 			lo_message_add_string (reply, name.c_str());
 		}
 	}
-	lo_send_message (addr, X_("/select/vcas"), reply);
+	_osc.send_reply (addr, X_("/select/vcas"), reply);
 	lo_message_free (reply);
 }
@@ -44,7 +44,8 @@ class OSCSelectObserver
 
 	std::shared_ptr<ARDOUR::Stripable> strip () const { return _strip; }
 	lo_address address() const { return addr; };
-	void tick (void);
+	// poll: also send meters and other polled values
+	void tick (bool poll = true);
 	void renew_sends (void);
 	void renew_plugin (void);
 	void eq_restart (int);
@@ -98,7 +99,7 @@ class OSCSelectObserver
 	int eq_bands;
 	uint32_t _expand;
 	std::bitset<16> _group_sharing;
-	bool _tick_busy;
+	PBD::Mutex _tick_lock;
 	ARDOUR::Session* session;
 
 	void name_changed (const PBD::PropertyChange& what_changed);
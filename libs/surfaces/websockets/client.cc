@@ -16,6 +16,8 @@
  * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
  */
 
+#include <algorithm>
+#include <cmath>
 #include <sstream>
 
 #include "client.h"
@@ -58,6 +60,42 @@ ClientContext::update_state (const NodeState& node_state)
 	_state.insert (node_state);
 }
 
+void
+ClientContext::set_meter_feed (MeterFeed feed, float threshold_db)
+{
+	_meter_feed      = feed;
+	_meter_threshold = std::max (0.f, threshold_db);
+
+	/* next frame includes all strips */
+	_meter_sent.clear ();
+	_meter_frame.clear ();
+}
+
+bool
+ClientContext::update_meters (const MeterFrame& frame)
+{
+	for (MeterFrame::Levels::const_iterator it = frame.levels ().begin (); it != frame.levels ().end (); ++it) {
+		float const db = it->second;
+
+		std::map<uint32_t, float>::iterator s = _meter_sent.find (it->first);
+
+		if (s != _meter_sent.end ()) {
+			if (s->second == db) {
+				continue;
+			}
+			/* always send transitions from/to -inf (silence) */
+			if (std::isfinite (s->second) && std::isfinite (db) && fabsf (s->second - db) < _meter_threshold) {
+				continue;
+			}
+		}
+
+		_meter_sent[it->first] = db;
+		_meter_frame.set (it->first, db);
+	}
+
+	return !_meter_frame.empty ();
+}
+
 std::string
 ClientContext::debug_str ()
 {
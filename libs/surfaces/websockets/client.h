@@ -19,10 +19,12 @@
 #ifndef _ardour_surface_websockets_client_h_
 #define _ardour_surface_websockets_client_h_
 
+#include <map>
 #include <set>
 #include <list>
 
 #include "message.h"
+#include "meter_frame.h"
 #include "state.h"
 
 typedef struct lws* Client;
@@ -34,8 +36,17 @@ typedef std::list<NodeStateMessage> ClientOutputBuffer;
 class ClientContext
 {
 public:
+	/* how strip meters are sent, negotiated by Node::meter_feed */
+	enum MeterFeed {
+		MeterFeedStrip,  // one strip_meter message per strip (default)
+		MeterFeedBatch,  // one strip_meters JSON message per poll
+		MeterFeedBinary  // one binary MeterFrame per poll
+	};
+
 	ClientContext (Client wsi)
-	    : _wsi (wsi){};
+	    : _wsi (wsi)
+	    , _meter_feed (MeterFeedStrip)
+	    , _meter_threshold (0){};
 	virtual ~ClientContext (){};
 
 	Client wsi () const
@@ -51,6 +62,22 @@ public:
 		return _output_buf;
 	}
 
+	MeterFeed meter_feed () const
+	{
+		return _meter_feed;
+	}
+
+	void set_meter_feed (MeterFeed, float threshold_db);
+
+	/* queue levels that changed by at least the threshold since they
+	 * were last queued, returns true if a meter frame is pending */
+	bool update_meters (const MeterFrame&);
+
+	MeterFrame& meter_frame ()
+	{
+		return _meter_frame;
+	}
+
 	std::string debug_str ();
 
 private:
@@ -60,6 +87,11 @@ private:
 	ClientState                 _state;
 
 	ClientOutputBuffer _output_buf;
+
+	MeterFeed                 _meter_feed;
+	float                     _meter_threshold;
+	std::map<uint32_t, float> _meter_sent;
+	MeterFrame                _meter_frame;
 };
 
 } // namespace ArdourSurface
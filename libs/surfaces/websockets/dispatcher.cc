@@ -36,7 +36,8 @@ WebsocketsDispatcher::NodeMethodMap
 		NODE_METHOD_PAIR (strip_pan),
 		NODE_METHOD_PAIR (strip_mute),
 		NODE_METHOD_PAIR (strip_plugin_enable),
-		NODE_METHOD_PAIR (strip_plugin_param_value)
+		NODE_METHOD_PAIR (strip_plugin_param_value),
+		NODE_METHOD_PAIR (meter_feed)
 	};
 
 void
@@ -266,6 +267,32 @@ WebsocketsDispatcher::strip_plugin_param_value_handler (Client client, const Nod
 	}
 }
 
+void
+WebsocketsDispatcher::meter_feed_handler (Client client, const NodeStateMessage& msg)
+{
+	const NodeState& state = msg.state ();
+
+	/* val = [ "strip" | "batch" | "binary", threshold dB (optional) ] */
+	if (state.n_val () < 1) {
+		return;
+	}
+
+	std::string mode      = state.nth_val (0);
+	double      threshold = (state.n_val () > 1) ? static_cast<double> (state.nth_val (1)) : 0;
+
+	ClientContext::MeterFeed feed;
+
+	if (mode == "batch") {
+		feed = ClientContext::MeterFeedBatch;
+	} else if (mode == "binary") {
+		feed = ClientContext::MeterFeedBinary;
+	} else {
+		feed = ClientContext::MeterFeedStrip;
+	}
+
+	server ().set_meter_feed (client, feed, threshold);
+}
+
 void
 WebsocketsDispatcher::update (Client client, std::string node, TypedValue val1)
 {
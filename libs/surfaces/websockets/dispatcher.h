@@ -51,6 +51,7 @@ private:
 	void strip_mute_handler (Client, const NodeStateMessage&);
 	void strip_plugin_enable_handler (Client, const NodeStateMessage&);
 	void strip_plugin_param_value_handler (Client, const NodeStateMessage&);
+	void meter_feed_handler (Client, const NodeStateMessage&);
 
 	void update (Client, std::string, TypedValue);
 	void update (Client, std::string, uint32_t, TypedValue);
@@ -214,11 +214,30 @@ ArdourFeedback::poll () const
 
 	PBD::Mutex::Lock lock (mixer ().mutex ());
 
+	/* read all meters once, the server sends them to each client
+	 * either per strip or batched, see ClientContext::MeterFeed */
+	_meter_levels.clear ();
+
+	_meter_index.clear ();
+
+	if (session ().meter_snapshot (_meter_snapshot)) {
+		for (uint32_t r = 0; r < _meter_snapshot.n_routes; ++r) {
+			_meter_index[_meter_snapshot.route_id[r]] = r;
+		}
+	}
+
 	for (ArdourMixer::StripMap::iterator it = mixer ().strips ().begin (); it != mixer ().strips ().end (); ++it) {
-		double db = it->second->meter_level_db ();
-		update_all (Node::strip_meter, it->first, db);
+		std::map<PBD::ID, uint32_t>::const_iterator r = _meter_index.find (it->second->stripable ()->id ());
+		if (r != _meter_index.end ()) {
+			_meter_levels.set (it->first, _meter_snapshot.mcp[r->second]);
+		} else {
+			/* not a route (e.g. VCA) or not yet published */
+			_meter_levels.set (it->first, it->second->meter_level_db ());
+		}
 	}
 
+	server ().update_all_clients_meters (_meter_levels);
+
 	return true;
 }
 
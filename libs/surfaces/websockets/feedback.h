@@ -19,12 +19,16 @@
 #ifndef _ardour_surface_websockets_feedback_h_
 #define _ardour_surface_websockets_feedback_h_
 
+#include <map>
 #include <memory>
 
 #include "pbd/abstract_ui.h"
 #include "pbd/mutex.h"
 
+#include "ardour/meter_snapshot.h"
+
 #include "component.h"
+#include "meter_frame.h"
 #include "typed_value.h"
 #include "mixer.h"
 
@@ -59,6 +63,9 @@ private:
 	PBD::Mutex      _client_state_lock;
 	PBD::ScopedConnectionList _transport_connections;
 	sigc::connection          _periodic_connection;
+	mutable MeterFrame        _meter_levels;
+	mutable ARDOUR::MeterSnapshot _meter_snapshot;
+	mutable std::map<PBD::ID, uint32_t> _meter_index; // route ID -> index in _meter_snapshot
 
 	// Only needed for server event loop integration method #3
 	mutable FeedbackHelperUI  _helper;
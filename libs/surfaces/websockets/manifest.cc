@@ -60,6 +60,10 @@ SurfaceManifest::SurfaceManifest (std::string path)
 			_description = value;
 		} else if (name == "Version") {
 			_version = value;
+		} else if (name == "Meters") {
+			_meters = value;
+		} else if (name == "MeterThreshold") {
+			_meter_threshold = value;
 		}
 	}
 
@@ -82,8 +86,17 @@ SurfaceManifest::to_json ()
 		<< "\"path\":\"" << WebSocketsJSON::escape (Glib::path_get_basename (_path)) << "\""
 		<< ",\"name\":\"" << WebSocketsJSON::escape (_name) << "\""
 		<< ",\"description\":\"" << WebSocketsJSON::escape (_description) << "\""
-		<< ",\"version\":\"" << WebSocketsJSON::escape (_version) << "\""
-		<< "}";
+		<< ",\"version\":\"" << WebSocketsJSON::escape (_version) << "\"";
+
+	if (!_meters.empty ()) {
+		ss << ",\"meters\":\"" << WebSocketsJSON::escape (_meters) << "\"";
+	}
+
+	if (!_meter_threshold.empty ()) {
+		ss << ",\"meterthreshold\":\"" << WebSocketsJSON::escape (_meter_threshold) << "\"";
+	}
+
+	ss << "}";
 
 	return ss.str ();
 }
@@ -36,6 +36,10 @@ public:
 	std::string description () { return _description; }
 	std::string version () { return _version; }
 
+	// optional, meter feed requested by the surface's client on connect
+	std::string meters () { return _meters; }
+	std::string meter_threshold () { return _meter_threshold; }
+
 	std::string to_json ();
 
 	static bool exists_at_path (std::string);
@@ -47,6 +51,8 @@ private:
 	std::string _name;
 	std::string _description;
 	std::string _version;
+	std::string _meters;
+	std::string _meter_threshold;
 };
 
 } // namespace ArdourSurface
@@ -23,6 +23,7 @@
 #include <boost/property_tree/json_parser.hpp>
 #include <boost/property_tree/ptree.hpp>
 #include <sstream>
+#include <stdexcept>
 
 #include "message.h"
 #include "json.h"
@@ -72,7 +73,13 @@ NodeStateMessage::NodeStateMessage (void* buf, size_t len)
 			std::string val = it->second.data ();
 
 			try {
-				_state.add_val (stoi (val));
+				/* do not truncate decimals */
+				size_t pos;
+				int    i = stoi (val, &pos);
+				if (pos != val.size ()) {
+					throw std::invalid_argument (val);
+				}
+				_state.add_val (i);
 			} catch (...) {
 				try {
 					double d = stod (val);
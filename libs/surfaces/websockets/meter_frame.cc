@@ -0,0 +1,77 @@
+/*
+ * Copyright (C) 2026 Ardour Developers
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#include <cstring>
+
+#include "message.h"
+#include "meter_frame.h"
+#include "state.h"
+
+using namespace ArdourSurface;
+
+static void
+append_u32 (std::vector<unsigned char>& buf, uint32_t v)
+{
+	buf.push_back (v & 0xff);
+	buf.push_back ((v >> 8) & 0xff);
+	buf.push_back ((v >> 16) & 0xff);
+	buf.push_back ((v >> 24) & 0xff);
+}
+
+size_t
+MeterFrame::serialize (std::vector<unsigned char>& buf, Encoding encoding) const
+{
+	size_t const offset = buf.size ();
+
+	if (encoding == Binary) {
+		buf.reserve (offset + 4 + 8 * _levels.size ());
+		append_u32 (buf, _levels.size ());
+
+		for (Levels::const_iterator it = _levels.begin (); it != _levels.end (); ++it) {
+			uint32_t db;
+			memcpy (&db, &it->second, sizeof (db));
+			append_u32 (buf, it->first);
+			append_u32 (buf, db);
+		}
+
+		return buf.size () - offset;
+	}
+
+	AddressVector addr;
+	ValueVector   val;
+
+	for (Levels::const_iterator it = _levels.begin (); it != _levels.end (); ++it) {
+		addr.push_back (it->first);
+		val.push_back (static_cast<double> (it->second));
+	}
+
+	/* strip id and level including separators take well below 32 bytes */
+	size_t const max_len = 64 + 32 * _levels.size ();
+
+	buf.resize (offset + max_len);
+
+	int len = NodeStateMessage (NodeState (Node::strip_meters, addr, val)).serialize (&buf[offset], max_len);
+
+	if (len <= 0) {
+		buf.resize (offset);
+		return 0;
+	}
+
+	buf.resize (offset + len);
+	return len;
+}
@@ -0,0 +1,79 @@
+/*
+ * Copyright (C) 2026 Ardour Developers
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#ifndef _ardour_surface_websockets_meter_frame_h_
+#define _ardour_surface_websockets_meter_frame_h_
+
+#include <map>
+#include <stdint.h>
+#include <vector>
+
+namespace ArdourSurface {
+
+/* Meter levels of several strips, sent to a client as a single message.
+ *
+ * JSON encoding is a regular state message:
+ *   {"node":"strip_meters","addr":[id, ...],"val":[dB, ...]}
+ *
+ * Binary encoding (little endian):
+ *   uint32 count, followed by count times { uint32 strip id, float32 dB }
+ */
+class MeterFrame
+{
+public:
+	enum Encoding {
+		JSON,
+		Binary
+	};
+
+	typedef std::map<uint32_t, float> Levels;
+
+	/* replaces a pending level of the same strip */
+	void set (uint32_t strip_id, float db)
+	{
+		_levels[strip_id] = db;
+	}
+
+	bool empty () const
+	{
+		return _levels.empty ();
+	}
+	size_t size () const
+	{
+		return _levels.size ();
+	}
+	void clear ()
+	{
+		_levels.clear ();
+	}
+	const Levels& levels () const
+	{
+		return _levels;
+	}
+
+	/* appends the encoded frame to buf, returns the number of bytes
+	 * written or 0 on failure */
+	size_t serialize (std::vector<unsigned char>& buf, Encoding) const;
+
+private:
+	Levels _levels;
+};
+
+} // namespace ArdourSurface
+
+#endif // _ardour_surface_websockets_meter_frame_h_
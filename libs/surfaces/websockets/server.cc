@@ -229,6 +229,37 @@ WebsocketsServer::update_all_clients (const NodeState& state, bool force)
 	}
 }
 
+void
+WebsocketsServer::set_meter_feed (Client wsi, ClientContext::MeterFeed feed, float threshold_db)
+{
+	ClientContextMap::iterator it = _client_ctx.find (wsi);
+	if (it == _client_ctx.end ()) {
+		return;
+	}
+
+	it->second.set_meter_feed (feed, threshold_db);
+}
+
+void
+WebsocketsServer::update_all_clients_meters (const MeterFrame& levels)
+{
+	for (ClientContextMap::iterator it = _client_ctx.begin (); it != _client_ctx.end (); ++it) {
+		ClientContext& ctx = it->second;
+
+		if (ctx.meter_feed () == ClientContext::MeterFeedStrip) {
+			for (MeterFrame::Levels::const_iterator l = levels.levels ().begin (); l != levels.levels ().end (); ++l) {
+				AddressVector addr (1, l->first);
+				ValueVector   val (1, TypedValue (static_cast<double> (l->second)));
+				update_client (ctx.wsi (), NodeState (Node::strip_meter, addr, val), false);
+			}
+		} else if (ctx.update_meters (levels)) {
+			/* a frame not yet written by the time of the next poll is
+			 * merged with it, slow clients get fewer but current frames */
+			request_write (ctx.wsi ());
+		}
+	}
+}
+
 int
 WebsocketsServer::add_client (Client wsi)
 {
@@ -283,6 +314,15 @@ WebsocketsServer::write_client (Client wsi)
 	}
 
 	ClientOutputBuffer& pending = it->second.output_buf ();
+
+	if (!it->second.meter_frame ().empty ()) {
+		int rv = write_meter_frame (wsi, it->second);
+		if (!pending.empty ()) {
+			request_write (wsi);
+		}
+		return rv;
+	}
+
 	if (pending.empty ()) {
 		return 0;
 	}
@@ -313,6 +353,28 @@ WebsocketsServer::write_client (Client wsi)
 	return 0;
 }
 
+int
+WebsocketsServer::write_meter_frame (Client wsi, ClientContext& ctx)
+{
+	bool const binary = ctx.meter_feed () == ClientContext::MeterFeedBinary;
+
+	_meter_buf.resize (LWS_PRE);
+
+	size_t len = ctx.meter_frame ().serialize (_meter_buf, binary ? MeterFrame::Binary : MeterFrame::JSON);
+	ctx.meter_frame ().clear ();
+
+	if (len == 0) {
+		PBD::error << "ArdourWebsockets: cannot serialize meter frame" << endmsg;
+		return 0;
+	}
+
+	if (lws_write (wsi, &_meter_buf[LWS_PRE], len, binary ? LWS_WRITE_BINARY : LWS_WRITE_TEXT) != (int)len) {
+		return 1;
+	}
+
+	return 0;
+}
+
 int
 WebsocketsServer::send_availsurf_hdr (Client wsi)
 {
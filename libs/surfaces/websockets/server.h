@@ -33,6 +33,7 @@
 #include "client.h"
 #include "component.h"
 #include "message.h"
+#include "meter_frame.h"
 #include "state.h"
 #include "resources.h"
 
@@ -53,6 +54,9 @@ public:
 	void update_client (Client, const NodeState&, bool);
 	void update_all_clients (const NodeState&, bool);
 
+	void set_meter_feed (Client, ClientContext::MeterFeed, float threshold_db);
+	void update_all_clients_meters (const MeterFrame&);
+
 private:
 #if LWS_LIBRARY_VERSION_MAJOR < 3
 	struct lws_protocol_vhost_options _lws_vhost_opt;
@@ -68,10 +72,13 @@ private:
 
 	ServerResources _resources;
 
+	std::vector<unsigned char> _meter_buf;
+
 	int add_client (Client);
 	int del_client (Client);
 	int recv_client (Client, void*, size_t);
 	int write_client (Client);
+	int write_meter_frame (Client, ClientContext&);
 	int send_availsurf_hdr (Client);
 	int send_availsurf_body (Client);
 
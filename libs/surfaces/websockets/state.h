@@ -35,6 +35,7 @@ namespace Node
 {
 	const std::string strip_description              = "strip_description";
 	const std::string strip_meter                    = "strip_meter";
+	const std::string strip_meters                   = "strip_meters";
 	const std::string strip_gain                     = "strip_gain";
 	const std::string strip_pan                      = "strip_pan";
 	const std::string strip_mute                     = "strip_mute";
@@ -47,6 +48,7 @@ namespace Node
 	const std::string transport_bbt                  = "transport_bbt";
 	const std::string transport_roll                 = "transport_roll";
 	const std::string transport_record               = "transport_record";
+	const std::string meter_feed                     = "meter_feed";
 } // namespace Node
 
 typedef std::vector<uint32_t>   AddressVector;
@@ -0,0 +1,279 @@
+/*
+ * Copyright (C) 2026 Ardour Developers
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/* Load test for the meter feed of the WebSockets surface.
+ *
+ * Connects a number of headless clients to a running Ardour session with
+ * the WebSockets surface enabled, requests a meter feed and reports the
+ * message and data rates the clients receive.
+ *
+ * usage: websockets-bench [-c clients] [-d seconds] [-m strip|batch|binary]
+ *                         [-t threshold-dB] [-H host] [-p port]
+ */
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <getopt.h>
+#include <libwebsockets.h>
+
+#include "pbd/microseconds.h"
+
+struct Stats {
+	Stats ()
+	    : connected (0)
+	    , closed (0)
+	    , messages (0)
+	    , meter_messages (0)
+	    , meter_levels (0)
+	    , bytes (0)
+	{}
+
+	int      connected;
+	int      closed;
+	uint64_t messages;
+	uint64_t meter_messages;
+	uint64_t meter_levels;
+	uint64_t bytes;
+};
+
+static Stats       stats;
+static std::string mode      = "strip";
+static double      threshold = 0;
+
+static const char* const strip_meter  = "\"node\":\"strip_meter\"";
+static const char* const strip_meters = "\"node\":\"strip_meters\"";
+
+/* per connection, allocated and zeroed by libwebsockets */
+struct Session {
+	bool     first_fragment_seen;
+	bool     binary;
+	uint32_t levels;
+};
+
+/* text messages may arrive in fragments */
+static std::map<struct lws*, std::string> texts;
+
+static void
+count_message (Session* s, std::string const& text)
+{
+	++stats.messages;
+
+	if (s->binary) {
+		++stats.meter_messages;
+		stats.meter_levels += s->levels;
+	} else if (text.find (strip_meters) != std::string::npos) {
+		/* one entry per strip in "addr":[...] */
+		size_t b = text.find ("\"addr\":[");
+		size_t e = text.find (']', b);
+		if (b != std::string::npos && e != std::string::npos && e > b + 8) {
+			++stats.meter_messages;
+			stats.meter_levels += 1 + std::count (text.begin () + b, text.begin () + e, ',');
+		}
+	} else if (text.find (strip_meter) != std::string::npos) {
+		++stats.meter_messages;
+		++stats.meter_levels;
+	}
+}
+
+static int
+callback (struct lws* wsi, enum lws_callback_reasons reason, void* user, void* in, size_t len)
+{
+	Session* s = static_cast<Session*> (user);
+
+	switch (reason) {
+		case LWS_CALLBACK_CLIENT_ESTABLISHED:
+			++stats.connected;
+			if (mode != "strip") {
+				lws_callback_on_writable (wsi);
+			}
+			break;
+
+		case LWS_CALLBACK_CLIENT_WRITEABLE: {
+			char msg[128];
+			int  n = snprintf (msg, sizeof (msg), "{\"node\":\"meter_feed\",\"val\":[\"%s\",%g]}", mode.c_str (), threshold);
+			std::vector<unsigned char> buf (LWS_PRE + n);
+			memcpy (&buf[LWS_PRE], msg, n);
+			if (lws_write (wsi, &buf[LWS_PRE], n, LWS_WRITE_TEXT) != n) {
+				return -1;
+			}
+		} break;
+
+		case LWS_CALLBACK_CLIENT_RECEIVE: {
+			std::string& text = texts[wsi];
+
+			stats.bytes += len;
+
+			if (!s->first_fragment_seen) {
+				s->first_fragment_seen = true;
+				s->binary              = lws_frame_is_binary (wsi);
+				s->levels              = 0;
+				text.clear ();
+				if (s->binary && len >= 4) {
+					unsigned char const* p = static_cast<unsigned char const*> (in);
+					s->levels = p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+				}
+			}
+
+			if (!s->binary) {
+				text.append (static_cast<char const*> (in), len);
+			}
+
+			if (lws_is_final_fragment (wsi)) {
+				count_message (s, text);
+				s->first_fragment_seen = false;
+			}
+		} break;
+
+		case LWS_CALLBACK_CLIENT_CONNECTION_ERROR:
+		case LWS_CALLBACK_CLIENT_CLOSED:
+			++stats.closed;
+			texts.erase (wsi);
+			break;
+
+		default:
+			break;
+	}
+
+	return 0;
+}
+
+static void
+usage ()
+{
+	printf ("usage: websockets-bench [-c clients] [-d seconds] [-m strip|batch|binary] [-t threshold-dB] [-H host] [-p port]\n");
+}
+
+int
+main (int argc, char** argv)
+{
+	int         n_clients = 8;
+	int         duration  = 10;
+	std::string host      = "127.0.0.1";
+	int         port      = 3818;
+
+	int c;
+	while ((c = getopt (argc, argv, "c:d:m:t:H:p:h")) != -1) {
+		switch (c) {
+			case 'c':
+				n_clients = std::max (1, atoi (optarg));
+				break;
+			case 'd':
+				duration = std::max (1, atoi (optarg));
+				break;
+			case 'm':
+				mode = optarg;
+				break;
+			case 't':
+				threshold = atof (optarg);
+				break;
+			case 'H':
+				host = optarg;
+				break;
+			case 'p':
+				port = atoi (optarg);
+				break;
+			default:
+				usage ();
+				return c == 'h' ? 0 : 1;
+		}
+	}
+
+	if (mode != "strip" && mode != "batch" && mode != "binary") {
+		usage ();
+		return 1;
+	}
+
+	lws_set_log_level (LLL_ERR, NULL);
+
+	struct lws_protocols protocols[2];
+	memset (protocols, 0, sizeof (protocols));
+	protocols[0].name                  = "lws-ardour-bench";
+	protocols[0].callback              = callback;
+	protocols[0].per_session_data_size = sizeof (Session);
+
+	struct lws_context_creation_info info;
+	memset (&info, 0, sizeof (info));
+	info.port      = CONTEXT_PORT_NO_LISTEN;
+	info.protocols = protocols;
+	info.gid       = -1;
+	info.uid       = -1;
+
+	struct lws_context* context = lws_create_context (&info);
+	if (!context) {
+		fprintf (stderr, "cannot create libwebsockets context\n");
+		return 1;
+	}
+
+	for (int i = 0; i < n_clients; ++i) {
+		struct lws_client_connect_info ci;
+		memset (&ci, 0, sizeof (ci));
+		ci.context = context;
+		ci.address = host.c_str ();
+		ci.port    = port;
+		ci.path    = "/";
+		ci.host    = ci.address;
+		ci.origin  = ci.address;
+		/* like a browser, do not request a sub-protocol */
+
+		if (!lws_client_connect_via_info (&ci)) {
+			fprintf (stderr, "cannot connect to %s:%d\n", host.c_str (), port);
+			lws_context_destroy (context);
+			return 1;
+		}
+	}
+
+	/* let clients connect, receive the initial state and negotiate the feed */
+	PBD::microseconds_t const t_start = PBD::get_microseconds ();
+	while (PBD::get_microseconds () - t_start < 1000000 && stats.closed < n_clients) {
+		lws_service (context, 50);
+	}
+
+	if (stats.connected == 0) {
+		fprintf (stderr, "no client could connect to %s:%d\n", host.c_str (), port);
+		lws_context_destroy (context);
+		return 1;
+	}
+
+	stats.messages = stats.meter_messages = stats.meter_levels = stats.bytes = 0;
+
+	PBD::microseconds_t const t0 = PBD::get_microseconds ();
+	while (PBD::get_microseconds () - t0 < duration * 1000000LL && stats.closed < n_clients) {
+		lws_service (context, 50);
+	}
+	double const secs = (PBD::get_microseconds () - t0) * 1e-6;
+
+	lws_context_destroy (context);
+
+	double const per_client = secs * stats.connected;
+
+	printf ("mode: %s, threshold: %g dB, %d of %d clients connected, %.1f sec\n",
+	        mode.c_str (), threshold, stats.connected, n_clients, secs);
+	printf ("per client: %8.1f msg/s (%.1f meter msg/s), %8.1f meter levels/s, %8.1f kB/s\n",
+	        stats.messages / per_client, stats.meter_messages / per_client,
+	        stats.meter_levels / per_client, stats.bytes / per_client / 1024.);
+	printf ("total:      %8.1f msg/s, %8.1f kB/s\n",
+	        stats.messages / secs, stats.bytes / secs / 1024.);
+
+	return stats.closed > 0 ? 1 : 0;
+}
@@ -791,6 +791,12 @@ TempoMap::reftime (TempoPoint const & t, MeterPoint const & m) const
 {
 	Points::const_iterator pi;
 
+	if (_index_valid) {
+		/* the time of the latest BBT marker at or before the earlier of the two points */
+		std::vector<superclock_t>::const_iterator b = std::upper_bound (_bartime_index.begin(), _bartime_index.end(), std::min (m.sclock(), t.sclock()));
+		return (b == _bartime_index.begin()) ? _points.front().sclock() : *(b - 1);
+	}
+
 	if (m.sclock() < t.sclock()) {
 		pi = _points.s_iterator_to (*(static_cast<const Point*> (&m)));
 	} else {
@@ -910,6 +916,8 @@ GridIterator::valid_for (TempoMap const & m, superclock_t start, uint32_t bmod,
 
 TempoMap::TempoMap (Tempo const & initial_tempo, Meter const & initial_meter)
 	: _scope_owner (nullptr)
+	, _index_valid (false)
+	, _bbt_index_valid (false)
 {
 	TempoPoint* tp = new TempoPoint (*this, initial_tempo, 0, Beats(), BBT_Time());
 	MeterPoint* mp = new MeterPoint (*this, initial_meter, 0, Beats(), BBT_Time());
@@ -923,12 +931,16 @@ TempoMap::TempoMap (Tempo const & initial_tempo, Meter const & initial_meter)
 
 TempoMap::TempoMap (XMLNode const & node, int version)
 	: _scope_owner (nullptr)
+	, _index_valid (false)
+	, _bbt_index_valid (false)
 {
 	set_state (node, version);
 }
 
 TempoMap::TempoMap (TempoMap const & other)
 	: _scope_owner (nullptr)
+	, _index_valid (false)
+	, _bbt_index_valid (false)
 {
 	copy_points (other);
 }
@@ -959,6 +971,8 @@ TempoMap::operator= (TempoMap const & other)
 void
 TempoMap::copy_points (TempoMap const & other)
 {
+	invalidate_index ();
+
 	MusicTimePoint const * mt;
 	TempoPoint const * tp;
 	MeterPoint const * mp;
@@ -1247,6 +1261,8 @@ TempoMap::paste (TempoMapCutBuffer const & cb, timepos_t const & position, bool
 void
 TempoMap::shift (timepos_t const & at, timecnt_t const & by)
 {
+	invalidate_index ();
+
 	if (at == std::numeric_limits<timepos_t>::min()) {
 		/* can't insert time at the front of the map: those entries are fixed */
 		return;
@@ -1284,6 +1300,8 @@ TempoMap::shift (timepos_t const & at, timecnt_t const & by)
 void
 TempoMap::shift (timepos_t const & at, BBT_Offset const & offset)
 {
+	invalidate_index ();
+
 	/* for now we require BBT-based shifts to be in units of whole bars */
 
 	if (std::abs (offset.bars) < 1) {
@@ -1573,6 +1591,8 @@ TempoMap::smf_end ()
 void
 TempoMap::smf_add (TempoPoint & tp)
 {
+	invalidate_index ();
+
 	assert (&tp.map() == this);
 	/* all other tempos must be earlier; other points must be earlier or identical */
 	assert (_tempos.empty() || _tempos.back().sclock() < tp.sclock());
@@ -1584,6 +1604,8 @@ TempoMap::smf_add (TempoPoint & tp)
 void
 TempoMap::smf_add (MeterPoint & mp)
 {
+	invalidate_index ();
+
 	assert (&mp.map() == this);
 	/* all other meters must be earlier; other points must be earlier or identical */
 	assert (_meters.empty() || _meters.back().sclock() < mp.sclock());
@@ -1595,6 +1617,8 @@ TempoMap::smf_add (MeterPoint & mp)
 void
 TempoMap::core_add_point (Point* pp)
 {
+	invalidate_index ();
+
 	Points::iterator p;
 	const Beats beats_limit = pp->beats();
 
@@ -1605,6 +1629,8 @@ TempoMap::core_add_point (Point* pp)
 TempoPoint*
 TempoMap::core_add_tempo (TempoPoint* tp, bool& replaced)
 {
+	invalidate_index ();
+
 	Tempos::iterator t;
 	const superclock_t sclock_limit = tp->sclock();
 	const Beats beats_limit = tp->beats ();
@@ -1631,6 +1657,8 @@ TempoMap::core_add_tempo (TempoPoint* tp, bool& replaced)
 MeterPoint*
 TempoMap::core_add_meter (MeterPoint* mp, bool& replaced)
 {
+	invalidate_index ();
+
 	Meters::iterator m;
 	const superclock_t sclock_limit = mp->sclock();
 	const Beats beats_limit = mp->beats ();
@@ -1654,6 +1682,8 @@ TempoMap::core_add_meter (MeterPoint* mp, bool& replaced)
 MusicTimePoint*
 TempoMap::core_add_bartime (MusicTimePoint* mtp, bool& replaced)
 {
+	invalidate_index ();
+
 	MusicTimes::iterator m;
 	const superclock_t sclock_limit = mtp->sclock();
 
@@ -1728,6 +1758,8 @@ TempoMap::remove_tempo (TempoPoint const & tp, bool with_reset)
 Point*
 TempoMap::core_remove_tempo (TempoPoint const & tp)
 {
+	invalidate_index ();
+
 	Tempos::iterator t;
 
 	/* the argument is likely to be a Point-derived object that doesn't
@@ -1869,6 +1901,8 @@ TempoMap::add_or_replace_bartime (MusicTimePoint* mtp)
 Point*
 TempoMap::core_remove_bartime (MusicTimePoint const & mtp)
 {
+	invalidate_index ();
+
 	MusicTimes::iterator m;
 
 	/* the argument is likely to be a Point-derived object that doesn't
@@ -1927,6 +1961,8 @@ TempoMap::remove_bartime (MusicTimePoint const & mtp, bool with_reset)
 void
 TempoMap::remove_point (Point const & point)
 {
+	invalidate_index ();
+
 	for (auto p = _points.begin(); p != _points.end(); ++p) {
 		if (&(*p) == &point) {
 			// XXX need to fix this leak by deleting point;
@@ -1939,6 +1975,8 @@ TempoMap::remove_point (Point const & point)
 void
 TempoMap::reset_starting_at (superclock_t sc, bool constant_bbt)
 {
+	invalidate_index ();
+
 	DEBUG_TRACE (DEBUG::MapReset, string_compose ("reset starting at %1\n", sc));
 #ifndef NDEBUG
 	if (DEBUG_ENABLED(DEBUG::MapReset)) {
@@ -2148,6 +2186,8 @@ TempoMap::reset_section (Points::iterator& begin, superclock_t section_limit, Te
 bool
 TempoMap::move_meter (MeterPoint const & mp, timepos_t const & when, bool push)
 {
+	invalidate_index ();
+
 	TEMPO_MAP_ASSERT (!_tempos.empty());
 	TEMPO_MAP_ASSERT (!_meters.empty());
 
@@ -2287,6 +2327,8 @@ TempoMap::move_meter (MeterPoint const & mp, timepos_t const & when, bool push)
 bool
 TempoMap::move_tempo (TempoPoint const & tp, timepos_t const & when, bool push)
 {
+	invalidate_index ();
+
 	TEMPO_MAP_ASSERT (!_tempos.empty());
 	TEMPO_MAP_ASSERT (!_meters.empty());
 
@@ -2489,6 +2531,8 @@ TempoMap::remove_meter (MeterPoint const & mp, bool with_reset)
 Point*
 TempoMap::core_remove_meter (MeterPoint const & mp)
 {
+	invalidate_index ();
+
 	Meters::iterator m;
 
 	/* the argument is likely to be a Point-derived object that doesn't
@@ -2615,6 +2659,8 @@ TempoMap::bbtwalk_to_quarters (BBT_Argument const & pos, BBT_Offset const & dist
 void
 TempoMap::sample_rate_changed (samplecnt_t new_sr)
 {
+	invalidate_index ();
+
 	const double ratio = new_sr / (double) TEMPORAL_SAMPLE_RATE;
 
 	for (Tempos::iterator t = _tempos.begin(); t != _tempos.end(); ++t) {
@@ -2698,6 +2744,97 @@ TempoMap::count_meters_in_points () const
 }
 
 
+void
+TempoMap::build_index ()
+{
+	TempoPoint const * tp;
+	MeterPoint const * mp;
+	uint32_t pos = 0;
+
+	_tempo_index.clear ();
+	_meter_index.clear ();
+	_bartime_index.clear ();
+
+	/* use the same (_points) order as ::_get_tempo_and_meter() */
+
+	for (auto const & p : _points) {
+		if (dynamic_cast<MusicTimePoint const *> (&p) != 0) {
+			_bartime_index.push_back (p.sclock());
+		}
+		if ((tp = dynamic_cast<TempoPoint const *> (&p)) != 0) {
+			_tempo_index.add (tp, pos);
+		}
+		if ((mp = dynamic_cast<MeterPoint const *> (&p)) != 0) {
+			_meter_index.add (mp, pos);
+		}
+		++pos;
+	}
+
+	/* BBT lookups do not take the BBT reference into account (and
+	 * BBT time may restart at a MusicTimePoint), so only use the index
+	 * for them if BBT time is ordered.
+	 */
+
+	_bbt_index_valid = std::is_sorted (_tempo_index.bbts.begin(), _tempo_index.bbts.end()) &&
+		std::is_sorted (_meter_index.bbts.begin(), _meter_index.bbts.end());
+
+	_index_valid = !_tempo_index.points.empty() && !_meter_index.points.empty();
+}
+
+static inline superclock_t point_time (Point const & p, superclock_t) { return p.sclock(); }
+static inline Beats const & point_time (Point const & p, Beats const &) { return p.beats(); }
+static inline BBT_Time const & point_time (Point const & p, BBT_Time const &) { return p.bbt(); }
+
+/* Indexed equivalent of ::_get_tempo_and_meter() and
+ * ::get_tempo_and_meter_bbt(). Returns false if the index cannot be used.
+ */
+template<typename TimeType> bool
+TempoMap::indexed_tempo_and_meter (TempoPoint const *& tp, MeterPoint const *& mp, TimeType const & arg,
+                                   bool can_match, bool ret_iterator_after_not_at, Points::const_iterator& ret) const
+{
+	size_t nt;
+	size_t nm;
+
+	/* see ::_get_tempo_and_meter() */
+	can_match = (can_match || arg == TimeType ());
+
+	if (!indexed_count (_tempo_index, arg, can_match, nt) || !indexed_count (_meter_index, arg, can_match, nm)) {
+		return false;
+	}
+
+	tp = nt ? _tempo_index.points[nt-1] : &_tempos.front();
+	mp = nm ? _meter_index.points[nm-1] : &_meters.front();
+
+	/* the iterator refers to whichever of the two points is later in _points */
+
+	Point const * last_used;
+
+	if (!nt && !nm) {
+		ret = _points.end();
+		return true;
+	} else if (!nm || (nt && _tempo_index.positions[nt-1] > _meter_index.positions[nm-1])) {
+		last_used = tp;
+	} else {
+		last_used = mp;
+	}
+
+	ret = _points.iterator_to (*last_used);
+
+	if (ret_iterator_after_not_at) {
+		if (can_match) {
+			while ((ret != _points.end()) && point_time (*ret, arg) <= arg) ++ret;
+		} else {
+			while ((ret != _points.end()) && point_time (*ret, arg) < arg) ++ret;
+		}
+	}
+
+	return true;
+}
+
+template bool TempoMap::indexed_tempo_and_meter<superclock_t> (TempoPoint const *&, MeterPoint const *&, superclock_t const &, bool, bool, Points::const_iterator&) const;
+template bool TempoMap::indexed_tempo_and_meter<Beats> (TempoPoint const *&, MeterPoint const *&, Beats const &, bool, bool, Points::const_iterator&) const;
+template bool TempoMap::indexed_tempo_and_meter<BBT_Time> (TempoPoint const *&, MeterPoint const *&, BBT_Time const &, bool, bool, Points::const_iterator&) const;
+
 template<class const_traits_t>  typename const_traits_t::iterator_type
 TempoMap::_get_tempo_and_meter (typename const_traits_t::tempo_point_type & tp,
                                 typename const_traits_t::meter_point_type & mp,
@@ -2795,6 +2932,10 @@ TempoMap::get_tempo_and_meter_bbt (TempoPoint const *& t, MeterPoint const *& m,
 	TEMPO_MAP_ASSERT (!_points.empty());
 
 	Points::const_iterator p;
+
+	if (_bartimes.empty() && indexed_tempo_and_meter<BBT_Time> (t, m, bbt, can_match, ret_iterator_after_not_at, p)) {
+		return p;
+	}
 	Points::const_iterator last_used = _points.end();
 	bool tempo_done = false;
 	bool meter_done = false;
@@ -3812,6 +3953,8 @@ TempoMap::get_state () const
 int
 TempoMap::set_state (XMLNode const & node, int version)
 {
+	invalidate_index ();
+
 	if (version <= 6000) {
 		return set_state_3x (node);
 	}
@@ -4071,6 +4214,8 @@ TempoMap::n_tempos () const
 bool
 TempoMap::remove_time (timepos_t const & pos, timecnt_t const & duration)
 {
+	invalidate_index ();
+
 	superclock_t start (pos.superclocks());
 	superclock_t end ((pos + duration).superclocks());
 	superclock_t shift (duration.superclocks());
@@ -4567,6 +4712,8 @@ TempoMap::stretch_tempo_end (TempoPoint* ts, samplepos_t sample, samplepos_t end
 bool
 TempoMap::solve_ramped_twist (TempoPoint& earlier, TempoPoint& later)
 {
+	invalidate_index ();
+
 	superclock_t err = earlier.superclock_at (later.beats()) - later.sclock();
 	const superclock_t one_sample = superclock_ticks_per_second() / TEMPORAL_SAMPLE_RATE;
 	double end_scpqn = earlier.end_superclocks_per_quarter_note();
@@ -4628,6 +4775,8 @@ TempoMap::solve_ramped_twist (TempoPoint& earlier, TempoPoint& later)
 bool
 TempoMap::solve_constant_twist (TempoPoint& earlier, TempoPoint& later)
 {
+	invalidate_index ();
+
 	superclock_t err = earlier.superclock_at (later.beats()) - later.sclock();
 	const superclock_t one_sample = superclock_ticks_per_second() / TEMPORAL_SAMPLE_RATE;
 	double start_npm = earlier.superclocks_per_quarter_note ();
@@ -4766,6 +4915,9 @@ TempoMap::write_copy()
 int
 TempoMap::update (TempoMap::WritableSharedPtr m)
 {
+	/* the map is immutable from now on, so lookups can use an index */
+	m->build_index ();
+
 	if (!_map_mgr.update (m)) {
 		return -1;
 	}
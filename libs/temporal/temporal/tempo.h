@@ -18,6 +18,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <list>
 #include <string>
 #include <vector>
@@ -759,6 +760,7 @@ class /*LIBTEMPORAL_API*/ TempoMap : public PBD::StatefulDestructible
 	/* These are only for use in unit tests */
 	Points::size_type count_tempos_in_points() const;
 	Points::size_type count_meters_in_points() const;
+	void set_indexed (bool yn) { if (yn) { build_index (); } else { invalidate_index (); } }
   public:
 	LIBTEMPORAL_API static void init ();
 
@@ -792,7 +794,7 @@ class /*LIBTEMPORAL_API*/ TempoMap : public PBD::StatefulDestructible
 	/* and now on with the rest of the show ... */
 
   public:
-	LIBTEMPORAL_API TempoMap () : _scope_owner (nullptr) {}
+	LIBTEMPORAL_API TempoMap () : _scope_owner (nullptr), _index_valid (false), _bbt_index_valid (false) {}
 	LIBTEMPORAL_API TempoMap (Tempo const& initial_tempo, Meter const& initial_meter);
 	LIBTEMPORAL_API TempoMap (TempoMap const&);
 	LIBTEMPORAL_API TempoMap (XMLNode const&, int version);
@@ -913,6 +915,11 @@ class /*LIBTEMPORAL_API*/ TempoMap : public PBD::StatefulDestructible
 			return _tempos.front();
 		}
 
+		size_t n;
+		if (indexed_count (_tempo_index, when, false, n)) {
+			return n ? *_tempo_index.points[n-1] : _tempos.front();
+		}
+
 		Tempos::const_iterator prev = _tempos.end();
 		for (Tempos::const_iterator t = _tempos.begin(); t != _tempos.end(); ++t) {
 			if (cmp (*t, when)) {
@@ -934,6 +941,11 @@ class /*LIBTEMPORAL_API*/ TempoMap : public PBD::StatefulDestructible
 			return _meters.front();
 		}
 
+		size_t n;
+		if (indexed_count (_meter_index, when, false, n)) {
+			return n ? *_meter_index.points[n-1] : _meters.front();
+		}
+
 		Meters::const_iterator prev = _meters.end();
 		for (Meters::const_iterator m = _meters.begin(); m != _meters.end(); ++m) {
 			if (cmp (*m, when)) {
@@ -1047,6 +1059,82 @@ class /*LIBTEMPORAL_API*/ TempoMap : public PBD::StatefulDestructible
 	Points       _points;
 	ScopedTempoMapOwner* _scope_owner;
 
+	/* A sorted array of the tempo (or meter) points of the map, with the
+	 * position of each point in all three time domains stored in separate
+	 * contiguous vectors, so that lookups can use a binary search instead
+	 * of walking the intrusive lists.
+	 */
+	template<typename T> struct PointIndex {
+		std::vector<T const *>    points;
+		std::vector<superclock_t> sclocks;
+		std::vector<Beats>        beats;
+		std::vector<BBT_Time>     bbts;
+		std::vector<uint32_t>     positions; /* index of the point in _points */
+
+		void clear () {
+			points.clear ();
+			sclocks.clear ();
+			beats.clear ();
+			bbts.clear ();
+			positions.clear ();
+		}
+
+		void add (T const * p, uint32_t pos) {
+			points.push_back (p);
+			sclocks.push_back (p->sclock());
+			beats.push_back (p->beats());
+			bbts.push_back (p->bbt());
+			positions.push_back (pos);
+		}
+
+		/* return the number of points before @p when (or at @p when,
+		 * if @p can_match is true).
+		 */
+		size_t count (superclock_t when, bool can_match) const { return count (sclocks, when, can_match); }
+		size_t count (Beats const & when, bool can_match) const { return count (beats, when, can_match); }
+		size_t count (BBT_Time const & when, bool can_match) const { return count (bbts, when, can_match); }
+
+	  private:
+		template<typename K> static size_t count (std::vector<K> const & keys, K const & when, bool can_match) {
+			if (can_match) {
+				return std::upper_bound (keys.begin(), keys.end(), when) - keys.begin();
+			}
+			return std::lower_bound (keys.begin(), keys.end(), when) - keys.begin();
+		}
+	};
+
+	/* The index is built by ::update() before a map is published, since
+	 * published maps are never modified. It is invalidated by any change
+	 * to the points of the map, after which lookups walk the lists again.
+	 */
+	PointIndex<TempoPoint>    _tempo_index;
+	PointIndex<MeterPoint>    _meter_index;
+	std::vector<superclock_t> _bartime_index; /* MusicTimePoint positions, for ::reftime() */
+	bool                      _index_valid;
+	bool                      _bbt_index_valid; /* BBT time increases monotonically along the map */
+
+	void build_index ();
+	void invalidate_index () { _index_valid = false; }
+
+	template<typename T> bool indexed_count (PointIndex<T> const & index, superclock_t when, bool can_match, size_t& n) const {
+		if (!_index_valid) { return false; }
+		n = index.count (when, can_match);
+		return true;
+	}
+	template<typename T> bool indexed_count (PointIndex<T> const & index, Beats const & when, bool can_match, size_t& n) const {
+		if (!_index_valid) { return false; }
+		n = index.count (when, can_match);
+		return true;
+	}
+	template<typename T> bool indexed_count (PointIndex<T> const & index, BBT_Time const & when, bool can_match, size_t& n) const {
+		if (!_index_valid || !_bbt_index_valid) { return false; }
+		n = index.count (when, can_match);
+		return true;
+	}
+
+	template<typename TimeType> bool indexed_tempo_and_meter (TempoPoint const *& t, MeterPoint const *& m, TimeType const & when,
+	                                                          bool can_match, bool ret_iterator_after_not_at, Points::const_iterator& ret) const;
+
 	int set_tempos_from_state (XMLNode const &);
 	int set_meters_from_state (XMLNode const &);
 	int set_music_times_from_state (XMLNode const &);
@@ -1158,10 +1246,14 @@ class /*LIBTEMPORAL_API*/ TempoMap : public PBD::StatefulDestructible
 
 	Points::const_iterator get_tempo_and_meter (TempoPoint const *& t, MeterPoint const *& m, superclock_t sc, bool can_match, bool ret_iterator_after_not_at) const {
 		if (_tempos.size() == 1 && _meters.size() == 1) { t = &_tempos.front(); m = &_meters.front();  return _points.end(); }
+		Points::const_iterator ret;
+		if (indexed_tempo_and_meter (t, m, sc, can_match, ret_iterator_after_not_at, ret)) { return ret; }
 		return _get_tempo_and_meter<const_traits<superclock_t, superclock_t> > (t, m, &Point::sclock, sc, _points.begin(), _points.end(), &_tempos.front(), &_meters.front(), can_match, ret_iterator_after_not_at);
 	}
 	Points::const_iterator get_tempo_and_meter (TempoPoint const *& t, MeterPoint const *& m, Beats const & b, bool can_match, bool ret_iterator_after_not_at) const {
 		if (_tempos.size() == 1 && _meters.size() == 1) { t = &_tempos.front(); m = &_meters.front();  return _points.end(); }
+		Points::const_iterator ret;
+		if (indexed_tempo_and_meter (t, m, b, can_match, ret_iterator_after_not_at, ret)) { return ret; }
 		return _get_tempo_and_meter<const_traits<Beats const &, Beats> > (t, m, &Point::beats, b, _points.begin(), _points.end(), &_tempos.front(), &_meters.front(), can_match, ret_iterator_after_not_at);
 	}
 
@@ -0,0 +1,110 @@
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+#include "pbd/microseconds.h"
+#include "pbd/pbd.h"
+
+#include "temporal/tempo.h"
+#include "temporal/types.h"
+
+using namespace Temporal;
+
+/* Compare tempo map lookups walking the point lists with indexed lookups.
+ *
+ * usage: tempo-map-benchmark [number-of-tempo-changes (default 10000)]
+ */
+
+static double
+per_lookup (PBD::microseconds_t t0, PBD::microseconds_t t1, size_t n)
+{
+	return 1000.0 * (t1 - t0) / n;
+}
+
+static void
+run (TempoMap::WritableSharedPtr tmap, bool indexed, std::vector<superclock_t> const & sc, std::vector<Beats> const & b, std::vector<BBT_Argument> const & bbt)
+{
+	PBD::microseconds_t t0, t1;
+	int64_t             sum = 0;
+
+	tmap->set_indexed (indexed);
+
+	std::cout << (indexed ? "indexed" : "linear ");
+
+	t0 = PBD::get_microseconds ();
+	for (auto const & s : sc) {
+		sum += tmap->quarters_at_superclock (s).get_ticks ();
+	}
+	t1 = PBD::get_microseconds ();
+	std::cout << "\t" << per_lookup (t0, t1, sc.size ());
+
+	t0 = PBD::get_microseconds ();
+	for (auto const & q : b) {
+		sum += tmap->superclock_at (q);
+	}
+	t1 = PBD::get_microseconds ();
+	std::cout << "\t" << per_lookup (t0, t1, b.size ());
+
+	t0 = PBD::get_microseconds ();
+	for (auto const & q : bbt) {
+		sum += tmap->quarters_at (q).get_ticks ();
+	}
+	t1 = PBD::get_microseconds ();
+	std::cout << "\t" << per_lookup (t0, t1, bbt.size ());
+
+	t0 = PBD::get_microseconds ();
+	for (auto const & s : sc) {
+		sum += (int64_t) tmap->tempo_at (s).note_types_per_minute ();
+	}
+	t1 = PBD::get_microseconds ();
+	std::cout << "\t" << per_lookup (t0, t1, sc.size ());
+
+	/* print the checksum to keep the compiler from optimizing lookups away */
+	std::cout << "\t(" << sum << ")\n";
+}
+
+int
+main (int argc, char* argv[])
+{
+	int32_t const n_points  = argc > 1 ? std::max (1, atoi (argv[1])) : 10000;
+	size_t const  n_lookups = 10000;
+
+	if (!PBD::init ()) return 1;
+	Temporal::init ();
+	Temporal::reset ();
+
+	TempoMap::WritableSharedPtr tmap (new TempoMap (Tempo (120, 4), Meter (4, 4)));
+
+	for (int32_t bar = 2; bar < n_points + 2; ++bar) {
+		if ((bar % 16) == 0) {
+			tmap->set_meter (Meter ((bar % 32) ? 3 : 4, 4), BBT_Argument (bar, 1, 0));
+		}
+		tmap->set_tempo (Tempo (60 + (bar % 97), 4), BBT_Argument (bar, 1, 0));
+	}
+
+	tmap->set_indexed (true);
+
+	superclock_t const end = tmap->superclock_at (BBT_Argument (n_points + 2, 1, 0));
+
+	std::vector<superclock_t> sc;
+	std::vector<Beats>        b;
+	std::vector<BBT_Argument> bbt;
+
+	srand (42);
+
+	for (size_t n = 0; n < n_lookups; ++n) {
+		sc.push_back ((superclock_t) (end * (rand () / (RAND_MAX + 1.0))));
+		b.push_back (tmap->quarters_at_superclock (sc.back ()));
+		bbt.push_back (tmap->bbt_at (b.back ()));
+	}
+
+	std::cout << "Tempo map with " << tmap->n_tempos () << " tempos and " << tmap->n_meters () << " meters, "
+	          << n_lookups << " lookups [ns/lookup]\n";
+	std::cout << "\t\tsclock->beats\tbeats->sclock\tbbt->beats\ttempo_at\n";
+
+	run (tmap, false, sc, b, bbt);
+	run (tmap, true, sc, b, bbt);
+
+	return 0;
+}
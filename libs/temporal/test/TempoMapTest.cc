@@ -77,3 +77,67 @@ TempoMapTest::convertTest()
 }
 
 
+
+void
+TempoMapTest::indexTest()
+{
+	TempoMap::WritableSharedPtr tmap (new TempoMap (Tempo (120, 4), Meter (4, 4)));
+
+	/* 1000 tempo changes, and a meter change every 7 bars */
+
+	for (int32_t bar = 2; bar < 1002; ++bar) {
+		if ((bar % 7) == 0) {
+			tmap->set_meter (Meter ((bar % 14) ? 3 : 4, 4), BBT_Argument (bar, 1, 0));
+		}
+		tmap->set_tempo (Tempo (60 + (bar % 97), 4), BBT_Argument (bar, 1, 0));
+	}
+
+	superclock_t const end = tmap->superclock_at (BBT_Argument (1010, 1, 0));
+
+	srand (42);
+
+	for (int n = 0; n < 2000; ++n) {
+		/* include positions that coincide with points */
+		superclock_t sc     = (n % 5) ? (superclock_t) (end * (rand () / (RAND_MAX + 1.0))) : tmap->tempos().front().sclock();
+		Beats        b      = (n % 3) ? tmap->quarters_at_superclock (sc) : Beats (rand () % 4000, 0);
+		BBT_Argument bbt (rand () % 1005 + 1, 1 + (rand () % 3), (rand () % 2) * 960);
+
+		tmap->set_indexed (false);
+
+		TempoPoint const * t_sc  = &tmap->tempo_at (sc);
+		MeterPoint const * m_sc  = &tmap->meter_at (sc);
+		TempoPoint const * t_b   = &tmap->tempo_at (b);
+		MeterPoint const * m_b   = &tmap->meter_at (b);
+		TempoPoint const * t_bbt = &tmap->tempo_at (bbt);
+		MeterPoint const * m_bbt = &tmap->meter_at (bbt);
+		TempoMetric  tm_sc       = tmap->metric_at (timepos_t::from_superclock (sc));
+		TempoMetric  tm_b        = tmap->metric_at (b, false);
+		TempoMetric  tm_bbt      = tmap->metric_at (bbt, false);
+		Beats        q           = tmap->quarters_at_superclock (sc);
+		superclock_t s           = tmap->superclock_at (b);
+		BBT_Argument bb          = tmap->bbt_at (b);
+
+		tmap->set_indexed (true);
+
+		CPPUNIT_ASSERT (t_sc == &tmap->tempo_at (sc));
+		CPPUNIT_ASSERT (m_sc == &tmap->meter_at (sc));
+		CPPUNIT_ASSERT (t_b == &tmap->tempo_at (b));
+		CPPUNIT_ASSERT (m_b == &tmap->meter_at (b));
+		CPPUNIT_ASSERT (t_bbt == &tmap->tempo_at (bbt));
+		CPPUNIT_ASSERT (m_bbt == &tmap->meter_at (bbt));
+		CPPUNIT_ASSERT (&tm_sc.tempo() == &tmap->metric_at (timepos_t::from_superclock (sc)).tempo());
+		CPPUNIT_ASSERT (&tm_sc.meter() == &tmap->metric_at (timepos_t::from_superclock (sc)).meter());
+		CPPUNIT_ASSERT (&tm_b.tempo() == &tmap->metric_at (b, false).tempo());
+		CPPUNIT_ASSERT (&tm_b.meter() == &tmap->metric_at (b, false).meter());
+		CPPUNIT_ASSERT (&tm_bbt.tempo() == &tmap->metric_at (bbt, false).tempo());
+		CPPUNIT_ASSERT (&tm_bbt.meter() == &tmap->metric_at (bbt, false).meter());
+		CPPUNIT_ASSERT (q == tmap->quarters_at_superclock (sc));
+		CPPUNIT_ASSERT (s == tmap->superclock_at (b));
+		CPPUNIT_ASSERT (bb == tmap->bbt_at (b));
+	}
+
+	/* any change to the map drops the index */
+
+	tmap->set_tempo (Tempo (200, 4), BBT_Argument (1003, 1, 0));
+	CPPUNIT_ASSERT (tmap->tempo_at (BBT_Argument (1004, 1, 0)).note_types_per_minute() == 200);
+}
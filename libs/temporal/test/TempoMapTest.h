@@ -11,6 +11,7 @@ class TempoMapTest : public CppUnit::TestFixture
 	CPPUNIT_TEST(multiplyTest);
 	CPPUNIT_TEST(convertTest);
 	CPPUNIT_TEST(roundTest);
+	CPPUNIT_TEST(indexTest);
 	CPPUNIT_TEST_SUITE_END();
 
 public:
@@ -21,4 +22,5 @@ public:
 	void multiplyTest();
 	void convertTest();
 	void roundTest();
+	void indexTest();
 };
@@ -25,6 +25,7 @@
 
 #include "pbd/basename.h"
 #include "pbd/enumwriter.h"
+#include "pbd/microseconds.h"
 
 #include "ardour/broadcast_info.h"
 #include "ardour/export_handler.h"
@@ -33,6 +34,7 @@
 #include "ardour/export_channel_configuration.h"
 #include "ardour/export_format_specification.h"
 #include "ardour/export_filename.h"
+#include "ardour/rc_configuration.h"
 #include "ardour/route.h"
 #include "ardour/session_metadata.h"
 #include "ardour/broadcast_info.h"
@@ -50,6 +52,7 @@ struct ExportSettings
 		, _sample_format (ExportFormatBase::SF_16)
 		, _normalize (false)
 		, _bwf (false)
+		, _timing (false)
 	{}
 
 	std::string samplerate () const
@@ -78,6 +81,7 @@ struct ExportSettings
 	ExportFormatBase::SampleFormat _sample_format;
 	bool _normalize;
 	bool _bwf;
+	bool _timing;
 };
 
 static int export_session (Session *session,
@@ -179,6 +183,8 @@ static int export_session (Session *session,
 	fmp->set_soundcloud_upload(false);
 	session->get_export_handler()->add_export_config (tsp, ccp, fmp, fnp, b);
 
+	PBD::microseconds_t const t0 = PBD::get_microseconds ();
+
 	if (0 != session->get_export_handler()->do_export()) {
 		return -1;
 	}
@@ -202,10 +208,19 @@ static int export_session (Session *session,
 			printf ("* Exporting...            \r");
 			break;
 		}
-		Glib::usleep (1000000);
+		Glib::usleep (settings._timing ? 10000 : 1000000);
 	}
 	printf("\n");
 
+	if (settings._timing) {
+		double const sec  = (PBD::get_microseconds () - t0) / 1e6;
+		double const dur  = (end - start) / (double) session->nominal_sample_rate ();
+		uint32_t const ch = master_out->n_ports().n_audio();
+		printf ("* Exported %.1f sec (%u channels) in %.2f sec: %.1fx realtime, %.2f Msamples/sec (encoder queue: %u)\n",
+				dur, ch, sec, dur / std::max (1e-6, sec), ch * dur * session->nominal_sample_rate () / std::max (1e-6, sec) / 1e6,
+				Config->get_export_encoder_queue ());
+	}
+
 	status->finish (TRS_UI);
 
 	printf ("* Done.\n");
@@ -222,7 +237,9 @@ static void usage () {
   -h, --help                 display this help and exit\n\
   -n, --normalize            normalize signal level (to 0dBFS)\n\
   -o, --output  <file>       export output file name\n\
+  -q, --queue <blocks>       blocks queued per encoder thread (0: encode in process thread)\n\
   -s, --samplerate <rate>    samplerate to use\n\
+  -T, --timing               measure and print export throughput\n\
   -V, --version              print version information and exit\n\
 \n");
 	printf ("\n\
@@ -244,7 +261,9 @@ int main (int argc, char* argv[])
 	ExportSettings settings;
 	std::string outfile;
 
-	const char *optstring = "b:Bhno:s:V";
+	int encoder_queue = -1;
+
+	const char *optstring = "b:Bhno:q:s:TV";
 
 	const struct option longopts[] = {
 		{ "bitdepth",   1, 0, 'b' },
@@ -252,7 +271,9 @@ int main (int argc, char* argv[])
 		{ "help",       0, 0, 'h' },
 		{ "normalize",  0, 0, 'n' },
 		{ "output",     1, 0, 'o' },
+		{ "queue",      1, 0, 'q' },
 		{ "samplerate", 1, 0, 's' },
+		{ "timing",     0, 0, 'T' },
 		{ "version",    0, 0, 'V' },
 	};
 
@@ -296,6 +317,14 @@ int main (int argc, char* argv[])
 				outfile = optarg;
 				break;
 
+			case 'q':
+				encoder_queue = atoi (optarg);
+				if (encoder_queue < 0) {
+					fprintf(stderr, "Invalid queue size\n");
+					encoder_queue = -1;
+				}
+				break;
+
 			case 's':
 				{
 					const int sr = atoi (optarg);
@@ -307,6 +336,10 @@ int main (int argc, char* argv[])
 				}
 				break;
 
+			case 'T':
+				settings._timing = true;
+				break;
+
 			case 'V':
 				printf ("ardour-utils version %s\n\n", VERSIONSTRING);
 				printf ("Copyright (C) GPL 2015,2017 Robin Gareus <robin@gareus.org>\n");
@@ -332,6 +365,10 @@ int main (int argc, char* argv[])
 	SessionUtils::init(false);
 	Session* s = 0;
 
+	if (encoder_queue >= 0) {
+		Config->set_export_encoder_queue (encoder_queue);
+	}
+
 	s = SessionUtils::load_session (argv[optind], argv[optind+1]);
 
 	if (settings._samplerate == 0) {
@@ -0,0 +1,31 @@
+ardour { ["type"] = "Snippet", name = "DSP Trace",
+	license     = "MIT",
+	author      = "Ardour Team",
+	description = [[Collect per route/plugin DSP timing, print statistics and write a Chrome trace of 100 cycles]]
+}
+
+function factory () return function ()
+
+	local trace = Session:dsp_trace ()
+	trace:reset ()
+	trace:set_enabled (true)
+	trace:capture (100)
+
+	-- wait for the capture to complete
+	while not trace:capture_complete () do
+		ARDOUR.LuaAPI.usleep (100000)
+	end
+	ARDOUR.LuaAPI.usleep (100000)
+
+	for s in trace:stats ():iter () do
+		print (string.format (" * %-32s | n: %6d min: %.3f avg: %.3f p99: %.3f max: %.3f [ms]",
+			string.sub (s.name, 0, 32), s.count,
+			s.min / 1000.0, s.avg / 1000.0, s.p99 / 1000.0, s.max / 1000.0))
+	end
+
+	if trace:write_chrome_trace ("/tmp/ardour_dsp_trace.json") then
+		print ("Chrome trace written to /tmp/ardour_dsp_trace.json")
+	end
+
+	trace:set_enabled (false)
+end end
@@ -17,7 +17,7 @@
  */
 
 import { Component } from './base/component.js';
-import { StateNode } from './base/protocol.js';
+import { Message, StateNode } from './base/protocol.js';
 import MessageChannel from './base/channel.js';
 import Mixer from './components/mixer.js';
 import Transport from './components/transport.js';
@@ -40,6 +40,9 @@ export default class ArdourClient extends Component {
 		}
 
 		this._autoReconnect = getOption(options, 'autoReconnect', true);
+		// meter feed (see MeterFeed), defaults to the surface manifest
+		this._meters = getOption(options, 'meters', undefined);
+		this._meterThreshold = getOption(options, 'meterThreshold', 0);
 		this._connected = false;
 
 		this.channel.onMessage = (msg, inbound) => this._handleMessage(msg, inbound);
@@ -125,9 +128,26 @@ export default class ArdourClient extends Component {
 
 	async _connect () {
 		await this.channel.open();
+		await this._requestMeterFeed();
 		this._setConnected(true);
 	}
 
+	async _requestMeterFeed () {
+		if (this._meters === undefined) {
+			try {
+				const manifest = await this.getSurfaceManifest();
+				this._meters = manifest.meters || null;
+				this._meterThreshold = parseFloat(manifest.meterthreshold) || 0;
+			} catch (err) {
+				this._meters = null;
+			}
+		}
+
+		if (this._meters) {
+			this.send(new Message(StateNode.METER_FEED, [], [this._meters, this._meterThreshold]));
+		}
+	}
+
 	_setConnected (connected) {
 		this._connected = connected;
 		this.notifyPropertyChanged('connected');
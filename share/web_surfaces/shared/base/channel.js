@@ -29,13 +29,15 @@ export default class MessageChannel {
 	async open () {
 		return new Promise((resolve, reject) => {
 			this._socket = new WebSocket(`ws://${this._host}`);
+			this._socket.binaryType = 'arraybuffer';
 
 			this._socket.onclose = () => this.onClose();
 
 			this._socket.onerror = (error) => this.onError(error);
 
 			this._socket.onmessage = (event) => {
-				const msg = Message.fromJsonText(event.data);
+				const msg = (event.data instanceof ArrayBuffer) ?
+					Message.fromMeterFrame(event.data) : Message.fromJsonText(event.data);
 
 				if (this._pending && (this._pending.nodeAddrId == msg.nodeAddrId)) {
 					this._pending.resolve(msg);
@@ -21,6 +21,7 @@ export const JSON_INF = 1.0e+128;
 export const StateNode = Object.freeze({
 	STRIP_DESCRIPTION              : 'strip_description',
 	STRIP_METER                    : 'strip_meter',
+	STRIP_METERS                   : 'strip_meters',
 	STRIP_GAIN                     : 'strip_gain',
 	STRIP_PAN                      : 'strip_pan',
 	STRIP_MUTE                     : 'strip_mute',
@@ -31,7 +32,14 @@ export const StateNode = Object.freeze({
 	TRANSPORT_TEMPO                : 'transport_tempo',
 	TRANSPORT_TIME                 : 'transport_time',
 	TRANSPORT_ROLL                 : 'transport_roll',
-	TRANSPORT_RECORD               : 'transport_record'
+	TRANSPORT_RECORD               : 'transport_record',
+	METER_FEED                     : 'meter_feed'
+});
+
+export const MeterFeed = Object.freeze({
+	STRIP  : 'strip',
+	BATCH  : 'batch',
+	BINARY : 'binary'
 });
 
 export class Message {
@@ -61,6 +69,20 @@ export class Message {
 		return new Message(rawMsg.node, rawMsg.addr || [], rawMsg.val);
 	}
 
+	// binary meter frame, see libs/surfaces/websockets/meter_frame.h
+	static fromMeterFrame (buffer) {
+		const view = new DataView(buffer);
+		const count = view.getUint32(0, true);
+		const addr = [], val = [];
+
+		for (let i = 0, offset = 4; i < count; i++, offset += 8) {
+			addr.push(view.getUint32(offset, true));
+			val.push(view.getFloat32(offset + 4, true));
+		}
+
+		return new Message(StateNode.STRIP_METERS, addr, val);
+	}
+
 	toJsonText () {
 		let val = [];
 
@@ -47,6 +47,15 @@ export default class Mixer extends ChildComponent {
 	 			this._strips[addr] = new Strip(this, addr, val);
 	 			this.notifyPropertyChanged('strips');
 	 			return true;
+	 		} else if (node == StateNode.STRIP_METERS) {
+	 			// batched meter feed, addr and val hold one entry per strip
+	 			for (let i = 0; i < addr.length; i++) {
+	 				const stripAddr = [addr[i]];
+	 				if (stripAddr in this._strips) {
+	 					this._strips[stripAddr].handle(StateNode.STRIP_METER, stripAddr, [val[i]]);
+	 				}
+	 			}
+	 			return true;
 	 		} else {
 	 			const stripAddr = [addr[0]];
 	 			if (stripAddr in this._strips) {